@@ -0,0 +1,141 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Measures the time needed to load synthetic configurations consisting of
+// several files containing 10, 100 and 1000 services each.
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "../implementation/configuration/include/configuration_impl.hpp"
+
+namespace vsomeip = vsomeip_v3;
+
+static const std::size_t BENCHMARK_FILE_COUNT = 8;
+static const std::size_t BENCHMARK_EVENTS_PER_SERVICE = 10;
+
+static void write_service(std::ostream &_out, std::size_t _index) {
+    const unsigned its_service = static_cast<unsigned>(0x1000 + _index);
+    _out << "        {\n"
+         << "            \"service\" : \"0x" << std::hex << its_service << "\",\n"
+         << "            \"instance\" : \"0x1\",\n" << std::dec
+         << "            \"unreliable\" : \"" << 30000 + _index << "\",\n"
+         << "            \"reliable\" : { \"port\" : \"" << 40000 + _index
+         << "\", \"enable-magic-cookies\" : \"false\" },\n"
+         << "            \"events\" :\n"
+         << "            [\n";
+    for (std::size_t e = 0; e < BENCHMARK_EVENTS_PER_SERVICE; e++) {
+        _out << "                { \"event\" : \"0x" << std::hex << 0x8000 + e
+             << "\", \"is_field\" : \"" << (e % 2 ? "true" : "false")
+             << "\", \"is_reliable\" : \"false\" }"
+             << (e + 1 < BENCHMARK_EVENTS_PER_SERVICE ? "," : "") << "\n";
+    }
+    _out << "            ],\n"
+         << "            \"eventgroups\" :\n"
+         << "            [\n"
+         << "                { \"eventgroup\" : \"0x1\", \"events\" : [";
+    for (std::size_t e = 0; e < BENCHMARK_EVENTS_PER_SERVICE; e++) {
+        _out << "\"0x" << std::hex << 0x8000 + e << "\""
+             << (e + 1 < BENCHMARK_EVENTS_PER_SERVICE ? ", " : "");
+    }
+    _out << std::dec << "] }\n"
+         << "            ]\n"
+         << "        }";
+}
+
+static void write_configuration(const boost::filesystem::path &_folder,
+        std::size_t _services) {
+    boost::filesystem::create_directories(_folder);
+    {
+        std::ofstream its_out((_folder / "base.json").string());
+        its_out << "{\n"
+                << "    \"unicast\" : \"127.0.0.1\",\n"
+                << "    \"logging\" : { \"level\" : \"warning\", \"console\" : \"false\","
+                << " \"dlt\" : \"false\" },\n"
+                << "    \"applications\" : [ { \"name\" : \"benchmark\", \"id\" : \"0x1001\" } ],\n"
+                << "    \"routing\" : \"benchmark\"\n"
+                << "}\n";
+    }
+
+    const std::size_t its_per_file
+        = (_services + BENCHMARK_FILE_COUNT - 1) / BENCHMARK_FILE_COUNT;
+    for (std::size_t f = 0; f * its_per_file < _services; f++) {
+        std::stringstream its_name;
+        its_name << "services_" << f << ".json";
+        std::ofstream its_out((_folder / its_name.str()).string());
+        its_out << "{\n    \"services\" :\n    [\n";
+        for (std::size_t s = f * its_per_file;
+                s < _services && s < (f + 1) * its_per_file; s++) {
+            if (s != f * its_per_file)
+                its_out << ",\n";
+            write_service(its_out, s);
+        }
+        its_out << "\n    ]\n}\n";
+    }
+}
+
+int main(int argc, char **argv) {
+    std::size_t its_iterations(10);
+    if (argc > 1) {
+        its_iterations = static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10));
+        if (its_iterations == 0)
+            its_iterations = 1;
+    }
+
+    const boost::filesystem::path its_root = boost::filesystem::temp_directory_path()
+            / boost::filesystem::unique_path("vsomeip-configuration-benchmark-%%%%-%%%%");
+
+    std::cout << std::setw(10) << "services"
+              << std::setw(10) << "files"
+              << std::setw(14) << "mean [us]"
+              << std::setw(14) << "min [us]" << std::endl;
+
+    for (std::size_t its_services : { 10, 100, 1000 }) {
+        std::stringstream its_subfolder;
+        its_subfolder << its_services;
+        const boost::filesystem::path its_folder = its_root / its_subfolder.str();
+        write_configuration(its_folder, its_services);
+#ifdef _WIN32
+        _putenv_s("VSOMEIP_CONFIGURATION", its_folder.string().c_str());
+#else
+        setenv("VSOMEIP_CONFIGURATION", its_folder.string().c_str(), 1);
+#endif
+
+        std::chrono::microseconds its_sum(0);
+        std::chrono::microseconds its_min(std::chrono::microseconds::max());
+        std::size_t its_file_count(0);
+        for (std::size_t i = 0; i < its_iterations; i++) {
+            auto its_configuration = std::make_shared<vsomeip::cfg::configuration_impl>();
+            auto its_start = std::chrono::steady_clock::now();
+            its_configuration->load("benchmark");
+            auto its_duration = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - its_start);
+            its_sum += its_duration;
+            if (its_duration < its_min)
+                its_min = its_duration;
+        }
+        for (auto f = boost::filesystem::directory_iterator(its_folder);
+                f != boost::filesystem::directory_iterator(); f++)
+            its_file_count++;
+
+        std::cout << std::setw(10) << its_services
+                  << std::setw(10) << its_file_count
+                  << std::setw(14) << its_sum.count() / static_cast<long>(its_iterations)
+                  << std::setw(14) << its_min.count() << std::endl;
+    }
+
+    boost::system::error_code its_error;
+    boost::filesystem::remove_all(its_root, its_error);
+    return 0;
+}
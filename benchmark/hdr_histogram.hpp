@@ -0,0 +1,110 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_BENCHMARK_HDR_HISTOGRAM_HPP_
+#define VSOMEIP_V3_BENCHMARK_HDR_HISTOGRAM_HPP_
+
+#include <cstdint>
+#include <vector>
+
+namespace vsomeip_v3 {
+namespace benchmark {
+
+// High dynamic range histogram of latencies in the spirit of HdrHistogram.
+// Values below 2048 are counted exactly. Bigger values are counted in
+// buckets of 1024 sub-buckets each. Thus, the relative error of a value is
+// below 0.1% (three significant digits) up to the highest trackable value
+// of 2^40 (about 18 minutes in nanoseconds). Bigger values are clamped.
+class hdr_histogram {
+public:
+    hdr_histogram()
+        : counts_(SUB_BUCKETS * (BUCKETS + 1), 0),
+          count_(0), sum_(0), max_(0) {
+    }
+
+    void record(std::uint64_t _value) {
+        if (_value > HIGHEST_VALUE)
+            _value = HIGHEST_VALUE;
+        counts_[get_index(_value)]++;
+        count_++;
+        sum_ += _value;
+        if (_value > max_)
+            max_ = _value;
+    }
+
+    std::uint64_t count() const {
+        return count_;
+    }
+
+    double mean() const {
+        return (count_ ? static_cast<double>(sum_) / static_cast<double>(count_) : 0.0);
+    }
+
+    std::uint64_t max() const {
+        return max_;
+    }
+
+    // Returns the (highest equivalent) value that _percentile percent of
+    // all recorded values are not bigger than.
+    std::uint64_t value_at_percentile(double _percentile) const {
+        if (!count_)
+            return 0;
+
+        std::uint64_t its_target = static_cast<std::uint64_t>(
+                _percentile / 100.0 * static_cast<double>(count_) + 0.5);
+        if (its_target == 0)
+            its_target = 1;
+
+        std::uint64_t its_count(0);
+        for (std::size_t i = 0; i < counts_.size(); i++) {
+            its_count += counts_[i];
+            if (its_count >= its_target) {
+                const std::uint64_t its_value = get_highest_value(i);
+                return (its_value < max_ ? its_value : max_);
+            }
+        }
+        return max_;
+    }
+
+private:
+    static const std::uint32_t SUB_BUCKET_BITS = 10;
+    static const std::uint32_t SUB_BUCKETS = (1 << SUB_BUCKET_BITS);
+    static const std::uint32_t BUCKETS = 40 - SUB_BUCKET_BITS;
+    static const std::uint64_t HIGHEST_VALUE = (std::uint64_t(1) << 40) - 1;
+
+    static std::uint32_t get_magnitude(std::uint64_t _value) {
+        return 63 - static_cast<std::uint32_t>(__builtin_clzll(_value));
+    }
+
+    static std::size_t get_index(std::uint64_t _value) {
+        if (_value < 2 * SUB_BUCKETS)
+            return static_cast<std::size_t>(_value);
+
+        const std::uint32_t its_shift = get_magnitude(_value) - SUB_BUCKET_BITS;
+        return static_cast<std::size_t>(SUB_BUCKETS * (its_shift + 1)
+                + ((_value >> its_shift) - SUB_BUCKETS));
+    }
+
+    static std::uint64_t get_highest_value(std::size_t _index) {
+        if (_index < 2 * SUB_BUCKETS)
+            return _index;
+
+        const std::uint32_t its_shift
+            = static_cast<std::uint32_t>(_index / SUB_BUCKETS) - 1;
+        const std::uint64_t its_lowest
+            = std::uint64_t(_index % SUB_BUCKETS + SUB_BUCKETS) << its_shift;
+        return its_lowest + (std::uint64_t(1) << its_shift) - 1;
+    }
+
+    std::vector<std::uint64_t> counts_;
+    std::uint64_t count_;
+    std::uint64_t sum_;
+    std::uint64_t max_;
+};
+
+} // namespace benchmark
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_BENCHMARK_HDR_HISTOGRAM_HPP_
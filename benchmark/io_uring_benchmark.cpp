@@ -0,0 +1,265 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Compares receiving from stream sockets by the asio reactor to receiving
+// by the io_uring service of the endpoints. A client thread sends over a
+// Unix domain socket pair or a TCP loopback connection to a receiver that
+// runs on an io_service, just as the endpoint connections do.
+
+#include <sys/socket.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/local/connect_pair.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+
+#include <vsomeip/primitive_types.hpp>
+
+#include "../implementation/endpoints/include/io_uring_service.hpp"
+
+namespace vsomeip = vsomeip_v3;
+
+static const std::size_t RECEIVE_BUFFER_SIZE(16384);
+static const std::size_t MESSAGE_SIZE(64);
+static const std::size_t CHUNK_SIZE(65536);
+
+// Receives on an io_service and optionally echoes what was received.
+template<typename Socket>
+class receiver : public std::enable_shared_from_this<receiver<Socket> > {
+public:
+    receiver(Socket &_socket, vsomeip::io_uring_service *_io_uring, bool _echo)
+        : socket_(_socket),
+          io_uring_(_io_uring),
+          echo_(_echo),
+          buffer_(RECEIVE_BUFFER_SIZE),
+          received_(0),
+          is_stopped_(false) {
+    }
+
+    void receive() {
+        auto its_buffer = boost::asio::buffer(buffer_);
+        if (io_uring_) {
+            io_uring_->async_receive(socket_.native_handle(), its_buffer,
+                    std::bind(&receiver::receive_cbk, this->shared_from_this(),
+                            std::placeholders::_1, std::placeholders::_2));
+        } else {
+            socket_.async_receive(its_buffer,
+                    std::bind(&receiver::receive_cbk, this->shared_from_this(),
+                            std::placeholders::_1, std::placeholders::_2));
+        }
+    }
+
+    // Must be called on the io thread. Otherwise a running handler could
+    // restart receiving after the receive was cancelled.
+    void stop() {
+        is_stopped_ = true;
+        if (io_uring_)
+            io_uring_->cancel(socket_.native_handle());
+        else
+            socket_.cancel();
+    }
+
+    std::size_t get_received() const {
+        return received_;
+    }
+
+private:
+    void receive_cbk(const boost::system::error_code &_error, std::size_t _bytes) {
+        if (_error || is_stopped_)
+            return;
+        received_ += _bytes;
+        if (echo_) {
+            std::size_t its_sent(0);
+            while (its_sent < _bytes) {
+                ssize_t its_result = ::send(socket_.native_handle(),
+                        &buffer_[its_sent], _bytes - its_sent, MSG_NOSIGNAL);
+                if (its_result < 0) {
+                    if (errno == EAGAIN || errno == EINTR)
+                        continue;
+                    return;
+                }
+                its_sent += static_cast<std::size_t>(its_result);
+            }
+        }
+        receive();
+    }
+
+    Socket &socket_;
+    vsomeip::io_uring_service *io_uring_;
+    const bool echo_;
+    std::vector<vsomeip::byte_t> buffer_;
+    std::atomic<std::size_t> received_;
+    bool is_stopped_;
+};
+
+template<typename Socket>
+static void stop(boost::asio::io_service &_io,
+        const std::shared_ptr<receiver<Socket> > &_receiver, std::thread &_thread) {
+    std::promise<void> its_stopped;
+    _io.post([&_receiver, &its_stopped]() {
+        _receiver->stop();
+        its_stopped.set_value();
+    });
+    its_stopped.get_future().wait();
+    _io.stop();
+    _thread.join();
+    _io.reset();
+}
+
+static bool send_all(int _socket, const vsomeip::byte_t *_data, std::size_t _size) {
+    std::size_t its_sent(0);
+    while (its_sent < _size) {
+        ssize_t its_result = ::send(_socket, _data + its_sent, _size - its_sent,
+                MSG_NOSIGNAL);
+        if (its_result <= 0)
+            return false;
+        its_sent += static_cast<std::size_t>(its_result);
+    }
+    return true;
+}
+
+struct result {
+    double average_latency_;
+    double p99_latency_;
+    double throughput_;
+};
+
+template<typename Socket>
+static result run(boost::asio::io_service &_io,
+        Socket &_receiving, Socket &_sending, bool _use_io_uring,
+        std::size_t _round_trips, std::size_t _bytes) {
+    result its_result = { 0.0, 0.0, 0.0 };
+
+    vsomeip::io_uring_service *its_io_uring(nullptr);
+    if (_use_io_uring) {
+        std::unique_ptr<vsomeip::io_uring_service> its_service(
+                new vsomeip::io_uring_service(_io));
+        if (!its_service->init(256)) {
+            std::cerr << "io_uring is not available." << std::endl;
+            return its_result;
+        }
+        boost::asio::add_service(_io, its_service.release());
+        its_io_uring = &boost::asio::use_service<vsomeip::io_uring_service>(_io);
+    }
+
+    // Latency: round trips of small messages
+    {
+        auto its_receiver = std::make_shared<receiver<Socket> >(
+                _receiving, its_io_uring, true);
+        its_receiver->receive();
+        std::thread its_thread([&_io]() { _io.run(); });
+
+        std::vector<vsomeip::byte_t> its_message(MESSAGE_SIZE, 0x5A);
+        std::vector<double> its_latencies;
+        its_latencies.reserve(_round_trips);
+        for (std::size_t i = 0; i < _round_trips; i++) {
+            auto its_start = std::chrono::steady_clock::now();
+            if (!send_all(_sending.native_handle(), its_message.data(), its_message.size())
+                    || ::recv(_sending.native_handle(), its_message.data(),
+                            its_message.size(), MSG_WAITALL)
+                        != static_cast<ssize_t>(its_message.size())) {
+                std::cerr << "Round trip failed." << std::endl;
+                break;
+            }
+            its_latencies.push_back(static_cast<double>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now() - its_start).count()));
+        }
+        stop(_io, its_receiver, its_thread);
+
+        if (!its_latencies.empty()) {
+            std::sort(its_latencies.begin(), its_latencies.end());
+            double its_sum(0.0);
+            for (auto l : its_latencies)
+                its_sum += l;
+            its_result.average_latency_ = its_sum / static_cast<double>(its_latencies.size());
+            its_result.p99_latency_ = its_latencies[its_latencies.size() * 99 / 100];
+        }
+    }
+
+    // Throughput: a stream of large chunks
+    {
+        auto its_receiver = std::make_shared<receiver<Socket> >(
+                _receiving, its_io_uring, false);
+        its_receiver->receive();
+        std::thread its_thread([&_io]() { _io.run(); });
+
+        std::vector<vsomeip::byte_t> its_chunk(CHUNK_SIZE, 0xA5);
+        auto its_start = std::chrono::steady_clock::now();
+        for (std::size_t its_sent = 0; its_sent < _bytes; its_sent += CHUNK_SIZE) {
+            if (!send_all(_sending.native_handle(), its_chunk.data(), its_chunk.size()))
+                break;
+        }
+        while (its_receiver->get_received() < _bytes)
+            std::this_thread::yield();
+        auto its_duration = std::chrono::steady_clock::now() - its_start;
+
+        stop(_io, its_receiver, its_thread);
+
+        its_result.throughput_ = static_cast<double>(_bytes) / (1024.0 * 1024.0)
+                / std::chrono::duration<double>(its_duration).count();
+    }
+
+    return its_result;
+}
+
+static void print(const std::string &_name, const result &_result) {
+    std::cout << std::setw(16) << _name
+              << std::fixed << std::setprecision(1)
+              << std::setw(18) << _result.average_latency_ / 1000.0
+              << std::setw(18) << _result.p99_latency_ / 1000.0
+              << std::setw(18) << _result.throughput_ << std::endl;
+}
+
+int main(int argc, char **argv) {
+    std::size_t its_round_trips(100000);
+    if (argc > 1) {
+        its_round_trips = static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10));
+        if (its_round_trips == 0)
+            its_round_trips = 1;
+    }
+    const std::size_t its_bytes(std::size_t(1024) * 1024 * 1024);
+
+    std::cout << std::setw(16) << ""
+              << std::setw(18) << "avg. RTT [us]"
+              << std::setw(18) << "p99 RTT [us]"
+              << std::setw(18) << "throughput [MB/s]" << std::endl;
+
+    for (bool its_use_io_uring : { false, true }) {
+        const std::string its_backend(its_use_io_uring ? "io_uring" : "asio");
+        {
+            boost::asio::io_service its_io;
+            boost::asio::local::stream_protocol::socket its_receiving(its_io), its_sending(its_io);
+            boost::asio::local::connect_pair(its_receiving, its_sending);
+            print("uds " + its_backend,
+                    run(its_io, its_receiving, its_sending, its_use_io_uring, its_round_trips, its_bytes));
+        }
+        {
+            boost::asio::io_service its_io;
+            boost::asio::ip::tcp::acceptor its_acceptor(its_io,
+                    boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+            boost::asio::ip::tcp::socket its_receiving(its_io), its_sending(its_io);
+            its_sending.connect(its_acceptor.local_endpoint());
+            its_acceptor.accept(its_receiving);
+            its_sending.set_option(boost::asio::ip::tcp::no_delay(true));
+            its_receiving.set_option(boost::asio::ip::tcp::no_delay(true));
+            print("tcp " + its_backend,
+                    run(its_io, its_receiving, its_sending, its_use_io_uring, its_round_trips, its_bytes));
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,742 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Generates load between a server and a client application and measures
+// throughput, latency, CPU time and allocations per message. Both
+// applications use the public application API and run in processes of
+// their own on the local host.
+//
+// Topologies:
+//   reqresp  The client sends requests, keeping up to <window> of them
+//            outstanding. The latency is the round trip time.
+//   pubsub   The server publishes events at <rate> events per second to the
+//            subscribed client. The latency is the one way time.
+//
+// Transports:
+//   uds      Both applications are connected to the same routing manager
+//            (local communication).
+//   udp/tcp  Each application is its own routing manager. The service is
+//            found by service discovery on the loopback interface.
+//
+// The send time is part of each payload. Therefore, latencies can be
+// measured across processes (std::chrono::steady_clock is system wide).
+// CPU time and allocations are measured per process between the start and
+// the end of the load phase. The server reports its share in the response
+// to the stop request.
+
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include <vsomeip/vsomeip.hpp>
+
+#include "hdr_histogram.hpp"
+
+namespace vsomeip = vsomeip_v3;
+
+static const vsomeip::service_t BENCHMARK_SERVICE = 0x1211;
+static const vsomeip::instance_t BENCHMARK_INSTANCE = 0x0001;
+static const vsomeip::method_t BENCHMARK_METHOD_PING = 0x0001;
+static const vsomeip::method_t BENCHMARK_METHOD_START = 0x0002;
+static const vsomeip::method_t BENCHMARK_METHOD_STOP = 0x0003;
+static const vsomeip::event_t BENCHMARK_EVENT = 0x8001;
+static const vsomeip::eventgroup_t BENCHMARK_EVENTGROUP = 0x0001;
+static const std::uint16_t BENCHMARK_PORT = 30511;
+
+static const char *BENCHMARK_SERVER = "load-server";
+static const char *BENCHMARK_CLIENT = "load-client";
+
+// Counts the allocations of the process (including the ones of vsomeip).
+static std::atomic<std::uint64_t> allocations__(0);
+
+void *operator new(std::size_t _size) {
+    allocations__.fetch_add(1, std::memory_order_relaxed);
+    void *its_memory = std::malloc(_size ? _size : 1);
+    if (!its_memory)
+        throw std::bad_alloc();
+    return its_memory;
+}
+
+void *operator new[](std::size_t _size) {
+    return operator new(_size);
+}
+
+void operator delete(void *_memory) noexcept {
+    std::free(_memory);
+}
+
+void operator delete[](void *_memory) noexcept {
+    std::free(_memory);
+}
+
+enum class topology_e { REQUEST_RESPONSE, PUBLISH_SUBSCRIBE };
+enum class transport_e { UDS, UDP, TCP };
+
+struct options {
+    std::vector<topology_e> topologies_;
+    std::vector<transport_e> transports_;
+    std::size_t messages_;
+    std::size_t payload_;
+    std::size_t window_;
+    std::size_t rate_;
+    std::string json_;
+};
+
+struct usage {
+    std::uint64_t cpu_; // [ns]
+    std::uint64_t allocations_;
+};
+
+// Written by the client process to the parent process.
+struct result {
+    bool is_valid_;
+    std::uint64_t sent_;
+    std::uint64_t received_;
+    std::uint64_t duration_; // [ns]
+    double mean_; // [ns]
+    std::uint64_t p50_; // [ns]
+    std::uint64_t p99_; // [ns]
+    std::uint64_t p999_; // [ns]
+    std::uint64_t max_; // [ns]
+    usage client_;
+    usage server_;
+};
+
+struct case_result {
+    topology_e topology_;
+    transport_e transport_;
+    result result_;
+};
+
+static const char *to_string(topology_e _topology) {
+    return (_topology == topology_e::REQUEST_RESPONSE ? "reqresp" : "pubsub");
+}
+
+static const char *to_string(transport_e _transport) {
+    switch (_transport) {
+    case transport_e::UDP:
+        return "udp";
+    case transport_e::TCP:
+        return "tcp";
+    default:
+        return "uds";
+    }
+}
+
+static vsomeip::reliability_type_e get_reliability(transport_e _transport) {
+    switch (_transport) {
+    case transport_e::UDP:
+        return vsomeip::reliability_type_e::RT_UNRELIABLE;
+    case transport_e::TCP:
+        return vsomeip::reliability_type_e::RT_RELIABLE;
+    default:
+        return vsomeip::reliability_type_e::RT_UNKNOWN;
+    }
+}
+
+static usage get_usage() {
+    struct rusage its_rusage;
+    getrusage(RUSAGE_SELF, &its_rusage);
+    usage its_usage;
+    its_usage.cpu_ = static_cast<std::uint64_t>(
+              its_rusage.ru_utime.tv_sec + its_rusage.ru_stime.tv_sec) * 1000000000ULL
+            + static_cast<std::uint64_t>(
+              its_rusage.ru_utime.tv_usec + its_rusage.ru_stime.tv_usec) * 1000ULL;
+    its_usage.allocations_ = allocations__.load(std::memory_order_relaxed);
+    return its_usage;
+}
+
+static usage get_usage_since(const usage &_start) {
+    usage its_usage = get_usage();
+    its_usage.cpu_ -= _start.cpu_;
+    its_usage.allocations_ -= _start.allocations_;
+    return its_usage;
+}
+
+static std::uint64_t get_timestamp() {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<
+            std::chrono::nanoseconds>(std::chrono::steady_clock::now()
+                    .time_since_epoch()).count());
+}
+
+static void write_configuration(const std::string &_file,
+        const std::string &_name, transport_e _transport) {
+    const bool is_server(_name == BENCHMARK_SERVER);
+
+    std::ofstream its_out(_file);
+    its_out << "{\n";
+    if (_transport == transport_e::UDS) {
+        its_out << "    \"unicast\" : \"127.0.0.1\",\n"
+                << "    \"network\" : \"vsomeip-load\",\n";
+    } else {
+        its_out << "    \"unicast\" : \"" << (is_server ? "127.0.0.2" : "127.0.0.1") << "\",\n"
+                << "    \"network\" : \"vsomeip-" << _name << "\",\n";
+    }
+    // Fixed client identifiers as the routing managers of the udp/tcp cases
+    // would otherwise assign the same one to both applications
+    its_out << "    \"logging\" : { \"level\" : \"warning\", \"console\" : \"false\","
+            << " \"dlt\" : \"false\" },\n"
+            << "    \"applications\" :\n"
+            << "    [\n"
+            << "        { \"name\" : \"" << BENCHMARK_SERVER << "\", \"id\" : \"0x1201\" },\n"
+            << "        { \"name\" : \"" << BENCHMARK_CLIENT << "\", \"id\" : \"0x1202\" }\n"
+            << "    ],\n";
+    if (_transport == transport_e::UDS) {
+        its_out << "    \"routing\" : \"" << BENCHMARK_SERVER << "\",\n"
+                << "    \"service-discovery\" : { \"enable\" : \"false\" }\n";
+    } else {
+        if (is_server) {
+            its_out << "    \"services\" :\n"
+                    << "    [\n"
+                    << "        {\n"
+                    << "            \"service\" : \"0x" << std::hex << BENCHMARK_SERVICE << "\",\n"
+                    << "            \"instance\" : \"0x" << BENCHMARK_INSTANCE << "\",\n"
+                    << std::dec;
+            if (_transport == transport_e::TCP) {
+                its_out << "            \"reliable\" : { \"port\" : \"" << BENCHMARK_PORT
+                        << "\", \"enable-magic-cookies\" : \"false\" }\n";
+            } else {
+                its_out << "            \"unreliable\" : \"" << BENCHMARK_PORT << "\"\n";
+            }
+            its_out << "        }\n"
+                    << "    ],\n";
+        }
+        // Send the messages without buffering them for a train
+        its_out << "    \"npdu-default-timings\" :\n"
+                << "    {\n"
+                << "        \"debounce-time-request\" : \"0\",\n"
+                << "        \"debounce-time-response\" : \"0\",\n"
+                << "        \"max-retention-time-request\" : \"0\",\n"
+                << "        \"max-retention-time-response\" : \"0\"\n"
+                << "    },\n"
+                << "    \"routing\" : \"" << _name << "\",\n"
+                << "    \"service-discovery\" :\n"
+                << "    {\n"
+                << "        \"enable\" : \"true\",\n"
+                << "        \"multicast\" : \"224.244.224.245\",\n"
+                << "        \"port\" : \"30490\",\n"
+                << "        \"protocol\" : \"udp\",\n"
+                << "        \"initial_delay_min\" : \"10\",\n"
+                << "        \"initial_delay_max\" : \"10\",\n"
+                << "        \"repetitions_base_delay\" : \"50\",\n"
+                << "        \"request_response_delay\" : \"10\",\n"
+                << "        \"cyclic_offer_delay\" : \"1000\",\n"
+                << "        \"ttl\" : \"3\"\n"
+                << "    }\n";
+    }
+    its_out << "}\n";
+}
+
+static void run_server(const options &_options, topology_e _topology,
+        transport_e _transport) {
+    auto its_app = vsomeip::runtime::get()->create_application(BENCHMARK_SERVER);
+    if (!its_app->init())
+        return;
+
+    std::mutex its_mutex;
+    std::condition_variable its_condition;
+    bool is_stopped(false);
+    usage its_start;
+    std::thread its_publisher;
+    std::atomic<bool> is_publishing(false);
+
+    its_app->register_message_handler(BENCHMARK_SERVICE, BENCHMARK_INSTANCE,
+            BENCHMARK_METHOD_PING,
+            [&its_app](const std::shared_ptr<vsomeip::message> &_request) {
+                auto its_response = vsomeip::runtime::get()->create_response(_request);
+                its_response->set_payload(_request->get_payload());
+                its_app->send(its_response);
+            });
+    its_app->register_message_handler(BENCHMARK_SERVICE, BENCHMARK_INSTANCE,
+            BENCHMARK_METHOD_START,
+            [&](const std::shared_ptr<vsomeip::message> &_request) {
+                its_start = get_usage();
+                its_app->send(vsomeip::runtime::get()->create_response(_request));
+                if (_topology != topology_e::PUBLISH_SUBSCRIBE || is_publishing)
+                    return;
+
+                is_publishing = true;
+                its_publisher = std::thread([&]() {
+                    std::vector<vsomeip::byte_t> its_data(_options.payload_, 0x5A);
+                    auto its_payload = vsomeip::runtime::get()->create_payload();
+                    const auto its_begin = std::chrono::steady_clock::now();
+                    for (std::size_t i = 0; i < _options.messages_ && is_publishing; i++) {
+                        if (_options.rate_) {
+                            std::this_thread::sleep_until(its_begin
+                                    + std::chrono::nanoseconds(i * 1000000000ULL / _options.rate_));
+                        }
+                        const std::uint64_t its_timestamp = get_timestamp();
+                        std::memcpy(&its_data[0], &its_timestamp, sizeof(its_timestamp));
+                        its_payload->set_data(its_data);
+                        its_app->notify(BENCHMARK_SERVICE, BENCHMARK_INSTANCE,
+                                BENCHMARK_EVENT, its_payload, true);
+                    }
+                });
+            });
+    its_app->register_message_handler(BENCHMARK_SERVICE, BENCHMARK_INSTANCE,
+            BENCHMARK_METHOD_STOP,
+            [&](const std::shared_ptr<vsomeip::message> &_request) {
+                const usage its_usage = get_usage_since(its_start);
+                auto its_response = vsomeip::runtime::get()->create_response(_request);
+                its_response->set_payload(vsomeip::runtime::get()->create_payload(
+                        reinterpret_cast<const vsomeip::byte_t *>(&its_usage),
+                        sizeof(its_usage)));
+                its_app->send(its_response);
+
+                std::lock_guard<std::mutex> its_lock(its_mutex);
+                is_stopped = true;
+                its_condition.notify_one();
+            });
+
+    if (_topology == topology_e::PUBLISH_SUBSCRIBE) {
+        its_app->offer_event(BENCHMARK_SERVICE, BENCHMARK_INSTANCE,
+                BENCHMARK_EVENT, { BENCHMARK_EVENTGROUP },
+                vsomeip::event_type_e::ET_EVENT, std::chrono::milliseconds::zero(),
+                false, true, nullptr, get_reliability(_transport));
+    }
+    its_app->offer_service(BENCHMARK_SERVICE, BENCHMARK_INSTANCE);
+
+    std::thread its_thread([&its_app]() { its_app->start(); });
+    {
+        std::unique_lock<std::mutex> its_lock(its_mutex);
+        its_condition.wait(its_lock, [&is_stopped]() { return is_stopped; });
+    }
+    is_publishing = false;
+    if (its_publisher.joinable())
+        its_publisher.join();
+
+    // Give the response to the stop request the chance to leave
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    its_app->stop();
+    its_thread.join();
+}
+
+static void run_client(const options &_options, topology_e _topology,
+        transport_e _transport, result &_result) {
+    auto its_app = vsomeip::runtime::get()->create_application(BENCHMARK_CLIENT);
+    if (!its_app->init())
+        return;
+
+    std::mutex its_mutex;
+    std::condition_variable its_condition;
+    bool is_available(false);
+    bool is_subscribed(_topology != topology_e::PUBLISH_SUBSCRIBE);
+    bool is_started(false);
+    bool is_stopped(false);
+    std::size_t its_sent(0);
+    std::size_t its_received(0);
+    std::uint64_t its_last_received(0);
+    vsomeip_v3::benchmark::hdr_histogram its_latencies;
+
+    const bool use_tcp(_transport == transport_e::TCP);
+    std::vector<vsomeip::byte_t> its_data(_options.payload_, 0x5A);
+    auto its_payload = vsomeip::runtime::get()->create_payload();
+    auto its_request = vsomeip::runtime::get()->create_request(use_tcp);
+    its_request->set_service(BENCHMARK_SERVICE);
+    its_request->set_instance(BENCHMARK_INSTANCE);
+    its_request->set_method(BENCHMARK_METHOD_PING);
+    its_request->set_payload(its_payload);
+
+    // Must be called with its_mutex being locked
+    auto send_request = [&]() {
+        const std::uint64_t its_timestamp = get_timestamp();
+        std::memcpy(&its_data[0], &its_timestamp, sizeof(its_timestamp));
+        its_payload->set_data(its_data);
+        its_app->send(its_request);
+        its_sent++;
+    };
+
+    its_app->register_availability_handler(BENCHMARK_SERVICE, BENCHMARK_INSTANCE,
+            [&](vsomeip::service_t _service, vsomeip::instance_t _instance,
+                    bool _is_available) {
+                (void)_service;
+                (void)_instance;
+                std::lock_guard<std::mutex> its_lock(its_mutex);
+                is_available = _is_available;
+                its_condition.notify_one();
+            });
+
+    auto on_load = [&](const std::shared_ptr<vsomeip::message> &_message) {
+        const std::uint64_t its_now = get_timestamp();
+        std::uint64_t its_timestamp(its_now);
+        const auto its_message_payload = _message->get_payload();
+        if (its_message_payload->get_length() >= sizeof(its_timestamp)) {
+            std::memcpy(&its_timestamp, its_message_payload->get_data(),
+                    sizeof(its_timestamp));
+        }
+
+        std::lock_guard<std::mutex> its_lock(its_mutex);
+        if (!is_started || is_stopped)
+            return;
+        its_latencies.record(its_now - its_timestamp);
+        its_last_received = its_now;
+        its_received++;
+        if (_topology == topology_e::REQUEST_RESPONSE
+                && its_sent < _options.messages_) {
+            send_request();
+        }
+        its_condition.notify_one();
+    };
+    if (_topology == topology_e::REQUEST_RESPONSE) {
+        its_app->register_message_handler(BENCHMARK_SERVICE, BENCHMARK_INSTANCE,
+                BENCHMARK_METHOD_PING, on_load);
+    } else {
+        its_app->register_message_handler(BENCHMARK_SERVICE, BENCHMARK_INSTANCE,
+                BENCHMARK_EVENT, on_load);
+        its_app->register_subscription_status_handler(BENCHMARK_SERVICE,
+                BENCHMARK_INSTANCE, BENCHMARK_EVENTGROUP, BENCHMARK_EVENT,
+                [&](const vsomeip::service_t _service, const vsomeip::instance_t _instance,
+                        const vsomeip::eventgroup_t _eventgroup,
+                        const vsomeip::event_t _event, const uint16_t _error) {
+                    (void)_service;
+                    (void)_instance;
+                    (void)_eventgroup;
+                    (void)_event;
+                    std::lock_guard<std::mutex> its_lock(its_mutex);
+                    is_subscribed = (_error == 0x0);
+                    its_condition.notify_one();
+                });
+        its_app->request_event(BENCHMARK_SERVICE, BENCHMARK_INSTANCE,
+                BENCHMARK_EVENT, { BENCHMARK_EVENTGROUP },
+                vsomeip::event_type_e::ET_EVENT, get_reliability(_transport));
+        its_app->subscribe(BENCHMARK_SERVICE, BENCHMARK_INSTANCE,
+                BENCHMARK_EVENTGROUP);
+    }
+    its_app->register_message_handler(BENCHMARK_SERVICE, BENCHMARK_INSTANCE,
+            BENCHMARK_METHOD_START,
+            [&](const std::shared_ptr<vsomeip::message> &_response) {
+                (void)_response;
+                std::lock_guard<std::mutex> its_lock(its_mutex);
+                is_started = true;
+                its_condition.notify_one();
+            });
+    its_app->register_message_handler(BENCHMARK_SERVICE, BENCHMARK_INSTANCE,
+            BENCHMARK_METHOD_STOP,
+            [&](const std::shared_ptr<vsomeip::message> &_response) {
+                const auto its_response_payload = _response->get_payload();
+                std::lock_guard<std::mutex> its_lock(its_mutex);
+                if (its_response_payload->get_length() == sizeof(_result.server_)) {
+                    std::memcpy(&_result.server_, its_response_payload->get_data(),
+                            sizeof(_result.server_));
+                    _result.is_valid_ = true;
+                }
+                is_stopped = true;
+                its_condition.notify_one();
+            });
+    its_app->request_service(BENCHMARK_SERVICE, BENCHMARK_INSTANCE);
+
+    auto send_control = [&](vsomeip::method_t _method) {
+        auto its_control = vsomeip::runtime::get()->create_request(use_tcp);
+        its_control->set_service(BENCHMARK_SERVICE);
+        its_control->set_instance(BENCHMARK_INSTANCE);
+        its_control->set_method(_method);
+        its_app->send(its_control);
+    };
+
+    std::thread its_thread([&its_app]() { its_app->start(); });
+    {
+        std::unique_lock<std::mutex> its_lock(its_mutex);
+        bool is_ok = its_condition.wait_for(its_lock, std::chrono::seconds(30),
+                [&]() { return is_available && is_subscribed; });
+        if (is_ok) {
+            send_control(BENCHMARK_METHOD_START);
+            is_ok = its_condition.wait_for(its_lock, std::chrono::seconds(5),
+                    [&is_started]() { return is_started; });
+        }
+        if (is_ok) {
+            const usage its_start = get_usage();
+            const std::uint64_t its_begin = get_timestamp();
+            if (_topology == topology_e::REQUEST_RESPONSE) {
+                for (std::size_t i = 0; i < _options.window_ && its_sent < _options.messages_; i++)
+                    send_request();
+            }
+
+            // Wait until all messages were received or no message was
+            // received for two seconds (lost messages)
+            while (its_received < _options.messages_) {
+                const std::size_t its_last_count(its_received);
+                if (!its_condition.wait_for(its_lock, std::chrono::seconds(2),
+                        [&]() { return its_received != its_last_count; }))
+                    break;
+            }
+            _result.client_ = get_usage_since(its_start);
+            _result.sent_ = (_topology == topology_e::REQUEST_RESPONSE ?
+                    its_sent : _options.messages_);
+            _result.received_ = its_received;
+            _result.duration_ = (its_received ? its_last_received - its_begin : 0);
+
+            send_control(BENCHMARK_METHOD_STOP);
+            its_condition.wait_for(its_lock, std::chrono::seconds(5),
+                    [&is_stopped]() { return is_stopped; });
+        } else {
+            std::cerr << "Service " << to_string(_topology) << "/"
+                    << to_string(_transport) << " could not be started." << std::endl;
+        }
+
+        _result.mean_ = its_latencies.mean();
+        _result.p50_ = its_latencies.value_at_percentile(50.0);
+        _result.p99_ = its_latencies.value_at_percentile(99.0);
+        _result.p999_ = its_latencies.value_at_percentile(99.9);
+        _result.max_ = its_latencies.max();
+    }
+
+    its_app->clear_all_handler();
+    its_app->stop();
+    its_thread.join();
+}
+
+static bool run_case(const options &_options, topology_e _topology,
+        transport_e _transport, const boost::filesystem::path &_folder,
+        result &_result) {
+    const std::string its_server_file((_folder / "server.json").string());
+    const std::string its_client_file((_folder / "client.json").string());
+    write_configuration(its_server_file, BENCHMARK_SERVER, _transport);
+    write_configuration(its_client_file, BENCHMARK_CLIENT, _transport);
+
+    int its_pipe[2];
+    if (pipe(its_pipe) != 0)
+        return false;
+    std::cout.flush();
+
+    pid_t its_server = fork();
+    if (its_server == 0) {
+        close(its_pipe[0]);
+        close(its_pipe[1]);
+        setenv("VSOMEIP_CONFIGURATION", its_server_file.c_str(), 1);
+        run_server(_options, _topology, _transport);
+        std::_Exit(0);
+    }
+    pid_t its_client = fork();
+    if (its_client == 0) {
+        close(its_pipe[0]);
+        setenv("VSOMEIP_CONFIGURATION", its_client_file.c_str(), 1);
+        result its_result;
+        std::memset(&its_result, 0, sizeof(its_result));
+        run_client(_options, _topology, _transport, its_result);
+        const bool is_written(::write(its_pipe[1], &its_result, sizeof(its_result))
+                == sizeof(its_result));
+        std::_Exit(is_written ? 0 : 1);
+    }
+    close(its_pipe[1]);
+
+    const bool is_read(::read(its_pipe[0], &_result, sizeof(_result)) == sizeof(_result));
+    close(its_pipe[0]);
+    waitpid(its_client, nullptr, 0);
+    if (!is_read || !_result.is_valid_)
+        kill(its_server, SIGKILL);
+    waitpid(its_server, nullptr, 0);
+
+    return (is_read && _result.is_valid_);
+}
+
+static double per_message(std::uint64_t _value, const result &_result) {
+    return (_result.received_ ?
+            static_cast<double>(_value) / static_cast<double>(_result.received_) : 0.0);
+}
+
+static double get_throughput(const result &_result) {
+    return (_result.duration_ ?
+            static_cast<double>(_result.received_) * 1e9 / static_cast<double>(_result.duration_)
+            : 0.0);
+}
+
+static void print_header() {
+    std::cout << std::setfill(' ') << std::left << std::setw(12) << "case" << std::right
+              << std::setw(10) << "received"
+              << std::setw(12) << "msg/s"
+              << std::setw(10) << "p50 [us]"
+              << std::setw(10) << "p99 [us]"
+              << std::setw(11) << "p999 [us]"
+              << std::setw(10) << "max [us]"
+              << std::setw(14) << "cpu/msg [us]"
+              << std::setw(14) << "allocs/msg" << std::endl
+              << std::setw(75) << ""
+              << std::setw(14) << "client/server"
+              << std::setw(14) << "client/server" << std::endl;
+}
+
+static void print_result(topology_e _topology, transport_e _transport,
+        const result &_result) {
+    std::stringstream its_case, its_cpu, its_allocations;
+    its_case << to_string(_topology) << "/" << to_string(_transport);
+    its_cpu << std::fixed << std::setprecision(1)
+            << per_message(_result.client_.cpu_, _result) / 1000.0 << "/"
+            << per_message(_result.server_.cpu_, _result) / 1000.0;
+    its_allocations << std::fixed << std::setprecision(1)
+            << per_message(_result.client_.allocations_, _result) << "/"
+            << per_message(_result.server_.allocations_, _result);
+
+    std::cout << std::left << std::setw(12) << its_case.str() << std::right
+              << std::setw(10) << _result.received_
+              << std::fixed << std::setprecision(0)
+              << std::setw(12) << get_throughput(_result)
+              << std::setprecision(1)
+              << std::setw(10) << static_cast<double>(_result.p50_) / 1000.0
+              << std::setw(10) << static_cast<double>(_result.p99_) / 1000.0
+              << std::setw(11) << static_cast<double>(_result.p999_) / 1000.0
+              << std::setw(10) << static_cast<double>(_result.max_) / 1000.0
+              << std::setw(14) << its_cpu.str()
+              << std::setw(14) << its_allocations.str() << std::endl;
+}
+
+static void write_json(const options &_options,
+        const std::vector<case_result> &_results) {
+    std::ofstream its_out(_options.json_);
+    its_out << std::fixed << std::setprecision(3)
+            << "{\n"
+            << "    \"benchmark\" : \"load_benchmark\",\n"
+            << "    \"messages\" : " << _options.messages_ << ",\n"
+            << "    \"payload\" : " << _options.payload_ << ",\n"
+            << "    \"window\" : " << _options.window_ << ",\n"
+            << "    \"rate\" : " << _options.rate_ << ",\n"
+            << "    \"results\" :\n"
+            << "    [";
+    for (std::size_t i = 0; i < _results.size(); i++) {
+        const result &r = _results[i].result_;
+        its_out << (i ? ",\n" : "\n")
+                << "        {\n"
+                << "            \"topology\" : \"" << to_string(_results[i].topology_) << "\",\n"
+                << "            \"transport\" : \"" << to_string(_results[i].transport_) << "\",\n"
+                << "            \"sent\" : " << r.sent_ << ",\n"
+                << "            \"received\" : " << r.received_ << ",\n"
+                << "            \"duration_ms\" : " << static_cast<double>(r.duration_) / 1e6 << ",\n"
+                << "            \"throughput\" : " << get_throughput(r) << ",\n"
+                << "            \"latency_us\" : { \"mean\" : " << r.mean_ / 1000.0
+                << ", \"p50\" : " << static_cast<double>(r.p50_) / 1000.0
+                << ", \"p99\" : " << static_cast<double>(r.p99_) / 1000.0
+                << ", \"p999\" : " << static_cast<double>(r.p999_) / 1000.0
+                << ", \"max\" : " << static_cast<double>(r.max_) / 1000.0 << " },\n"
+                << "            \"cpu_per_message_us\" : { \"client\" : "
+                << per_message(r.client_.cpu_, r) / 1000.0
+                << ", \"server\" : " << per_message(r.server_.cpu_, r) / 1000.0 << " },\n"
+                << "            \"allocations_per_message\" : { \"client\" : "
+                << per_message(r.client_.allocations_, r)
+                << ", \"server\" : " << per_message(r.server_.allocations_, r) << " }\n"
+                << "        }";
+    }
+    its_out << "\n    ]\n"
+            << "}\n";
+}
+
+static void print_usage(const char *_name) {
+    std::cerr << "Usage: " << _name << " [options]\n"
+              << "  --topology reqresp|pubsub|all  (default: all)\n"
+              << "  --transport uds|udp|tcp|all    (default: all)\n"
+              << "  --messages <n>                 (default: 20000)\n"
+              << "  --payload <bytes>              (default: 64, at least 8)\n"
+              << "  --window <n>                   outstanding requests (default: 1)\n"
+              << "  --rate <n>                     events per second, 0 = unlimited"
+              << " (default: 10000)\n"
+              << "  --json <file>                  write the results to <file>\n";
+}
+
+static bool parse_options(int argc, char **argv, options &_options) {
+    std::string its_topology("all"), its_transport("all");
+    _options.messages_ = 20000;
+    _options.payload_ = 64;
+    _options.window_ = 1;
+    _options.rate_ = 10000;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string its_option(argv[i]);
+        if (i + 1 >= argc)
+            return false;
+        const std::string its_value(argv[++i]);
+        if (its_option == "--topology") {
+            its_topology = its_value;
+        } else if (its_option == "--transport") {
+            its_transport = its_value;
+        } else if (its_option == "--messages") {
+            _options.messages_ = std::strtoul(its_value.c_str(), nullptr, 10);
+        } else if (its_option == "--payload") {
+            _options.payload_ = std::strtoul(its_value.c_str(), nullptr, 10);
+        } else if (its_option == "--window") {
+            _options.window_ = std::strtoul(its_value.c_str(), nullptr, 10);
+        } else if (its_option == "--rate") {
+            _options.rate_ = std::strtoul(its_value.c_str(), nullptr, 10);
+        } else if (its_option == "--json") {
+            _options.json_ = its_value;
+        } else {
+            return false;
+        }
+    }
+
+    if (its_topology == "reqresp" || its_topology == "all")
+        _options.topologies_.push_back(topology_e::REQUEST_RESPONSE);
+    if (its_topology == "pubsub" || its_topology == "all")
+        _options.topologies_.push_back(topology_e::PUBLISH_SUBSCRIBE);
+    if (its_transport == "uds" || its_transport == "all")
+        _options.transports_.push_back(transport_e::UDS);
+    if (its_transport == "udp" || its_transport == "all")
+        _options.transports_.push_back(transport_e::UDP);
+    if (its_transport == "tcp" || its_transport == "all")
+        _options.transports_.push_back(transport_e::TCP);
+
+    if (_options.payload_ < sizeof(std::uint64_t))
+        _options.payload_ = sizeof(std::uint64_t);
+    if (_options.messages_ == 0)
+        _options.messages_ = 1;
+    if (_options.window_ == 0)
+        _options.window_ = 1;
+
+    return (!_options.topologies_.empty() && !_options.transports_.empty());
+}
+
+int main(int argc, char **argv) {
+    options its_options;
+    if (!parse_options(argc, argv, its_options)) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    const boost::filesystem::path its_folder
+        = boost::filesystem::temp_directory_path() / "vsomeip-load-benchmark";
+    boost::filesystem::create_directories(its_folder);
+
+    print_header();
+    bool is_ok(true);
+    std::vector<case_result> its_results;
+    for (auto its_topology : its_options.topologies_) {
+        for (auto its_transport : its_options.transports_) {
+            result its_result;
+            std::memset(&its_result, 0, sizeof(its_result));
+            if (run_case(its_options, its_topology, its_transport,
+                    its_folder, its_result)) {
+                print_result(its_topology, its_transport, its_result);
+                its_results.push_back({ its_topology, its_transport, its_result });
+            } else {
+                std::cerr << to_string(its_topology) << "/"
+                        << to_string(its_transport) << " failed." << std::endl;
+                is_ok = false;
+            }
+        }
+    }
+
+    if (!its_options.json_.empty())
+        write_json(its_options, its_results);
+
+    boost::filesystem::remove_all(its_folder);
+    return (is_ok ? 0 : 1);
+}
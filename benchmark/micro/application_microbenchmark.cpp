@@ -0,0 +1,133 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Micro benchmarks of the message handler lookup of the application.
+// The application is configured to invoke its message handlers inline,
+// therefore the measured time does not include the dispatching.
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <unistd.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vsomeip/vsomeip.hpp>
+
+#include "../../implementation/runtime/include/application_impl.hpp"
+
+namespace vsomeip = vsomeip_v3;
+
+static const char *BENCHMARK_APPLICATION = "application_microbenchmark";
+static const vsomeip::service_t BENCHMARK_SERVICE = 0x1234;
+static const vsomeip::instance_t BENCHMARK_INSTANCE = 0x0001;
+static const vsomeip::method_t BENCHMARK_FIRST_METHOD = 0x0001;
+
+static std::shared_ptr<vsomeip::application_impl> benchmark_application;
+
+static void application_on_message(benchmark::State &_state) {
+    const vsomeip::method_t its_methods(static_cast<vsomeip::method_t>(_state.range(0)));
+
+    std::size_t its_calls(0);
+    for (vsomeip::method_t i = 0; i < its_methods; i++) {
+        benchmark_application->register_message_handler(BENCHMARK_SERVICE,
+                BENCHMARK_INSTANCE, static_cast<vsomeip::method_t>(BENCHMARK_FIRST_METHOD + i),
+                [&its_calls](const std::shared_ptr<vsomeip::message> &) {
+                    its_calls++;
+                });
+    }
+
+    std::shared_ptr<vsomeip::message> its_message
+        = vsomeip::runtime::get()->create_request();
+    its_message->set_service(BENCHMARK_SERVICE);
+    its_message->set_instance(BENCHMARK_INSTANCE);
+    its_message->set_method(static_cast<vsomeip::method_t>(
+            BENCHMARK_FIRST_METHOD + its_methods - 1));
+
+    for (auto _ : _state) {
+        std::shared_ptr<vsomeip::message> its_copy(its_message);
+        benchmark_application->on_message(std::move(its_copy));
+    }
+
+    for (vsomeip::method_t i = 0; i < its_methods; i++) {
+        benchmark_application->unregister_message_handler(BENCHMARK_SERVICE,
+                BENCHMARK_INSTANCE, static_cast<vsomeip::method_t>(BENCHMARK_FIRST_METHOD + i));
+    }
+
+    if (its_calls != static_cast<std::size_t>(_state.iterations()))
+        _state.SkipWithError("Message handlers were not invoked inline.");
+    _state.SetItemsProcessed(static_cast<int64_t>(_state.iterations()));
+}
+BENCHMARK(application_on_message)->Arg(1)->Arg(64)->Arg(1024);
+
+static std::string write_configuration() {
+    const std::string its_path("/tmp/application_microbenchmark_"
+            + std::to_string(::getpid()) + ".json");
+    std::ofstream its_file(its_path);
+    its_file << "{\n"
+        << "    \"logging\" : { \"level\" : \"warning\", \"console\" : \"true\" },\n"
+        << "    \"applications\" : [\n"
+        << "        { \"name\" : \"" << BENCHMARK_APPLICATION << "\",\n"
+        << "          \"id\" : \"0x1300\",\n"
+        << "          \"inline_handlers\" : \"true\" }\n"
+        << "    ],\n"
+        << "    \"routing\" : \"" << BENCHMARK_APPLICATION << "\",\n"
+        << "    \"service-discovery\" : { \"enable\" : \"false\" }\n"
+        << "}\n";
+    return its_path;
+}
+
+int main(int argc, char **argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+
+    const std::string its_configuration(write_configuration());
+    ::setenv("VSOMEIP_CONFIGURATION", its_configuration.c_str(), 1);
+
+    benchmark_application = std::static_pointer_cast<vsomeip::application_impl>(
+            vsomeip::runtime::get()->create_application(BENCHMARK_APPLICATION));
+    if (!benchmark_application->init()) {
+        std::cerr << "Couldn't initialize application" << std::endl;
+        std::remove(its_configuration.c_str());
+        return 1;
+    }
+
+    std::mutex its_mutex;
+    std::condition_variable its_condition;
+    bool is_registered(false);
+    benchmark_application->register_state_handler(
+            [&](vsomeip::state_type_e _state) {
+                std::lock_guard<std::mutex> its_lock(its_mutex);
+                is_registered = (_state == vsomeip::state_type_e::ST_REGISTERED);
+                its_condition.notify_one();
+            });
+
+    std::thread its_thread([] { benchmark_application->start(); });
+    {
+        std::unique_lock<std::mutex> its_lock(its_mutex);
+        its_condition.wait(its_lock, [&is_registered] { return is_registered; });
+    }
+    // Let the dispatcher become idle as inline handlers are only called then
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    benchmark::RunSpecifiedBenchmarks();
+
+    benchmark_application->clear_all_handler();
+    benchmark_application->stop();
+    its_thread.join();
+    benchmark_application.reset();
+    std::remove(its_configuration.c_str());
+    return 0;
+}
@@ -0,0 +1,52 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Micro benchmarks of the CRC calculations of the E2E profiles.
+
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "../../implementation/e2e_protection/include/crc/crc.hpp"
+
+namespace vsomeip = vsomeip_v3;
+
+static std::vector<std::uint8_t> create_data(const benchmark::State &_state) {
+    std::vector<std::uint8_t> its_data(static_cast<std::size_t>(_state.range(0)));
+    for (std::size_t i = 0; i < its_data.size(); i++)
+        its_data[i] = static_cast<std::uint8_t>(i * 31);
+    return its_data;
+}
+
+static void e2e_crc_profile_01(benchmark::State &_state) {
+    const std::vector<std::uint8_t> its_data(create_data(_state));
+    for (auto _ : _state) {
+        benchmark::DoNotOptimize(vsomeip::e2e_crc::calculate_profile_01(
+                vsomeip::buffer_view(its_data.data(), its_data.size())));
+    }
+    _state.SetBytesProcessed(static_cast<int64_t>(_state.iterations() * its_data.size()));
+}
+BENCHMARK(e2e_crc_profile_01)->Arg(16)->Arg(256)->Arg(4096);
+
+static void e2e_crc_profile_04(benchmark::State &_state) {
+    const std::vector<std::uint8_t> its_data(create_data(_state));
+    for (auto _ : _state) {
+        benchmark::DoNotOptimize(vsomeip::e2e_crc::calculate_profile_04(
+                vsomeip::buffer_view(its_data.data(), its_data.size())));
+    }
+    _state.SetBytesProcessed(static_cast<int64_t>(_state.iterations() * its_data.size()));
+}
+BENCHMARK(e2e_crc_profile_04)->Arg(16)->Arg(256)->Arg(4096);
+
+static void e2e_crc_profile_custom(benchmark::State &_state) {
+    const std::vector<std::uint8_t> its_data(create_data(_state));
+    for (auto _ : _state) {
+        benchmark::DoNotOptimize(vsomeip::e2e_crc::calculate_profile_custom(
+                vsomeip::buffer_view(its_data.data(), its_data.size())));
+    }
+    _state.SetBytesProcessed(static_cast<int64_t>(_state.iterations() * its_data.size()));
+}
+BENCHMARK(e2e_crc_profile_custom)->Arg(16)->Arg(256)->Arg(4096);
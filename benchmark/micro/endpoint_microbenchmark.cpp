@@ -0,0 +1,202 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Micro benchmarks of the train logic (message batching) of the server
+// endpoints. The endpoint writes to a fake socket, therefore the measured
+// time does not include any system calls.
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/tcp.hpp>
+
+#include <vsomeip/defines.hpp>
+
+#include "../../implementation/endpoints/include/server_endpoint_impl.hpp"
+#include "../../implementation/utility/include/byteorder.hpp"
+
+namespace vsomeip = vsomeip_v3;
+
+static const std::uint32_t BENCHMARK_MAX_MESSAGE_SIZE = 1416;
+static const std::uint16_t BENCHMARK_PORT = 30509;
+static const vsomeip::service_t BENCHMARK_SERVICE = 0x1234;
+static const vsomeip::method_t BENCHMARK_FIRST_EVENT = 0x8001;
+static const std::size_t BENCHMARK_PAYLOAD_SIZE = 16;
+
+// Server endpoint that sends the notifications to a fixed default target and
+// completes each write immediately.
+class fake_server_endpoint
+        : public vsomeip::server_endpoint_impl<boost::asio::ip::tcp> {
+public:
+    fake_server_endpoint(boost::asio::io_service &_io,
+            std::chrono::nanoseconds _retention)
+        : server_endpoint_impl(nullptr, nullptr,
+                endpoint_type(boost::asio::ip::address_v4::loopback(), BENCHMARK_PORT),
+                _io, BENCHMARK_MAX_MESSAGE_SIZE, vsomeip::QUEUE_SIZE_UNLIMITED, nullptr),
+          target_(boost::asio::ip::address_v4::loopback(), BENCHMARK_PORT + 1),
+          retention_(_retention),
+          sent_(0),
+          sent_bytes_(0) {
+    }
+
+    std::size_t get_sent() const { return sent_; }
+    std::size_t get_sent_bytes() const { return sent_bytes_; }
+
+    void cancel() {
+        std::lock_guard<std::mutex> its_lock(mutex_);
+        boost::system::error_code ec;
+        departure_timer_.cancel(ec);
+    }
+
+    void start() {}
+    void stop() {}
+    void receive() {}
+    void restart(bool _force) { (void)_force; }
+    void print_status() {}
+
+    bool send_to(const std::shared_ptr<vsomeip::endpoint_definition> _target,
+            const vsomeip::byte_t *_data, uint32_t _size) {
+        (void)_target; (void)_data; (void)_size;
+        return false;
+    }
+    bool send_error(const std::shared_ptr<vsomeip::endpoint_definition> _target,
+            const vsomeip::byte_t *_data, uint32_t _size) {
+        (void)_target; (void)_data; (void)_size;
+        return false;
+    }
+
+    void add_default_target(vsomeip::service_t _service,
+            const std::string &_address, uint16_t _port) {
+        (void)_service; (void)_address; (void)_port;
+    }
+    void remove_default_target(vsomeip::service_t _service) { (void)_service; }
+
+    std::uint16_t get_local_port() const { return BENCHMARK_PORT; }
+    bool is_reliable() const { return true; }
+    bool is_local() const { return false; }
+
+protected:
+    // Called with mutex_ being locked
+    void send_queued(const queue_iterator_type _queue_iterator) {
+        for (const auto &b : _queue_iterator->second.second) {
+            sent_++;
+            sent_bytes_ += b->size();
+        }
+        _queue_iterator->second.second.clear();
+        _queue_iterator->second.first = 0;
+    }
+
+    void get_configured_times_from_endpoint(
+            vsomeip::service_t _service, vsomeip::method_t _method,
+            std::chrono::nanoseconds *_debouncing,
+            std::chrono::nanoseconds *_maximum_retention) const {
+        (void)_service; (void)_method;
+        *_debouncing = std::chrono::nanoseconds::zero();
+        *_maximum_retention = retention_;
+    }
+
+    bool get_default_target(vsomeip::service_t _service,
+            endpoint_type &_target) const {
+        (void)_service;
+        _target = target_;
+        return true;
+    }
+
+private:
+    std::string get_remote_information(
+            const queue_iterator_type _queue_iterator) const {
+        (void)_queue_iterator;
+        return "fake";
+    }
+    std::string get_remote_information(const endpoint_type &_remote) const {
+        (void)_remote;
+        return "fake";
+    }
+    bool tp_segmentation_enabled(vsomeip::service_t _service,
+            vsomeip::method_t _method) const {
+        (void)_service; (void)_method;
+        return false;
+    }
+
+    const endpoint_type target_;
+    const std::chrono::nanoseconds retention_;
+    std::size_t sent_;
+    std::size_t sent_bytes_;
+};
+
+// Creates serialized notifications of the given number of different events.
+static std::vector<std::vector<vsomeip::byte_t> > create_notifications(std::size_t _events) {
+    std::vector<std::vector<vsomeip::byte_t> > its_notifications;
+    for (std::size_t i = 0; i < _events; i++) {
+        const vsomeip::method_t its_event
+            = static_cast<vsomeip::method_t>(BENCHMARK_FIRST_EVENT + i);
+        std::vector<vsomeip::byte_t> its_data(
+                VSOMEIP_FULL_HEADER_SIZE + BENCHMARK_PAYLOAD_SIZE, 0x5A);
+        const vsomeip::length_t its_length = static_cast<vsomeip::length_t>(
+                its_data.size() - VSOMEIP_SOMEIP_HEADER_SIZE);
+        its_data[VSOMEIP_SERVICE_POS_MIN] = VSOMEIP_WORD_BYTE1(BENCHMARK_SERVICE);
+        its_data[VSOMEIP_SERVICE_POS_MAX] = VSOMEIP_WORD_BYTE0(BENCHMARK_SERVICE);
+        its_data[VSOMEIP_METHOD_POS_MIN] = VSOMEIP_WORD_BYTE1(its_event);
+        its_data[VSOMEIP_METHOD_POS_MAX] = VSOMEIP_WORD_BYTE0(its_event);
+        its_data[VSOMEIP_LENGTH_POS_MIN] = VSOMEIP_LONG_BYTE3(its_length);
+        its_data[VSOMEIP_LENGTH_POS_MIN + 1] = VSOMEIP_LONG_BYTE2(its_length);
+        its_data[VSOMEIP_LENGTH_POS_MIN + 2] = VSOMEIP_LONG_BYTE1(its_length);
+        its_data[VSOMEIP_LENGTH_POS_MAX] = VSOMEIP_LONG_BYTE0(its_length);
+        its_data[VSOMEIP_CLIENT_POS_MIN] = 0x00;
+        its_data[VSOMEIP_CLIENT_POS_MAX] = 0x00;
+        its_notifications.push_back(its_data);
+    }
+    return its_notifications;
+}
+
+// Sends the notifications round robin. The io_service is polled after each
+// message as the io thread would run the departure timer.
+static void send_notifications(benchmark::State &_state, std::chrono::nanoseconds _retention) {
+    const auto its_notifications(
+            create_notifications(static_cast<std::size_t>(_state.range(0))));
+
+    boost::asio::io_service its_io;
+    auto its_endpoint = std::make_shared<fake_server_endpoint>(its_io, _retention);
+
+    std::size_t its_index(0);
+    for (auto _ : _state) {
+        const auto &its_data = its_notifications[its_index];
+        if (!its_endpoint->send(&its_data[0], static_cast<uint32_t>(its_data.size()))) {
+            _state.SkipWithError("Message could not be sent.");
+            break;
+        }
+        its_io.poll();
+        if (++its_index == its_notifications.size())
+            its_index = 0;
+    }
+
+    its_endpoint->cancel();
+    its_io.poll();
+
+    _state.SetItemsProcessed(static_cast<int64_t>(_state.iterations()));
+    _state.counters["trains"] = static_cast<double>(its_endpoint->get_sent());
+    _state.counters["bytes_per_train"] = its_endpoint->get_sent()
+            ? static_cast<double>(its_endpoint->get_sent_bytes()) / static_cast<double>(its_endpoint->get_sent())
+            : 0.0;
+}
+
+// Without retention, each train departs when the io thread runs
+static void endpoint_send_no_retention(benchmark::State &_state) {
+    send_notifications(_state, std::chrono::nanoseconds::zero());
+}
+BENCHMARK(endpoint_send_no_retention)->Arg(1)->Arg(16);
+
+// With retention, trains depart once they are full or when an event is
+// sent a second time
+static void endpoint_send_retention(benchmark::State &_state) {
+    send_notifications(_state, std::chrono::milliseconds(100));
+}
+BENCHMARK(endpoint_send_retention)->Arg(1)->Arg(16)->Arg(64);
@@ -0,0 +1,132 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Micro benchmarks of the serializer, the deserializer and the
+// (de)serialization of SOME/IP messages.
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <vsomeip/runtime.hpp>
+
+#include "../../implementation/message/include/deserializer.hpp"
+#include "../../implementation/message/include/message_header_view.hpp"
+#include "../../implementation/message/include/message_impl.hpp"
+#include "../../implementation/message/include/serializer.hpp"
+
+namespace vsomeip = vsomeip_v3;
+
+static const std::uint32_t BENCHMARK_SHRINK_THRESHOLD = 0;
+static const std::size_t BENCHMARK_VALUES = 64;
+
+static std::vector<vsomeip::byte_t> serialize_message(std::size_t _payload_size) {
+    vsomeip::message_impl its_message;
+    its_message.set_service(0x1234);
+    its_message.set_instance(0x0001);
+    its_message.set_method(0x0421);
+    its_message.set_client(0x1343);
+    its_message.set_session(0x0001);
+    its_message.set_payload(vsomeip::runtime::get()->create_payload(
+            std::vector<vsomeip::byte_t>(_payload_size, 0x5A)));
+
+    vsomeip::serializer its_serializer(BENCHMARK_SHRINK_THRESHOLD);
+    its_message.serialize(&its_serializer);
+    return std::vector<vsomeip::byte_t>(its_serializer.get_data(),
+            its_serializer.get_data() + its_serializer.get_size());
+}
+
+static void serializer_uint32(benchmark::State &_state) {
+    vsomeip::serializer its_serializer(BENCHMARK_SHRINK_THRESHOLD);
+    for (auto _ : _state) {
+        for (std::uint32_t i = 0; i < BENCHMARK_VALUES; i++)
+            its_serializer.serialize(i);
+        benchmark::DoNotOptimize(its_serializer.get_data());
+        its_serializer.reset();
+    }
+    _state.SetItemsProcessed(static_cast<int64_t>(_state.iterations() * BENCHMARK_VALUES));
+}
+BENCHMARK(serializer_uint32);
+
+static void serializer_bytes(benchmark::State &_state) {
+    const std::vector<vsomeip::byte_t> its_data(static_cast<std::size_t>(_state.range(0)), 0x5A);
+    vsomeip::serializer its_serializer(BENCHMARK_SHRINK_THRESHOLD);
+    for (auto _ : _state) {
+        its_serializer.serialize(its_data);
+        benchmark::DoNotOptimize(its_serializer.get_data());
+        its_serializer.reset();
+    }
+    _state.SetBytesProcessed(static_cast<int64_t>(_state.iterations() * its_data.size()));
+}
+BENCHMARK(serializer_bytes)->Arg(64)->Arg(1024)->Arg(16384);
+
+static void deserializer_uint32(benchmark::State &_state) {
+    vsomeip::serializer its_serializer(BENCHMARK_SHRINK_THRESHOLD);
+    for (std::uint32_t i = 0; i < BENCHMARK_VALUES; i++)
+        its_serializer.serialize(i);
+
+    vsomeip::deserializer its_deserializer(BENCHMARK_SHRINK_THRESHOLD);
+    for (auto _ : _state) {
+        its_deserializer.set_data(its_serializer.get_data(), its_serializer.get_size());
+        std::uint32_t its_value(0);
+        for (std::size_t i = 0; i < BENCHMARK_VALUES; i++)
+            its_deserializer.deserialize(its_value);
+        benchmark::DoNotOptimize(its_value);
+    }
+    _state.SetItemsProcessed(static_cast<int64_t>(_state.iterations() * BENCHMARK_VALUES));
+}
+BENCHMARK(deserializer_uint32);
+
+static void message_serialize(benchmark::State &_state) {
+    vsomeip::message_impl its_message;
+    its_message.set_service(0x1234);
+    its_message.set_instance(0x0001);
+    its_message.set_method(0x0421);
+    its_message.set_payload(vsomeip::runtime::get()->create_payload(
+            std::vector<vsomeip::byte_t>(static_cast<std::size_t>(_state.range(0)), 0x5A)));
+
+    vsomeip::serializer its_serializer(BENCHMARK_SHRINK_THRESHOLD);
+    for (auto _ : _state) {
+        its_message.serialize(&its_serializer);
+        benchmark::DoNotOptimize(its_serializer.get_data());
+        its_serializer.reset();
+    }
+    _state.SetBytesProcessed(static_cast<int64_t>(_state.iterations() * _state.range(0)));
+}
+BENCHMARK(message_serialize)->Arg(16)->Arg(1024)->Arg(16384);
+
+// Deserialization as done by the client endpoints (copying deserializer)
+static void message_deserialize(benchmark::State &_state) {
+    const std::vector<vsomeip::byte_t> its_data(
+            serialize_message(static_cast<std::size_t>(_state.range(0))));
+
+    vsomeip::deserializer its_deserializer(BENCHMARK_SHRINK_THRESHOLD);
+    for (auto _ : _state) {
+        its_deserializer.set_data(&its_data[0], its_data.size());
+        std::unique_ptr<vsomeip::message_impl> its_message(
+                its_deserializer.deserialize_message());
+        benchmark::DoNotOptimize(its_message.get());
+        its_deserializer.reset();
+    }
+    _state.SetBytesProcessed(static_cast<int64_t>(_state.iterations() * its_data.size()));
+}
+BENCHMARK(message_deserialize)->Arg(16)->Arg(1024)->Arg(16384);
+
+// Deserialization as done by the routing manager (header view)
+static void message_deserialize_view(benchmark::State &_state) {
+    const std::vector<vsomeip::byte_t> its_data(
+            serialize_message(static_cast<std::size_t>(_state.range(0))));
+
+    for (auto _ : _state) {
+        vsomeip::message_impl its_message;
+        its_message.deserialize(vsomeip::message_header_view(&its_data[0],
+                static_cast<vsomeip::length_t>(its_data.size())));
+        benchmark::DoNotOptimize(its_message.get_payload());
+    }
+    _state.SetBytesProcessed(static_cast<int64_t>(_state.iterations() * its_data.size()));
+}
+BENCHMARK(message_deserialize_view)->Arg(16)->Arg(1024)->Arg(16384);
@@ -0,0 +1,94 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Micro benchmarks of the creation and the (de)serialization of service
+// discovery messages containing offer entries.
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/asio/ip/address.hpp>
+
+#include "../../implementation/message/include/deserializer.hpp"
+#include "../../implementation/message/include/serializer.hpp"
+#include "../../implementation/service_discovery/include/enumeration_types.hpp"
+#include "../../implementation/service_discovery/include/ipv4_option_impl.hpp"
+#include "../../implementation/service_discovery/include/message_impl.hpp"
+#include "../../implementation/service_discovery/include/serviceentry_impl.hpp"
+
+namespace vsomeip = vsomeip_v3;
+
+static const std::uint32_t BENCHMARK_SHRINK_THRESHOLD = 0;
+static const vsomeip::service_t BENCHMARK_FIRST_SERVICE = 0x1000;
+static const vsomeip::instance_t BENCHMARK_INSTANCE = 0x0001;
+static const std::uint16_t BENCHMARK_FIRST_PORT = 30500;
+
+// Creates a message offering the given number of services, each reachable
+// by its own port.
+static std::shared_ptr<vsomeip::sd::message_impl> create_offer(std::size_t _entries) {
+    const boost::asio::ip::address its_address(
+            boost::asio::ip::address::from_string("127.0.0.1"));
+
+    auto its_message = std::make_shared<vsomeip::sd::message_impl>();
+    for (std::size_t i = 0; i < _entries; i++) {
+        auto its_entry = std::make_shared<vsomeip::sd::serviceentry_impl>();
+        its_entry->set_type(vsomeip::sd::entry_type_e::OFFER_SERVICE);
+        its_entry->set_service(static_cast<vsomeip::service_t>(BENCHMARK_FIRST_SERVICE + i));
+        its_entry->set_instance(BENCHMARK_INSTANCE);
+        its_entry->set_major_version(0x01);
+        its_entry->set_minor_version(0x00000000);
+        its_entry->set_ttl(0x000003);
+
+        auto its_option = std::make_shared<vsomeip::sd::ipv4_option_impl>(its_address,
+                static_cast<std::uint16_t>(BENCHMARK_FIRST_PORT + i), false);
+        its_message->add_entry_data(its_entry, { its_option });
+    }
+    return its_message;
+}
+
+static void sd_message_create(benchmark::State &_state) {
+    const std::size_t its_entries(static_cast<std::size_t>(_state.range(0)));
+    for (auto _ : _state) {
+        auto its_message = create_offer(its_entries);
+        benchmark::DoNotOptimize(its_message.get());
+    }
+    _state.SetItemsProcessed(static_cast<int64_t>(_state.iterations() * its_entries));
+}
+BENCHMARK(sd_message_create)->Arg(1)->Arg(16)->Arg(64);
+
+static void sd_message_serialize(benchmark::State &_state) {
+    auto its_message = create_offer(static_cast<std::size_t>(_state.range(0)));
+
+    vsomeip::serializer its_serializer(BENCHMARK_SHRINK_THRESHOLD);
+    for (auto _ : _state) {
+        its_message->serialize(&its_serializer);
+        benchmark::DoNotOptimize(its_serializer.get_data());
+        its_serializer.reset();
+    }
+    _state.SetItemsProcessed(static_cast<int64_t>(_state.iterations() * _state.range(0)));
+}
+BENCHMARK(sd_message_serialize)->Arg(1)->Arg(16)->Arg(64);
+
+static void sd_message_deserialize(benchmark::State &_state) {
+    vsomeip::serializer its_serializer(BENCHMARK_SHRINK_THRESHOLD);
+    create_offer(static_cast<std::size_t>(_state.range(0)))->serialize(&its_serializer);
+
+    vsomeip::deserializer its_deserializer(BENCHMARK_SHRINK_THRESHOLD);
+    for (auto _ : _state) {
+        its_deserializer.set_data(its_serializer.get_data(), its_serializer.get_size());
+        vsomeip::sd::message_impl its_message;
+        if (!its_message.deserialize(&its_deserializer)) {
+            _state.SkipWithError("Message could not be deserialized.");
+            break;
+        }
+        benchmark::DoNotOptimize(its_message.get_entries().size());
+        its_deserializer.reset();
+    }
+    _state.SetItemsProcessed(static_cast<int64_t>(_state.iterations() * _state.range(0)));
+}
+BENCHMARK(sd_message_deserialize)->Arg(1)->Arg(16)->Arg(64);
@@ -0,0 +1,79 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Micro benchmarks of the policy lookup of the security implementation.
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include "../../implementation/configuration/include/configuration_element.hpp"
+#include "../../implementation/security/include/security_impl.hpp"
+
+namespace vsomeip = vsomeip_v3;
+
+static const std::uint32_t BENCHMARK_FIRST_ID = 1000;
+static const vsomeip::service_t BENCHMARK_FIRST_SERVICE = 0x1000;
+static const vsomeip::instance_t BENCHMARK_INSTANCE = 0x0001;
+static const vsomeip::method_t BENCHMARK_METHOD = 0x0421;
+static const vsomeip::client_t BENCHMARK_CLIENT = 0x1343;
+
+static std::string to_hex(std::uint32_t _value) {
+    std::stringstream its_value;
+    its_value << "0x" << std::hex << _value;
+    return its_value.str();
+}
+
+// Creates a security configuration containing one policy per uid/gid,
+// each allowing to request one service.
+static void load_policies(vsomeip::security_impl &_security, std::uint32_t _policies) {
+    boost::property_tree::ptree its_policies;
+    for (std::uint32_t i = 0; i < _policies; i++) {
+        boost::property_tree::ptree its_request;
+        its_request.put("service", to_hex(BENCHMARK_FIRST_SERVICE + i));
+        its_request.put("instance", to_hex(BENCHMARK_INSTANCE));
+
+        boost::property_tree::ptree its_requests;
+        its_requests.push_back(std::make_pair("", its_request));
+
+        boost::property_tree::ptree its_policy;
+        its_policy.put("credentials.uid", std::to_string(BENCHMARK_FIRST_ID + i));
+        its_policy.put("credentials.gid", std::to_string(BENCHMARK_FIRST_ID + i));
+        its_policy.add_child("allow.requests", its_requests);
+
+        its_policies.push_back(std::make_pair("", its_policy));
+    }
+
+    vsomeip::configuration_element its_element;
+    its_element.name_ = "security";
+    its_element.tree_.put("security.check_credentials", "true");
+    its_element.tree_.add_child("security.policies", its_policies);
+    _security.load(its_element);
+}
+
+static void security_is_client_allowed(benchmark::State &_state) {
+    const std::uint32_t its_policies(static_cast<std::uint32_t>(_state.range(0)));
+    vsomeip::security_impl its_security;
+    load_policies(its_security, its_policies);
+
+    // Use the credentials of the last policy as the policies are searched linearly
+    const std::uint32_t its_id(BENCHMARK_FIRST_ID + its_policies - 1);
+    const vsomeip::service_t its_service(
+            static_cast<vsomeip::service_t>(BENCHMARK_FIRST_SERVICE + its_policies - 1));
+    for (auto _ : _state) {
+        const bool is_allowed = its_security.is_client_allowed(its_id, its_id,
+                BENCHMARK_CLIENT, its_service, BENCHMARK_INSTANCE, BENCHMARK_METHOD);
+        if (!is_allowed) {
+            _state.SkipWithError("Client was not allowed.");
+            break;
+        }
+    }
+    _state.SetItemsProcessed(static_cast<int64_t>(_state.iterations()));
+}
+BENCHMARK(security_is_client_allowed)->Arg(1)->Arg(16)->Arg(256);
@@ -0,0 +1,86 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Micro benchmarks of the segmentation and the reassembly of SOME/IP-TP
+// messages.
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/address.hpp>
+
+#include <vsomeip/runtime.hpp>
+
+#include "../../implementation/endpoints/include/tp.hpp"
+#include "../../implementation/endpoints/include/tp_reassembler.hpp"
+#include "../../implementation/message/include/message_impl.hpp"
+#include "../../implementation/message/include/serializer.hpp"
+
+namespace vsomeip = vsomeip_v3;
+
+static const std::uint16_t BENCHMARK_PORT = 30509;
+
+static std::vector<vsomeip::byte_t> serialize_message(std::size_t _payload_size) {
+    vsomeip::message_impl its_message;
+    its_message.set_service(0x1234);
+    its_message.set_instance(0x0001);
+    its_message.set_method(0x0421);
+    its_message.set_client(0x1343);
+    its_message.set_session(0x0001);
+    its_message.set_payload(vsomeip::runtime::get()->create_payload(
+            std::vector<vsomeip::byte_t>(_payload_size, 0x5A)));
+
+    vsomeip::serializer its_serializer(0);
+    its_message.serialize(&its_serializer);
+    return std::vector<vsomeip::byte_t>(its_serializer.get_data(),
+            its_serializer.get_data() + its_serializer.get_size());
+}
+
+static void tp_split_message(benchmark::State &_state) {
+    const std::vector<vsomeip::byte_t> its_data(
+            serialize_message(static_cast<std::size_t>(_state.range(0))));
+
+    for (auto _ : _state) {
+        vsomeip::tp::tp_split_messages_t its_segments
+            = vsomeip::tp::tp::tp_split_message(&its_data[0],
+                    static_cast<std::uint32_t>(its_data.size()));
+        benchmark::DoNotOptimize(its_segments.data());
+    }
+    _state.SetBytesProcessed(static_cast<int64_t>(_state.iterations() * its_data.size()));
+}
+BENCHMARK(tp_split_message)->Arg(4096)->Arg(65536)->Arg(262144);
+
+static void tp_process_tp_message(benchmark::State &_state) {
+    const std::vector<vsomeip::byte_t> its_data(
+            serialize_message(static_cast<std::size_t>(_state.range(0))));
+    const vsomeip::tp::tp_split_messages_t its_segments
+        = vsomeip::tp::tp::tp_split_message(&its_data[0],
+                static_cast<std::uint32_t>(its_data.size()));
+
+    boost::asio::io_service its_io;
+    auto its_reassembler = std::make_shared<vsomeip::tp::tp_reassembler>(
+            static_cast<std::uint32_t>(its_data.size()), its_io);
+    const boost::asio::ip::address its_address(
+            boost::asio::ip::address::from_string("127.0.0.1"));
+
+    std::size_t its_messages(0);
+    for (auto _ : _state) {
+        for (const auto &s : its_segments) {
+            auto its_result = its_reassembler->process_tp_message(&(*s)[0],
+                    static_cast<std::uint32_t>(s->size()), its_address, BENCHMARK_PORT);
+            if (its_result.first)
+                its_messages++;
+        }
+    }
+    its_reassembler->stop();
+    if (its_messages != static_cast<std::size_t>(_state.iterations()))
+        _state.SkipWithError("Messages were not reassembled.");
+    _state.SetBytesProcessed(static_cast<int64_t>(_state.iterations() * its_data.size()));
+}
+BENCHMARK(tp_process_tp_message)->Arg(4096)->Arg(65536)->Arg(262144);
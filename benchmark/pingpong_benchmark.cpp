@@ -0,0 +1,241 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Measures the request/response latency between two local applications
+// with the default configuration and with the low latency configuration
+// (busy polling io threads, inline message handlers). The server is the
+// routing manager. Both applications run in processes of their own.
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include <vsomeip/vsomeip.hpp>
+
+namespace vsomeip = vsomeip_v3;
+
+static const vsomeip::service_t BENCHMARK_SERVICE = 0x1111;
+static const vsomeip::instance_t BENCHMARK_INSTANCE = 0x0001;
+static const vsomeip::method_t BENCHMARK_METHOD_PING = 0x0001;
+static const vsomeip::method_t BENCHMARK_METHOD_STOP = 0x0002;
+static const std::size_t BENCHMARK_PAYLOAD_SIZE = 64;
+
+static void write_configuration(const std::string &_file,
+        bool _is_low_latency, std::size_t _busy_poll_time) {
+    std::stringstream its_options;
+    its_options << "\"threads\" : \"1\"";
+    if (_is_low_latency) {
+        its_options << ", \"busy_poll\" : \"" << _busy_poll_time << "\""
+                    << ", \"inline_handlers\" : \"true\"";
+    }
+
+    std::ofstream its_out(_file);
+    its_out << "{\n"
+            << "    \"unicast\" : \"127.0.0.1\",\n"
+            << "    \"network\" : \"vsomeip-pingpong\",\n"
+            << "    \"logging\" : { \"level\" : \"warning\", \"console\" : \"false\","
+            << " \"dlt\" : \"false\" },\n"
+            << "    \"applications\" :\n"
+            << "    [\n"
+            << "        { \"name\" : \"pingpong-server\", \"id\" : \"0x1101\", "
+            << its_options.str() << " },\n"
+            << "        { \"name\" : \"pingpong-client\", \"id\" : \"0x1102\", "
+            << its_options.str() << " }\n"
+            << "    ],\n"
+            << "    \"routing\" : \"pingpong-server\",\n"
+            << "    \"service-discovery\" : { \"enable\" : \"false\" }\n"
+            << "}\n";
+}
+
+static void run_server() {
+    auto its_app = vsomeip::runtime::get()->create_application("pingpong-server");
+    if (!its_app->init())
+        return;
+
+    std::mutex its_mutex;
+    std::condition_variable its_condition;
+    bool is_stopped(false);
+
+    its_app->register_message_handler(BENCHMARK_SERVICE, BENCHMARK_INSTANCE,
+            BENCHMARK_METHOD_PING,
+            [&its_app](const std::shared_ptr<vsomeip::message> &_request) {
+                auto its_response = vsomeip::runtime::get()->create_response(_request);
+                its_response->set_payload(_request->get_payload());
+                its_app->send(its_response);
+            });
+    its_app->register_message_handler(BENCHMARK_SERVICE, BENCHMARK_INSTANCE,
+            BENCHMARK_METHOD_STOP,
+            [&](const std::shared_ptr<vsomeip::message> &_request) {
+                (void)_request;
+                std::lock_guard<std::mutex> its_lock(its_mutex);
+                is_stopped = true;
+                its_condition.notify_one();
+            });
+    its_app->offer_service(BENCHMARK_SERVICE, BENCHMARK_INSTANCE);
+
+    std::thread its_thread([&its_app]() { its_app->start(); });
+    {
+        std::unique_lock<std::mutex> its_lock(its_mutex);
+        its_condition.wait(its_lock, [&is_stopped]() { return is_stopped; });
+    }
+    its_app->stop();
+    its_thread.join();
+}
+
+static void run_client(const std::string &_name, std::size_t _round_trips) {
+    auto its_app = vsomeip::runtime::get()->create_application("pingpong-client");
+    if (!its_app->init())
+        return;
+
+    std::mutex its_mutex;
+    std::condition_variable its_condition;
+    bool is_available(false);
+    bool is_done(false);
+
+    std::vector<double> its_latencies;
+    its_latencies.reserve(_round_trips);
+    std::chrono::steady_clock::time_point its_start;
+
+    auto its_request = vsomeip::runtime::get()->create_request(false);
+    its_request->set_service(BENCHMARK_SERVICE);
+    its_request->set_instance(BENCHMARK_INSTANCE);
+    its_request->set_method(BENCHMARK_METHOD_PING);
+    its_request->set_payload(vsomeip::runtime::get()->create_payload(
+            std::vector<vsomeip::byte_t>(BENCHMARK_PAYLOAD_SIZE, 0x5A)));
+
+    its_app->register_availability_handler(BENCHMARK_SERVICE, BENCHMARK_INSTANCE,
+            [&](vsomeip::service_t _service, vsomeip::instance_t _instance,
+                    bool _is_available) {
+                (void)_service;
+                (void)_instance;
+                if (_is_available) {
+                    std::lock_guard<std::mutex> its_lock(its_mutex);
+                    is_available = true;
+                    its_condition.notify_one();
+                }
+            });
+    // The next request is sent by the response handler. Thus, the measured
+    // time does not include waking up the sending thread.
+    its_app->register_message_handler(BENCHMARK_SERVICE, BENCHMARK_INSTANCE,
+            BENCHMARK_METHOD_PING,
+            [&](const std::shared_ptr<vsomeip::message> &_response) {
+                (void)_response;
+                its_latencies.push_back(static_cast<double>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now() - its_start).count()));
+                if (its_latencies.size() < _round_trips) {
+                    its_start = std::chrono::steady_clock::now();
+                    its_app->send(its_request);
+                } else {
+                    std::lock_guard<std::mutex> its_lock(its_mutex);
+                    is_done = true;
+                    its_condition.notify_one();
+                }
+            });
+    its_app->request_service(BENCHMARK_SERVICE, BENCHMARK_INSTANCE);
+
+    std::thread its_thread([&its_app]() { its_app->start(); });
+    {
+        std::unique_lock<std::mutex> its_lock(its_mutex);
+        if (its_condition.wait_for(its_lock, std::chrono::seconds(10),
+                [&is_available]() { return is_available; })) {
+            its_start = std::chrono::steady_clock::now();
+            its_app->send(its_request);
+            its_condition.wait(its_lock, [&is_done]() { return is_done; });
+        } else {
+            std::cerr << "Service is not available." << std::endl;
+        }
+    }
+
+    auto its_stop = vsomeip::runtime::get()->create_request(false);
+    its_stop->set_service(BENCHMARK_SERVICE);
+    its_stop->set_instance(BENCHMARK_INSTANCE);
+    its_stop->set_method(BENCHMARK_METHOD_STOP);
+    its_stop->set_message_type(vsomeip::message_type_e::MT_REQUEST_NO_RETURN);
+    its_app->send(its_stop);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    its_app->stop();
+    its_thread.join();
+
+    if (!its_latencies.empty()) {
+        std::sort(its_latencies.begin(), its_latencies.end());
+        double its_sum(0.0);
+        for (auto l : its_latencies)
+            its_sum += l;
+        std::cout << std::setfill(' ') << std::setw(16) << _name
+                  << std::fixed << std::setprecision(1)
+                  << std::setw(14) << its_sum / static_cast<double>(its_latencies.size()) / 1000.0
+                  << std::setw(14) << its_latencies[its_latencies.size() / 2] / 1000.0
+                  << std::setw(14) << its_latencies[its_latencies.size() * 99 / 100] / 1000.0
+                  << std::setw(14) << its_latencies.back() / 1000.0
+                  << std::endl;
+    }
+}
+
+int main(int argc, char **argv) {
+    std::size_t its_round_trips(100000);
+    std::size_t its_busy_poll_time(1000);
+    if (argc > 1) {
+        its_round_trips = static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10));
+        if (its_round_trips == 0)
+            its_round_trips = 1;
+    }
+    if (argc > 2)
+        its_busy_poll_time = static_cast<std::size_t>(std::strtoul(argv[2], nullptr, 10));
+
+    const boost::filesystem::path its_folder
+        = boost::filesystem::temp_directory_path() / "vsomeip-pingpong-benchmark";
+    boost::filesystem::create_directories(its_folder);
+
+    std::cout << std::setw(16) << ""
+              << std::setw(14) << "avg. [us]"
+              << std::setw(14) << "p50 [us]"
+              << std::setw(14) << "p99 [us]"
+              << std::setw(14) << "max [us]" << std::endl;
+
+    for (bool is_low_latency : { false, true }) {
+        const std::string its_name(is_low_latency ? "low latency" : "default");
+        const std::string its_file
+            = (its_folder / (is_low_latency ? "low_latency.json" : "default.json")).string();
+        write_configuration(its_file, is_low_latency, its_busy_poll_time);
+        std::cout.flush();
+
+        pid_t its_server = fork();
+        if (its_server == 0) {
+            setenv("VSOMEIP_CONFIGURATION", its_file.c_str(), 1);
+            run_server();
+            std::_Exit(0);
+        }
+        pid_t its_client = fork();
+        if (its_client == 0) {
+            setenv("VSOMEIP_CONFIGURATION", its_file.c_str(), 1);
+            run_client(its_name, its_round_trips);
+            std::cout.flush();
+            std::_Exit(0);
+        }
+
+        waitpid(its_client, nullptr, 0);
+        waitpid(its_server, nullptr, 0);
+    }
+
+    boost::filesystem::remove_all(its_folder);
+    return 0;
+}
@@ -0,0 +1,271 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Measures the time it takes until all services are available again after
+// the routing manager was restarted. A client process hosts the applications.
+// Each application offers its services and requests the services of the next
+// application. The routing manager is killed and restarted in a process of
+// its own. The time is measured from the restart until all applications have
+// been informed about the availability of all requested services.
+
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include <vsomeip/vsomeip.hpp>
+
+namespace vsomeip = vsomeip_v3;
+
+static const vsomeip::service_t BENCHMARK_FIRST_SERVICE = 0x1000;
+static const vsomeip::instance_t BENCHMARK_INSTANCE = 0x0001;
+static const char *BENCHMARK_ROUTING = "restart-routing";
+
+static void write_configuration(const std::string &_file) {
+    std::ofstream its_out(_file);
+    its_out << "{\n"
+            << "    \"unicast\" : \"127.0.0.1\",\n"
+            << "    \"network\" : \"vsomeip-restart\",\n"
+            << "    \"logging\" : { \"level\" : \"warning\", \"console\" : \"false\","
+            << " \"dlt\" : \"false\" },\n"
+            << "    \"routing\" : \"" << BENCHMARK_ROUTING << "\",\n"
+            << "    \"service-discovery\" : { \"enable\" : \"false\" }\n"
+            << "}\n";
+}
+
+static bool read_byte(int _fd, char &_byte) {
+    return ::read(_fd, &_byte, sizeof(_byte)) == sizeof(_byte);
+}
+
+static bool write_byte(int _fd, char _byte) {
+    return ::write(_fd, &_byte, sizeof(_byte)) == sizeof(_byte);
+}
+
+static void run_routing() {
+    auto its_app = vsomeip::runtime::get()->create_application(BENCHMARK_ROUTING);
+    if (!its_app->init())
+        return;
+    its_app->start();
+}
+
+static pid_t start_routing() {
+    pid_t its_routing = fork();
+    if (its_routing == 0) {
+        run_routing();
+        std::_Exit(0);
+    }
+    return its_routing;
+}
+
+// Tracks the availability of the requested services of all applications.
+class availability_tracker {
+public:
+    explicit availability_tracker(std::size_t _services)
+        : available_(_services, false), count_(0) {
+    }
+
+    void set(std::size_t _index, bool _is_available) {
+        std::lock_guard<std::mutex> its_lock(mutex_);
+        if (available_[_index] == _is_available)
+            return;
+        available_[_index] = _is_available;
+        if (_is_available) {
+            count_++;
+            if (count_ == available_.size())
+                all_available_ = std::chrono::steady_clock::now();
+        } else {
+            count_--;
+        }
+        condition_.notify_all();
+    }
+
+    // Waits until the number of available services is _count and returns
+    // the point in time all services became available.
+    bool wait(std::size_t _count, std::chrono::steady_clock::time_point &_all_available) {
+        std::unique_lock<std::mutex> its_lock(mutex_);
+        bool is_reached = condition_.wait_for(its_lock, std::chrono::seconds(60),
+                [this, _count]() { return count_ == _count; });
+        _all_available = all_available_;
+        return is_reached;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::vector<bool> available_;
+    std::size_t count_;
+    std::chrono::steady_clock::time_point all_available_;
+};
+
+static void run_client(std::size_t _apps, std::size_t _services,
+        std::size_t _restarts, int _from_parent, int _to_parent) {
+    availability_tracker its_tracker(_apps * _services);
+
+    std::vector<std::shared_ptr<vsomeip::application> > its_apps;
+    std::vector<std::thread> its_threads;
+    for (std::size_t i = 0; i < _apps; i++) {
+        std::stringstream its_name;
+        its_name << "restart-client-" << i;
+        auto its_app = vsomeip::runtime::get()->create_application(its_name.str());
+        if (!its_app->init())
+            return;
+
+        const std::size_t its_next((i + 1) % _apps);
+        for (std::size_t j = 0; j < _services; j++) {
+            its_app->offer_service(
+                    vsomeip::service_t(BENCHMARK_FIRST_SERVICE + i * _services + j),
+                    BENCHMARK_INSTANCE);
+
+            const std::size_t its_index(i * _services + j);
+            const vsomeip::service_t its_service(
+                    vsomeip::service_t(BENCHMARK_FIRST_SERVICE + its_next * _services + j));
+            its_app->register_availability_handler(its_service, BENCHMARK_INSTANCE,
+                    [&its_tracker, its_index](vsomeip::service_t _service,
+                            vsomeip::instance_t _instance, bool _is_available) {
+                        (void)_service;
+                        (void)_instance;
+                        its_tracker.set(its_index, _is_available);
+                    });
+            its_app->request_service(its_service, BENCHMARK_INSTANCE);
+        }
+        its_apps.push_back(its_app);
+    }
+    for (auto &its_app : its_apps)
+        its_threads.emplace_back([its_app]() { its_app->start(); });
+
+    std::chrono::steady_clock::time_point its_all_available;
+    std::vector<double> its_durations;
+    bool is_ok = its_tracker.wait(_apps * _services, its_all_available);
+    for (std::size_t r = 0; is_ok && r < _restarts; r++) {
+        char its_byte;
+        // The routing manager was killed
+        is_ok = write_byte(_to_parent, 'a') && read_byte(_from_parent, its_byte)
+                && its_tracker.wait(0, its_all_available);
+        if (!is_ok)
+            break;
+
+        // The routing manager was restarted
+        std::int64_t its_restart;
+        is_ok = write_byte(_to_parent, 'u')
+                && ::read(_from_parent, &its_restart, sizeof(its_restart))
+                    == sizeof(its_restart)
+                && its_tracker.wait(_apps * _services, its_all_available);
+        if (is_ok) {
+            its_durations.push_back(static_cast<double>(
+                    std::chrono::duration_cast<std::chrono::microseconds>(
+                            its_all_available.time_since_epoch()).count()
+                    - its_restart));
+        }
+    }
+    if (!is_ok)
+        std::cerr << "Services did not become (un)available." << std::endl;
+    write_byte(_to_parent, 'd');
+
+    for (auto &its_app : its_apps) {
+        its_app->clear_all_handler();
+        its_app->stop();
+    }
+    for (auto &its_thread : its_threads)
+        its_thread.join();
+
+    if (!its_durations.empty()) {
+        std::sort(its_durations.begin(), its_durations.end());
+        double its_sum(0.0);
+        for (auto d : its_durations)
+            its_sum += d;
+        std::stringstream its_name;
+        its_name << _apps << "x" << _services;
+        std::cout << std::setfill(' ') << std::setw(16) << its_name.str()
+                  << std::fixed << std::setprecision(1)
+                  << std::setw(14) << its_sum / static_cast<double>(its_durations.size()) / 1000.0
+                  << std::setw(14) << its_durations.front() / 1000.0
+                  << std::setw(14) << its_durations.back() / 1000.0
+                  << std::endl;
+    }
+}
+
+int main(int argc, char **argv) {
+    std::size_t its_restarts(5);
+    std::size_t its_apps(100);
+    std::size_t its_services(50);
+    if (argc > 1)
+        its_restarts = std::max<std::size_t>(1, std::strtoul(argv[1], nullptr, 10));
+    if (argc > 2)
+        its_apps = std::max<std::size_t>(1, std::strtoul(argv[2], nullptr, 10));
+    if (argc > 3)
+        its_services = std::max<std::size_t>(1, std::strtoul(argv[3], nullptr, 10));
+
+    const boost::filesystem::path its_folder
+        = boost::filesystem::temp_directory_path() / "vsomeip-restart-benchmark";
+    boost::filesystem::create_directories(its_folder);
+    const std::string its_file((its_folder / "restart.json").string());
+    write_configuration(its_file);
+    setenv("VSOMEIP_CONFIGURATION", its_file.c_str(), 1);
+
+    int its_to_client[2], its_to_parent[2];
+    if (pipe(its_to_client) != 0 || pipe(its_to_parent) != 0) {
+        std::cerr << "Creating pipes failed." << std::endl;
+        return 1;
+    }
+
+    std::cout << std::setw(16) << "apps x services"
+              << std::setw(14) << "avg. [ms]"
+              << std::setw(14) << "min [ms]"
+              << std::setw(14) << "max [ms]" << std::endl;
+    std::cout.flush();
+
+    pid_t its_routing = start_routing();
+    pid_t its_client = fork();
+    if (its_client == 0) {
+        close(its_to_client[1]);
+        close(its_to_parent[0]);
+        run_client(its_apps, its_services, its_restarts,
+                its_to_client[0], its_to_parent[1]);
+        std::cout.flush();
+        std::_Exit(0);
+    }
+    close(its_to_client[0]);
+    close(its_to_parent[1]);
+
+    char its_byte;
+    while (read_byte(its_to_parent[0], its_byte) && its_byte != 'd') {
+        if (its_byte == 'a') {
+            kill(its_routing, SIGKILL);
+            waitpid(its_routing, nullptr, 0);
+            write_byte(its_to_client[1], 'k');
+        } else if (its_byte == 'u') {
+            const std::int64_t its_restart
+                = std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch()).count();
+            its_routing = start_routing();
+            if (::write(its_to_client[1], &its_restart, sizeof(its_restart))
+                    != sizeof(its_restart))
+                break;
+        }
+    }
+
+    waitpid(its_client, nullptr, 0);
+    kill(its_routing, SIGKILL);
+    waitpid(its_routing, nullptr, 0);
+
+    boost::filesystem::remove_all(its_folder);
+    return 0;
+}
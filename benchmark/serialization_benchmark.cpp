@@ -0,0 +1,255 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Compares the typed serialization of vsomeip/serialization.hpp to
+// hand-written marshalling code as found in many applications.
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <vsomeip/serialization.hpp>
+
+namespace vsomeip = vsomeip_v3;
+
+struct wheel_status {
+    std::uint16_t pressure_;
+    std::int8_t temperature_;
+};
+
+struct vehicle_status {
+    std::uint32_t timestamp_;
+    std::int16_t speed_;
+    std::uint8_t gear_;
+    bool is_moving_;
+    double latitude_;
+    double longitude_;
+    std::array<wheel_status, 4> wheels_;
+    std::vector<std::uint8_t> data_;
+    std::string name_;
+};
+
+namespace vsomeip_v3 {
+namespace serialization {
+
+template<>
+struct struct_layout<wheel_status> {
+    typedef fields<
+        VSOMEIP_SERIALIZATION_FIELD(wheel_status, pressure_),
+        VSOMEIP_SERIALIZATION_FIELD(wheel_status, temperature_)
+    > type;
+};
+
+template<>
+struct struct_layout<vehicle_status> {
+    typedef fields<
+        VSOMEIP_SERIALIZATION_FIELD(vehicle_status, timestamp_),
+        VSOMEIP_SERIALIZATION_FIELD(vehicle_status, speed_),
+        VSOMEIP_SERIALIZATION_FIELD(vehicle_status, gear_),
+        VSOMEIP_SERIALIZATION_FIELD(vehicle_status, is_moving_),
+        VSOMEIP_SERIALIZATION_FIELD(vehicle_status, latitude_),
+        VSOMEIP_SERIALIZATION_FIELD(vehicle_status, longitude_),
+        VSOMEIP_SERIALIZATION_FIELD(vehicle_status, wheels_),
+        VSOMEIP_SERIALIZATION_FIELD(vehicle_status, data_),
+        VSOMEIP_SERIALIZATION_FIELD(vehicle_status, name_)
+    > type;
+};
+
+} // namespace serialization
+} // namespace vsomeip_v3
+
+static void push_uint16(std::vector<vsomeip::byte_t> &_buffer, std::uint16_t _value) {
+    _buffer.push_back(static_cast<vsomeip::byte_t>(_value >> 8));
+    _buffer.push_back(static_cast<vsomeip::byte_t>(_value));
+}
+
+static void push_uint32(std::vector<vsomeip::byte_t> &_buffer, std::uint32_t _value) {
+    push_uint16(_buffer, static_cast<std::uint16_t>(_value >> 16));
+    push_uint16(_buffer, static_cast<std::uint16_t>(_value));
+}
+
+static void push_double(std::vector<vsomeip::byte_t> &_buffer, double _value) {
+    std::uint64_t its_value;
+    std::memcpy(&its_value, &_value, sizeof(its_value));
+    push_uint32(_buffer, static_cast<std::uint32_t>(its_value >> 32));
+    push_uint32(_buffer, static_cast<std::uint32_t>(its_value));
+}
+
+static void hand_written_serialize(const vehicle_status &_status,
+        std::vector<vsomeip::byte_t> &_buffer) {
+    _buffer.clear();
+    push_uint32(_buffer, _status.timestamp_);
+    push_uint16(_buffer, static_cast<std::uint16_t>(_status.speed_));
+    _buffer.push_back(_status.gear_);
+    _buffer.push_back(_status.is_moving_ ? 1 : 0);
+    push_double(_buffer, _status.latitude_);
+    push_double(_buffer, _status.longitude_);
+    for (const auto &w : _status.wheels_) {
+        push_uint16(_buffer, w.pressure_);
+        _buffer.push_back(static_cast<vsomeip::byte_t>(w.temperature_));
+    }
+    push_uint32(_buffer, static_cast<std::uint32_t>(_status.data_.size()));
+    for (auto b : _status.data_)
+        _buffer.push_back(b);
+    push_uint32(_buffer, static_cast<std::uint32_t>(_status.name_.size() + 4));
+    _buffer.push_back(0xEF);
+    _buffer.push_back(0xBB);
+    _buffer.push_back(0xBF);
+    for (auto c : _status.name_)
+        _buffer.push_back(static_cast<vsomeip::byte_t>(c));
+    _buffer.push_back(0x00);
+}
+
+static bool hand_written_deserialize(vehicle_status &_status,
+        const std::vector<vsomeip::byte_t> &_buffer) {
+    std::size_t its_position(0);
+    auto get = [&](std::size_t _size, std::uint64_t &_value) {
+        if (its_position + _size > _buffer.size())
+            return false;
+        _value = 0;
+        for (std::size_t i = 0; i < _size; i++)
+            _value = (_value << 8) | _buffer[its_position++];
+        return true;
+    };
+
+    std::uint64_t its_value;
+    if (!get(4, its_value)) return false;
+    _status.timestamp_ = static_cast<std::uint32_t>(its_value);
+    if (!get(2, its_value)) return false;
+    _status.speed_ = static_cast<std::int16_t>(its_value);
+    if (!get(1, its_value)) return false;
+    _status.gear_ = static_cast<std::uint8_t>(its_value);
+    if (!get(1, its_value)) return false;
+    _status.is_moving_ = ((its_value & 0x01) != 0);
+    if (!get(8, its_value)) return false;
+    std::memcpy(&_status.latitude_, &its_value, sizeof(its_value));
+    if (!get(8, its_value)) return false;
+    std::memcpy(&_status.longitude_, &its_value, sizeof(its_value));
+    for (auto &w : _status.wheels_) {
+        if (!get(2, its_value)) return false;
+        w.pressure_ = static_cast<std::uint16_t>(its_value);
+        if (!get(1, its_value)) return false;
+        w.temperature_ = static_cast<std::int8_t>(its_value);
+    }
+    if (!get(4, its_value) || its_position + its_value > _buffer.size())
+        return false;
+    _status.data_.clear();
+    for (std::uint64_t i = 0; i < its_value; i++)
+        _status.data_.push_back(_buffer[its_position++]);
+    if (!get(4, its_value) || its_value < 4
+            || its_position + its_value > _buffer.size())
+        return false;
+    _status.name_.clear();
+    for (std::uint64_t i = 3; i < its_value - 1; i++)
+        _status.name_.push_back(static_cast<char>(_buffer[its_position + i]));
+    its_position += its_value;
+    return true;
+}
+
+static bool operator==(const vehicle_status &_lhs, const vehicle_status &_rhs) {
+    for (std::size_t i = 0; i < _lhs.wheels_.size(); i++) {
+        if (_lhs.wheels_[i].pressure_ != _rhs.wheels_[i].pressure_
+                || _lhs.wheels_[i].temperature_ != _rhs.wheels_[i].temperature_)
+            return false;
+    }
+    return (_lhs.timestamp_ == _rhs.timestamp_ && _lhs.speed_ == _rhs.speed_
+            && _lhs.gear_ == _rhs.gear_ && _lhs.is_moving_ == _rhs.is_moving_
+            && _lhs.latitude_ == _rhs.latitude_
+            && _lhs.longitude_ == _rhs.longitude_
+            && _lhs.data_ == _rhs.data_ && _lhs.name_ == _rhs.name_);
+}
+
+template<typename Function>
+static double measure(std::size_t _iterations, Function _function) {
+    auto its_start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < _iterations; i++)
+        _function(i);
+    auto its_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - its_start);
+    return static_cast<double>(its_duration.count())
+            / static_cast<double>(_iterations);
+}
+
+int main(int argc, char **argv) {
+    std::size_t its_iterations(1000000);
+    if (argc > 1) {
+        its_iterations = static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10));
+        if (its_iterations == 0)
+            its_iterations = 1;
+    }
+
+    vehicle_status its_status;
+    its_status.timestamp_ = 0x12345678;
+    its_status.speed_ = -42;
+    its_status.gear_ = 3;
+    its_status.is_moving_ = true;
+    its_status.latitude_ = 48.177;
+    its_status.longitude_ = 11.556;
+    for (std::size_t i = 0; i < its_status.wheels_.size(); i++)
+        its_status.wheels_[i] = { static_cast<std::uint16_t>(2300 + i),
+                static_cast<std::int8_t>(20 + i) };
+    for (std::size_t its_size : { 16, 256 }) {
+        its_status.data_.resize(its_size);
+        for (std::size_t i = 0; i < its_size; i++)
+            its_status.data_[i] = static_cast<std::uint8_t>(i);
+        its_status.name_ = "vehicle";
+
+        std::vector<vsomeip::byte_t> its_typed, its_hand_written;
+        vehicle_status its_result;
+        if (!vsomeip::serialization::serialize(its_status, its_typed)
+                || (hand_written_serialize(its_status, its_hand_written),
+                        its_typed != its_hand_written)
+                || !vsomeip::serialization::deserialize(its_result,
+                        its_typed.data(), its_typed.size())
+                || !(its_result == its_status)) {
+            std::cerr << "Typed and hand-written serialization differ." << std::endl;
+            return 1;
+        }
+
+        std::size_t its_sink(0);
+        const double its_typed_serialize = measure(its_iterations,
+                [&](std::size_t i) {
+                    its_status.timestamp_ = static_cast<std::uint32_t>(i);
+                    vsomeip::serialization::serialize(its_status, its_typed);
+                    its_sink += its_typed[3];
+                });
+        const double its_hand_written_serialize = measure(its_iterations,
+                [&](std::size_t i) {
+                    its_status.timestamp_ = static_cast<std::uint32_t>(i);
+                    hand_written_serialize(its_status, its_hand_written);
+                    its_sink += its_hand_written[3];
+                });
+        const double its_typed_deserialize = measure(its_iterations,
+                [&](std::size_t) {
+                    vsomeip::serialization::deserialize(its_result,
+                            its_typed.data(), its_typed.size());
+                    its_sink += its_result.timestamp_;
+                });
+        const double its_hand_written_deserialize = measure(its_iterations,
+                [&](std::size_t) {
+                    hand_written_deserialize(its_result, its_hand_written);
+                    its_sink += its_result.timestamp_;
+                });
+
+        std::cout << "payload size " << its_typed.size() << " bytes"
+                  << " (checksum " << its_sink << ")" << std::endl
+                  << std::setw(16) << "" << std::setw(14) << "typed [ns]"
+                  << std::setw(20) << "hand-written [ns]" << std::endl
+                  << std::fixed << std::setprecision(1)
+                  << std::setw(16) << "serialize"
+                  << std::setw(14) << its_typed_serialize
+                  << std::setw(20) << its_hand_written_serialize << std::endl
+                  << std::setw(16) << "deserialize"
+                  << std::setw(14) << its_typed_deserialize
+                  << std::setw(20) << its_hand_written_deserialize << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,173 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Measures the time it takes until a number of applications that are started
+// at the same time are registered at the routing manager. The routing manager
+// runs in a process of its own. Each round starts all applications in
+// parallel and measures the time from the start until the last application
+// reached the registered state. The first round is not measured as it also
+// contains the startup of the routing manager.
+
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include <vsomeip/vsomeip.hpp>
+
+namespace vsomeip = vsomeip_v3;
+
+static const char *BENCHMARK_ROUTING = "startup-routing";
+
+static void write_configuration(const std::string &_file) {
+    std::ofstream its_out(_file);
+    its_out << "{\n"
+            << "    \"unicast\" : \"127.0.0.1\",\n"
+            << "    \"network\" : \"vsomeip-startup\",\n"
+            << "    \"logging\" : { \"level\" : \"warning\", \"console\" : \"false\","
+            << " \"dlt\" : \"false\" },\n"
+            << "    \"routing\" : \"" << BENCHMARK_ROUTING << "\",\n"
+            << "    \"service-discovery\" : { \"enable\" : \"false\" }\n"
+            << "}\n";
+}
+
+// Counts the applications that are registered at the routing manager.
+class registration_tracker {
+public:
+    registration_tracker() : count_(0) {
+    }
+
+    void set(vsomeip::state_type_e _state) {
+        std::lock_guard<std::mutex> its_lock(mutex_);
+        if (_state == vsomeip::state_type_e::ST_REGISTERED)
+            count_++;
+        else if (count_ > 0)
+            count_--;
+        condition_.notify_all();
+    }
+
+    bool wait(std::size_t _count) {
+        std::unique_lock<std::mutex> its_lock(mutex_);
+        return condition_.wait_for(its_lock, std::chrono::seconds(60),
+                [this, _count]() { return count_ == _count; });
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::size_t count_;
+};
+
+// Starts _apps applications in parallel and returns the time until all of
+// them were registered in microseconds or a negative value on failure.
+static double run_round(std::size_t _apps) {
+    registration_tracker its_tracker;
+
+    std::vector<std::shared_ptr<vsomeip::application> > its_apps;
+    for (std::size_t i = 0; i < _apps; i++) {
+        std::stringstream its_name;
+        its_name << "startup-client-" << i;
+        auto its_app = vsomeip::runtime::get()->create_application(its_name.str());
+        if (!its_app->init())
+            return -1.0;
+        its_app->register_state_handler(
+                [&its_tracker](vsomeip::state_type_e _state) {
+                    its_tracker.set(_state);
+                });
+        its_apps.push_back(its_app);
+    }
+
+    const auto its_start = std::chrono::steady_clock::now();
+    std::vector<std::thread> its_threads;
+    for (auto &its_app : its_apps)
+        its_threads.emplace_back([its_app]() { its_app->start(); });
+    const bool is_registered = its_tracker.wait(_apps);
+    const auto its_end = std::chrono::steady_clock::now();
+
+    for (auto &its_app : its_apps) {
+        its_app->clear_all_handler();
+        its_app->stop();
+    }
+    for (auto &its_thread : its_threads)
+        its_thread.join();
+
+    if (!is_registered)
+        return -1.0;
+    return static_cast<double>(std::chrono::duration_cast<
+            std::chrono::microseconds>(its_end - its_start).count());
+}
+
+int main(int argc, char **argv) {
+    std::size_t its_rounds(10);
+    std::size_t its_apps(80);
+    if (argc > 1)
+        its_rounds = std::max<std::size_t>(1, std::strtoul(argv[1], nullptr, 10));
+    if (argc > 2)
+        its_apps = std::max<std::size_t>(1, std::strtoul(argv[2], nullptr, 10));
+
+    const boost::filesystem::path its_folder
+        = boost::filesystem::temp_directory_path() / "vsomeip-startup-benchmark";
+    boost::filesystem::create_directories(its_folder);
+    const std::string its_file((its_folder / "startup.json").string());
+    write_configuration(its_file);
+    setenv("VSOMEIP_CONFIGURATION", its_file.c_str(), 1);
+
+    pid_t its_routing = fork();
+    if (its_routing == 0) {
+        auto its_app = vsomeip::runtime::get()->create_application(BENCHMARK_ROUTING);
+        if (its_app->init())
+            its_app->start();
+        std::_Exit(0);
+    }
+
+    std::vector<double> its_durations;
+    bool is_ok(run_round(its_apps) >= 0.0);
+    for (std::size_t r = 0; is_ok && r < its_rounds; r++) {
+        const double its_duration = run_round(its_apps);
+        is_ok = (its_duration >= 0.0);
+        if (is_ok)
+            its_durations.push_back(its_duration);
+    }
+    if (!is_ok)
+        std::cerr << "Applications did not register." << std::endl;
+
+    kill(its_routing, SIGKILL);
+    waitpid(its_routing, nullptr, 0);
+    boost::filesystem::remove_all(its_folder);
+
+    if (its_durations.empty())
+        return 1;
+
+    std::sort(its_durations.begin(), its_durations.end());
+    double its_sum(0.0);
+    for (auto d : its_durations)
+        its_sum += d;
+    std::cout << std::setfill(' ') << std::setw(8) << "apps"
+              << std::setw(14) << "avg. [ms]"
+              << std::setw(14) << "min [ms]"
+              << std::setw(14) << "max [ms]" << std::endl
+              << std::setw(8) << its_apps
+              << std::fixed << std::setprecision(1)
+              << std::setw(14) << its_sum / static_cast<double>(its_durations.size()) / 1000.0
+              << std::setw(14) << its_durations.front() / 1000.0
+              << std::setw(14) << its_durations.back() / 1000.0
+              << std::endl;
+    return 0;
+}
@@ -130,6 +130,10 @@ public:
     virtual std::size_t get_io_thread_count(const std::string &_name) const = 0;
     virtual int get_io_thread_nice_level(const std::string &_name) const = 0;
     virtual std::size_t get_request_debouncing(const std::string &_name) const = 0;
+    virtual bool is_io_uring_enabled(const std::string &_name) const = 0;
+    virtual std::size_t get_busy_poll_time(const std::string &_name) const = 0;
+    virtual bool has_inline_handlers(const std::string &_name) const = 0;
+    virtual std::size_t get_max_queued_handlers(const std::string &_name) const = 0;
 #ifdef VSOMEIP_HAS_SESSION_HANDLING_CONFIG
     virtual bool has_session_handling(const std::string &_name) const = 0;
 #endif // VSOMEIP_HAS_SESSION_HANDLING_CONFIG
@@ -166,6 +170,7 @@ public:
     virtual int32_t get_sd_cyclic_offer_delay() const = 0;
     virtual int32_t get_sd_request_response_delay() const = 0;
     virtual std::uint32_t get_sd_offer_debounce_time() const = 0;
+    virtual std::uint32_t get_sd_processing_threads() const = 0;
 
     // Trace configuration
     virtual std::shared_ptr<cfg::trace> get_trace() const = 0;
@@ -255,6 +260,7 @@ public:
     virtual bool is_secure_service(service_t _service, instance_t _instance) const = 0;
 
     virtual std::uint32_t get_udp_receive_buffer_size() const = 0;
+    virtual std::uint32_t get_tcp_coalescing_limit() const = 0;
 
     virtual bool check_routing_credentials(client_t _client, uint32_t _uid, uint32_t _gid) const = 0;
 
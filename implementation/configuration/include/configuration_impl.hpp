@@ -20,6 +20,7 @@
 #include "configuration_element.hpp"
 #include "watchdog.hpp"
 #include "service_instance_range.hpp"
+#include "configuration_index.hpp"
 #include "../../e2e_protection/include/e2exf/config.hpp"
 #include "e2e.hpp"
 #include "debounce.hpp"
@@ -115,6 +116,10 @@ public:
     VSOMEIP_EXPORT std::size_t get_io_thread_count(const std::string &_name) const;
     VSOMEIP_EXPORT int get_io_thread_nice_level(const std::string &_name) const;
     VSOMEIP_EXPORT std::size_t get_request_debouncing(const std::string &_name) const;
+    VSOMEIP_EXPORT bool is_io_uring_enabled(const std::string &_name) const;
+    VSOMEIP_EXPORT std::size_t get_busy_poll_time(const std::string &_name) const;
+    VSOMEIP_EXPORT bool has_inline_handlers(const std::string &_name) const;
+    VSOMEIP_EXPORT std::size_t get_max_queued_handlers(const std::string &_name) const;
     VSOMEIP_EXPORT bool has_session_handling(const std::string &_name) const;
 
     VSOMEIP_EXPORT std::set<std::pair<service_t, instance_t> > get_remote_services() const;
@@ -161,6 +166,7 @@ public:
     VSOMEIP_EXPORT int32_t get_sd_cyclic_offer_delay() const;
     VSOMEIP_EXPORT int32_t get_sd_request_response_delay() const;
     VSOMEIP_EXPORT std::uint32_t get_sd_offer_debounce_time() const;
+    VSOMEIP_EXPORT std::uint32_t get_sd_processing_threads() const;
 
     // Trace configuration
     VSOMEIP_EXPORT std::shared_ptr<cfg::trace> get_trace() const;
@@ -221,6 +227,7 @@ public:
     VSOMEIP_EXPORT bool is_secure_service(service_t _service, instance_t _instance) const;
 
     VSOMEIP_EXPORT std::uint32_t get_udp_receive_buffer_size() const;
+    VSOMEIP_EXPORT std::uint32_t get_tcp_coalescing_limit() const;
 
     VSOMEIP_EXPORT bool has_overlay(const std::string &_name) const;
     VSOMEIP_EXPORT void load_overlay(const std::string &_name);
@@ -332,6 +339,7 @@ private:
     void load_acceptances(const configuration_element &_element);
     void load_acceptance_data(const boost::property_tree::ptree &_tree);
     void load_udp_receive_buffer_size(const configuration_element &_element);
+    void load_tcp_coalescing_limit(const configuration_element &_element);
     bool load_npdu_debounce_times_configuration(
             const std::shared_ptr<service>& _service,
             const boost::property_tree::ptree &_tree);
@@ -361,6 +369,9 @@ private:
     bool is_mandatory(const std::string &_name) const;
     bool is_remote(const std::shared_ptr<service>& _service) const;
     bool is_internal_service(service_t _service, instance_t _instance) const;
+
+    void update_index();
+    std::shared_ptr<const configuration_index> get_index() const;
     bool is_in_port_range(uint16_t _port, std::pair<uint16_t, uint16_t> _port_range) const;
 
     void set_mandatory(const std::string &_input);
@@ -415,7 +426,11 @@ protected:
                 std::set<std::string>
             >, // plugins
             int, // nice level
-            std::string // overlay
+            std::string, // overlay
+            bool, // io_uring
+            std::size_t, // busy poll time
+            bool, // inline handlers
+            std::size_t // max queued handlers
 #ifdef VSOMEIP_HAS_SESSION_HANDLING_CONFIG
             , bool // has session handling?
 #endif // VSOMEIP_HAS_SESSION_HANDLING_CONFIG
@@ -450,6 +465,7 @@ protected:
     int32_t sd_cyclic_offer_delay_;
     int32_t sd_request_response_delay_;
     std::uint32_t sd_offer_debounce_time_;
+    std::uint32_t sd_processing_threads_;
 
     std::map<std::string, std::set<uint16_t> > magic_cookies_;
 
@@ -468,6 +484,10 @@ protected:
 
     std::vector<service_instance_range> internal_service_ranges_;
 
+    // Built from services_, services_by_ip_port_ and internal_service_ranges_
+    // (replaced by update_index, accessed by std::atomic_load/store)
+    std::shared_ptr<const configuration_index> index_;
+
     bool log_version_;
     uint32_t log_version_interval_;
 
@@ -514,7 +534,9 @@ protected:
         ET_PLUGIN_TYPE,
         ET_ROUTING_CREDENTIALS,
         ET_SHUTDOWN_TIMEOUT,
-        ET_MAX = 42
+        ET_TCP_COALESCING_LIMIT,
+        ET_SERVICE_DISCOVERY_PROCESSING_THREADS,
+        ET_MAX = 44
     };
 
     bool is_configured_[ET_MAX];
@@ -553,6 +575,7 @@ protected:
     bool has_issued_clients_warning_;
 
     std::uint32_t udp_receive_buffer_size_;
+    std::uint32_t tcp_coalescing_limit_;
 
     std::chrono::nanoseconds npdu_default_debounce_requ_;
     std::chrono::nanoseconds npdu_default_debounce_resp_;
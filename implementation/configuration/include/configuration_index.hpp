@@ -0,0 +1,116 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_CFG_CONFIGURATION_INDEX_HPP
+#define VSOMEIP_V3_CFG_CONFIGURATION_INDEX_HPP
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <vsomeip/primitive_types.hpp>
+
+#include "service_instance_range.hpp"
+
+namespace vsomeip_v3 {
+namespace cfg {
+
+struct service;
+
+// Answers the service related queries of the message path. The index is
+// built from the service configuration and is not changed afterwards. If
+// the service configuration changes, a new index replaces the old one.
+// Thus, the index can be used without locking.
+class configuration_index {
+public:
+    struct entry {
+        std::shared_ptr<service> service_;
+
+        uint16_t reliable_;
+        uint16_t unreliable_;
+        major_version_t major_;
+        minor_version_t minor_;
+        ttl_t ttl_;
+
+        bool is_local_;
+        bool is_someip_;
+        std::string unicast_address_;
+    };
+
+    configuration_index()
+        : internal_services_(1 << (8 * sizeof(service_t)), false) {
+    }
+
+    void add_service(service_t _service, instance_t _instance,
+            const entry &_entry) {
+        entries_.emplace(get_key(_service, _instance), _entry);
+    }
+
+    void add_service(service_t _service, const std::string &_address,
+            std::uint16_t _port, service *_config) {
+        services_by_port_[get_key(_service, _port)].emplace_back(
+                _address, _config);
+    }
+
+    void add_internal_range(const service_instance_range &_range) {
+        internal_ranges_.push_back(_range);
+        for (std::uint32_t s = _range.first_service_; s <= _range.last_service_; s++)
+            internal_services_[s] = true;
+    }
+
+    const entry *find(service_t _service, instance_t _instance) const {
+        auto found_entry = entries_.find(get_key(_service, _instance));
+        if (found_entry != entries_.end())
+            return &found_entry->second;
+        return nullptr;
+    }
+
+    service *find(service_t _service,
+            const std::string &_address, std::uint16_t _port) const {
+        auto found_port = services_by_port_.find(get_key(_service, _port));
+        if (found_port != services_by_port_.end()) {
+            for (const auto &s : found_port->second) {
+                if (s.first == _address)
+                    return s.second;
+            }
+        }
+        return nullptr;
+    }
+
+    bool is_internal(service_t _service, instance_t _instance) const {
+        if (!internal_services_[_service])
+            return false;
+
+        for (const auto &r : internal_ranges_) {
+            if (_service >= r.first_service_ && _service <= r.last_service_
+                    && _instance >= r.first_instance_
+                    && _instance <= r.last_instance_) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    static std::uint32_t get_key(std::uint16_t _high, std::uint16_t _low) {
+        return (std::uint32_t(_high) << 16) | _low;
+    }
+
+    std::unordered_map<std::uint32_t, entry> entries_;
+    std::unordered_map<std::uint32_t,
+        std::vector<std::pair<std::string, service *> > > services_by_port_;
+
+    // Marks the services that are part of an internal range. Thus, most
+    // lookups do not need to check the ranges.
+    std::vector<bool> internal_services_;
+    std::vector<service_instance_range> internal_ranges_;
+};
+
+} // namespace cfg
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_CFG_CONFIGURATION_INDEX_HPP
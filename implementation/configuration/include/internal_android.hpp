@@ -55,17 +55,28 @@
 #define VSOMEIP_MAX_TCP_SENT_WAIT_TIME          10000
 
 #define VSOMEIP_DEFAULT_BUFFER_SHRINK_THRESHOLD 5
+#define VSOMEIP_MAX_CACHED_SERIALIZERS          2
+
+#define VSOMEIP_MAX_CONFIGURATION_PARSER_THREADS 4
 
 #define VSOMEIP_DEFAULT_WATCHDOG_TIMEOUT        5000
 #define VSOMEIP_DEFAULT_MAX_MISSING_PONGS       3
 
 #define VSOMEIP_DEFAULT_UDP_RCV_BUFFER_SIZE     1703936
 
+#define VSOMEIP_DEFAULT_TCP_COALESCING_LIMIT    65536
+
+#define VSOMEIP_STREAM_RECEIVE_BUFFER_SIZE      16384
+
+#define VSOMEIP_IO_URING_ENTRIES                256
+
 #define VSOMEIP_IO_THREAD_COUNT                 2
 #define VSOMEIP_IO_THREAD_NICE_LEVEL            255
+#define VSOMEIP_BUSY_POLL_TIME                  0
 
 #define VSOMEIP_MAX_DISPATCHERS                 10
 #define VSOMEIP_MAX_DISPATCH_TIME               100
+#define VSOMEIP_MAX_QUEUED_HANDLERS             1024
 
 #define VSOMEIP_REQUEST_DEBOUNCE_TIME           10
 #define VSOMEIP_DEFAULT_STATISTICS_MAX_MSG      50
@@ -122,6 +133,8 @@
 #define VSOMEIP_UPDATE_SECURITY_CREDENTIALS     0x27
 #define VSOMEIP_DISTRIBUTE_SECURITY_POLICIES    0x28
 #define VSOMEIP_UPDATE_SECURITY_POLICY_INT      0x29
+#define VSOMEIP_REPLAY_STATE                    0x2A
+#define VSOMEIP_BATCH                           0x2B
 
 #define VSOMEIP_SEND_COMMAND_SIZE               13
 #define VSOMEIP_SEND_COMMAND_INSTANCE_POS_MIN   7
@@ -3,12 +3,15 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <fstream>
 #include <functional>
 #include <set>
 #include <sstream>
 #include <limits>
+#include <thread>
 #include <utility>
 
 #define WIN32_LEAN_AND_MEAN
@@ -62,6 +65,7 @@ configuration_impl::configuration_impl()
       sd_cyclic_offer_delay_(VSOMEIP_SD_DEFAULT_CYCLIC_OFFER_DELAY),
       sd_request_response_delay_(VSOMEIP_SD_DEFAULT_REQUEST_RESPONSE_DELAY),
       sd_offer_debounce_time_(VSOMEIP_SD_DEFAULT_OFFER_DEBOUNCE_TIME),
+      sd_processing_threads_(VSOMEIP_SD_DEFAULT_PROCESSING_THREADS),
       max_configured_message_size_(0),
       max_local_message_size_(0),
       max_reliable_message_size_(0),
@@ -86,6 +90,7 @@ configuration_impl::configuration_impl()
       has_issued_methods_warning_(false),
       has_issued_clients_warning_(false),
       udp_receive_buffer_size_(VSOMEIP_DEFAULT_UDP_RCV_BUFFER_SIZE),
+      tcp_coalescing_limit_(VSOMEIP_DEFAULT_TCP_COALESCING_LIMIT),
       npdu_default_debounce_requ_(VSOMEIP_DEFAULT_NPDU_DEBOUNCING_NANO),
       npdu_default_debounce_resp_(VSOMEIP_DEFAULT_NPDU_DEBOUNCING_NANO),
       npdu_default_max_retention_requ_(VSOMEIP_DEFAULT_NPDU_MAXIMUM_RETENTION_NANO),
@@ -97,6 +102,7 @@ configuration_impl::configuration_impl()
       statistics_max_messages_(VSOMEIP_DEFAULT_STATISTICS_MAX_MSG) {
     unicast_ = unicast_.from_string(VSOMEIP_UNICAST_ADDRESS);
     netmask_ = netmask_.from_string(VSOMEIP_NETMASK);
+    index_ = std::make_shared<configuration_index>();
     for (auto i = 0; i < ET_MAX; i++)
         is_configured_[i] = false;
 }
@@ -120,6 +126,7 @@ configuration_impl::configuration_impl(const configuration_impl &_other)
       tcp_restart_aborts_max_(_other.tcp_restart_aborts_max_),
       tcp_connect_time_max_(_other.tcp_connect_time_max_),
       udp_receive_buffer_size_(_other.udp_receive_buffer_size_),
+      tcp_coalescing_limit_(_other.tcp_coalescing_limit_),
       npdu_default_debounce_requ_(_other.npdu_default_debounce_requ_),
       npdu_default_debounce_resp_(_other.npdu_default_debounce_resp_),
       npdu_default_max_retention_requ_(_other.npdu_default_max_retention_requ_),
@@ -159,6 +166,7 @@ configuration_impl::configuration_impl(const configuration_impl &_other)
     sd_cyclic_offer_delay_= _other.sd_cyclic_offer_delay_;
     sd_request_response_delay_= _other.sd_request_response_delay_;
     sd_offer_debounce_time_ = _other.sd_offer_debounce_time_;
+    sd_processing_threads_ = _other.sd_processing_threads_;
 
     trace_ = std::make_shared<trace>(*_other.trace_.get());
     supported_selective_addresses = _other.supported_selective_addresses;
@@ -199,6 +207,9 @@ configuration_impl::configuration_impl(const configuration_impl &_other)
     statistics_interval_ = _other.statistics_interval_;
     statistics_min_freq_ = _other.statistics_min_freq_;
     statistics_max_messages_ = _other.statistics_max_messages_;
+
+    std::lock_guard<std::mutex> its_lock(services_mutex_);
+    update_index();
 }
 
 configuration_impl::~configuration_impl() {
@@ -294,6 +305,11 @@ bool configuration_impl::load(const std::string &_name) {
     // set global unicast address for all services with magic cookies enabled
     set_magic_cookies_unicast_address();
 
+    {
+        std::lock_guard<std::mutex> its_lock(services_mutex_);
+        update_index();
+    }
+
     std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
     VSOMEIP_INFO << "Parsed vsomeip configuration in "
             << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count()
@@ -370,6 +386,7 @@ bool configuration_impl::remote_offer_info_add(service_t _service,
             if (_magic_cookies_enabled) {
                 magic_cookies_[its_service->unicast_address_].insert(its_service->reliable_);
             }
+            update_index();
         }
         ret = true;
     }
@@ -408,6 +425,7 @@ bool configuration_impl::remote_offer_info_remove(service_t _service,
                         found_instance->second->unreliable_ != ILLEGAL_PORT ||
                         found_instance->second->reliable_ != ILLEGAL_PORT);
                 ret = true;
+                update_index();
             }
         }
     }
@@ -417,22 +435,16 @@ bool configuration_impl::remote_offer_info_remove(service_t _service,
 void configuration_impl::read_data(const std::set<std::string> &_input,
         std::vector<configuration_element> &_elements, std::set<std::string> &_failed,
         bool _mandatory_only) {
+    // Collect the names of all files that need to be parsed. Folder contents
+    // are sorted to ensure the merge order does not depend on the file system.
+    std::vector<std::string> its_names;
     for (auto i : _input) {
         if (utility::is_file(i)) {
             if (is_mandatory(i) == _mandatory_only) {
-                boost::property_tree::ptree its_tree;
-                try {
-                    boost::property_tree::json_parser::read_json(i, its_tree);
-                    _elements.push_back({ i, its_tree });
-                }
-                catch (boost::property_tree::json_parser_error &e) {
-    #ifdef _WIN32
-                    e; // silence MSVC warning C4101
-    #endif
-                    _failed.insert(i);
-                }
+                its_names.push_back(i);
             }
         } else if (utility::is_folder(i)) {
+            std::vector<std::string> its_folder_names;
             boost::filesystem::path its_path(i);
             for (auto j = boost::filesystem::directory_iterator(its_path);
                     j != boost::filesystem::directory_iterator();
@@ -441,17 +453,66 @@ void configuration_impl::read_data(const std::set<std::string> &_input,
                 if (!boost::filesystem::is_directory(its_file_path)) {
                     const std::string& its_name = its_file_path.string();
                     if (is_mandatory(its_name) == _mandatory_only) {
-                        boost::property_tree::ptree its_tree;
-                        try {
-                            boost::property_tree::json_parser::read_json(its_name, its_tree);
-                            _elements.push_back({its_name, its_tree});
-                        }
-                        catch (...) {
-                            _failed.insert(its_name);
-                        }
+                        its_folder_names.push_back(its_name);
                     }
                 }
             }
+            std::sort(its_folder_names.begin(), its_folder_names.end());
+            its_names.insert(its_names.end(),
+                    its_folder_names.begin(), its_folder_names.end());
+        }
+    }
+
+    if (its_names.empty())
+        return;
+
+    // Parse the files independently from each other. Each worker writes to
+    // its own slots only, thus no synchronization is needed besides the
+    // shared file index.
+    std::vector<configuration_element> its_elements(its_names.size());
+    std::vector<char> its_results(its_names.size(), 0);
+    std::atomic<std::size_t> its_next(0);
+
+    auto its_parser = [&its_names, &its_elements, &its_results, &its_next]() {
+        std::size_t its_index;
+        while ((its_index = its_next.fetch_add(1)) < its_names.size()) {
+            try {
+                its_elements[its_index].name_ = its_names[its_index];
+                boost::property_tree::json_parser::read_json(
+                        its_names[its_index], its_elements[its_index].tree_);
+                its_results[its_index] = 1;
+            }
+            catch (...) {
+                its_results[its_index] = 0;
+            }
+        }
+    };
+
+    std::size_t its_thread_count(std::thread::hardware_concurrency());
+    if (its_thread_count > VSOMEIP_MAX_CONFIGURATION_PARSER_THREADS)
+        its_thread_count = VSOMEIP_MAX_CONFIGURATION_PARSER_THREADS;
+    if (its_thread_count > its_names.size())
+        its_thread_count = its_names.size();
+
+    std::vector<std::thread> its_workers;
+    try {
+        for (std::size_t i = 1; i < its_thread_count; i++)
+            its_workers.emplace_back(its_parser);
+    }
+    catch (const std::system_error &e) {
+        VSOMEIP_WARNING << "Parsing configuration files sequentially ("
+                << e.what() << ")";
+    }
+    its_parser();
+    for (auto &w : its_workers)
+        w.join();
+
+    // Merge in input order to keep the result deterministic
+    for (std::size_t i = 0; i < its_names.size(); i++) {
+        if (its_results[i]) {
+            _elements.push_back(std::move(its_elements[i]));
+        } else {
+            _failed.insert(its_names[i]);
         }
     }
 }
@@ -491,6 +552,7 @@ bool configuration_impl::load_data(const std::vector<configuration_element> &_el
             load_security(e);
             load_tracing(e);
             load_udp_receive_buffer_size(e);
+            load_tcp_coalescing_limit(e);
         }
     }
 
@@ -674,6 +736,10 @@ void configuration_impl::load_application_data(
     std::map<plugin_type_e, std::set<std::string>> plugins;
     int its_io_thread_nice_level(VSOMEIP_IO_THREAD_NICE_LEVEL);
     std::string its_overlay;
+    bool is_io_uring_enabled(false);
+    std::size_t its_busy_poll_time(VSOMEIP_BUSY_POLL_TIME);
+    bool has_inline_handlers(false);
+    std::size_t its_max_queued_handlers(VSOMEIP_MAX_QUEUED_HANDLERS);
 #ifdef VSOMEIP_HAS_SESSION_HANDLING_CONFIG
     bool has_session_handling(true);
 #endif // VSOMEIP_HAS_SESSION_HANDLING_CONFIG
@@ -720,6 +786,20 @@ void configuration_impl::load_application_data(
             plugins = load_plugins(i->second, its_name);
         } else if (its_key == "overlay") {
             its_overlay = its_value;
+        } else if (its_key == "io_uring") {
+            is_io_uring_enabled = (its_value == "true");
+        } else if (its_key == "busy_poll") {
+            its_converter << std::dec << its_value;
+            its_converter >> its_busy_poll_time;
+        } else if (its_key == "inline_handlers") {
+            has_inline_handlers = (its_value == "true");
+        } else if (its_key == "max_queued_handlers") {
+            its_converter << std::dec << its_value;
+            its_converter >> its_max_queued_handlers;
+            if (its_max_queued_handlers == 0) {
+                VSOMEIP_WARNING << "Min. number of queued handlers is 1";
+                its_max_queued_handlers = 1;
+            }
         }
 #ifdef VSOMEIP_HAS_SESSION_HANDLING_CONFIG
         else if (its_key == "has_session_handling") {
@@ -744,7 +824,8 @@ void configuration_impl::load_application_data(
                 = std::make_tuple(its_id, its_max_dispatchers,
                         its_max_dispatch_time, its_io_thread_count,
                         its_request_debounce_time, plugins, its_io_thread_nice_level,
-                        its_overlay
+                        its_overlay, is_io_uring_enabled, its_busy_poll_time,
+                        has_inline_handlers, its_max_queued_handlers
 #ifdef VSOMEIP_HAS_SESSION_HANDLING_CONFIG
                         , has_session_handling
 #endif // VSOMEIP_HAS_SESSION_HANDLING_CONFIG
@@ -1304,6 +1385,15 @@ void configuration_impl::load_service_discovery(
                     its_converter >> sd_offer_debounce_time_;
                     is_configured_[ET_SERVICE_DISCOVERY_OFFER_DEBOUNCE_TIME] = true;
                 }
+            } else if (its_key == "processing_threads") {
+                if (!is_overlay_ && is_configured_[ET_SERVICE_DISCOVERY_PROCESSING_THREADS]) {
+                    VSOMEIP_WARNING << "Multiple definitions for service_discovery.processing_threads."
+                    " Ignoring definition from " << _element.name_;
+                } else {
+                    its_converter << its_value;
+                    its_converter >> sd_processing_threads_;
+                    is_configured_[ET_SERVICE_DISCOVERY_PROCESSING_THREADS] = true;
+                }
             } else if (its_key == "ttl_factor_offers") {
                 if (!is_overlay_ && is_configured_[ET_SERVICE_DISCOVERY_TTL_FACTOR_OFFERS]) {
                     VSOMEIP_WARNING << "Multiple definitions for service_discovery.ttl_factor_offers."
@@ -2146,16 +2236,49 @@ void configuration_impl::set_magic_cookies_unicast_address() {
 
 bool configuration_impl::is_internal_service(service_t _service,
         instance_t _instance) const {
-
-    for (auto its_range : internal_service_ranges_) {
-        if (_service >= its_range.first_service_ &&
-                _service <= its_range.last_service_ &&
-                _instance >= its_range.first_instance_ &&
-                _instance <= its_range.last_instance_) {
-            return true;
+    return get_index()->is_internal(_service, _instance);
+}
+
+// Must be called with services_mutex_ being locked.
+void configuration_impl::update_index() {
+    auto its_index = std::make_shared<configuration_index>();
+    const std::string its_unicast(get_unicast_address().to_string());
+    for (const auto &s : services_) {
+        for (const auto &i : s.second) {
+            const std::shared_ptr<service> &its_service(i.second);
+            configuration_index::entry its_entry;
+            its_entry.service_ = its_service;
+            its_entry.reliable_ = its_service->reliable_;
+            its_entry.unreliable_ = its_service->unreliable_;
+            its_entry.major_ = its_service->major_;
+            its_entry.minor_ = its_service->minor_;
+            its_entry.ttl_ = its_service->ttl_;
+            its_entry.is_local_ = !is_remote(its_service);
+            its_entry.is_someip_ = (its_service->protocol_ == "someip");
+            its_entry.unicast_address_ = its_service->unicast_address_;
+            if (its_entry.unicast_address_ == default_unicast_
+                    || its_entry.unicast_address_ == "") {
+                its_entry.unicast_address_ = its_unicast;
+            }
+            its_index->add_service(s.first, i.first, its_entry);
         }
     }
-    return false;
+    for (const auto &a : services_by_ip_port_) {
+        for (const auto &p : a.second) {
+            for (const auto &s : p.second) {
+                its_index->add_service(s.first, a.first, p.first, s.second.get());
+            }
+        }
+    }
+    for (const auto &r : internal_service_ranges_)
+        its_index->add_internal_range(r);
+
+    std::atomic_store(&index_,
+            std::shared_ptr<const configuration_index>(its_index));
+}
+
+std::shared_ptr<const configuration_index> configuration_impl::get_index() const {
+    return std::atomic_load(&index_);
 }
 
 bool configuration_impl::is_in_port_range(uint16_t _port,
@@ -2225,36 +2348,32 @@ vsomeip_v3::logger::level_e configuration_impl::get_loglevel() const {
 
 std::string configuration_impl::get_unicast_address(service_t _service,
         instance_t _instance) const {
-    std::string its_unicast_address("");
-    auto its_service = find_service(_service, _instance);
-    if (its_service) {
-        its_unicast_address = its_service->unicast_address_;
-    }
+    const auto its_index = get_index();
+    const auto its_entry = its_index->find(_service, _instance);
+    if (its_entry)
+        return its_entry->unicast_address_;
 
-    if (its_unicast_address == default_unicast_ || its_unicast_address == "") {
-            its_unicast_address = get_unicast_address().to_string();
-    }
-    return its_unicast_address;
+    return get_unicast_address().to_string();
 }
 
 uint16_t configuration_impl::get_reliable_port(service_t _service,
         instance_t _instance) const {
-    std::lock_guard<std::mutex> its_lock(services_mutex_);
     uint16_t its_reliable(ILLEGAL_PORT);
-    auto its_service = find_service_unlocked(_service, _instance);
-    if (its_service)
-        its_reliable = its_service->reliable_;
+    const auto its_index = get_index();
+    const auto its_entry = its_index->find(_service, _instance);
+    if (its_entry)
+        its_reliable = its_entry->reliable_;
 
     return its_reliable;
 }
 
 uint16_t configuration_impl::get_unreliable_port(service_t _service,
         instance_t _instance) const {
-    std::lock_guard<std::mutex> its_lock(services_mutex_);
     uint16_t its_unreliable = ILLEGAL_PORT;
-     auto its_service = find_service_unlocked(_service, _instance);
-    if (its_service)
-        its_unreliable = its_service->unreliable_;
+    const auto its_index = get_index();
+    const auto its_entry = its_index->find(_service, _instance);
+    if (its_entry)
+        its_unreliable = its_entry->unreliable_;
 
     return its_unreliable;
 }
@@ -2305,42 +2424,43 @@ void configuration_impl::get_configured_timing_responses(
 
 major_version_t configuration_impl::get_major_version(service_t _service,
         instance_t _instance) const {
-    std::lock_guard<std::mutex> its_lock(services_mutex_);
     major_version_t its_major = DEFAULT_MAJOR;
-    auto its_service = find_service_unlocked(_service, _instance);
-    if (its_service)
-        its_major = its_service->major_;
+    const auto its_index = get_index();
+    const auto its_entry = its_index->find(_service, _instance);
+    if (its_entry)
+        its_major = its_entry->major_;
 
     return its_major;
 }
 
 minor_version_t configuration_impl::get_minor_version(service_t _service,
         instance_t _instance) const {
-    std::lock_guard<std::mutex> its_lock(services_mutex_);
     minor_version_t its_minor = DEFAULT_MINOR;
-    auto its_service = find_service_unlocked(_service, _instance);
-    if (its_service)
-        its_minor = its_service->minor_;
+    const auto its_index = get_index();
+    const auto its_entry = its_index->find(_service, _instance);
+    if (its_entry)
+        its_minor = its_entry->minor_;
 
     return its_minor;
 }
 
 ttl_t configuration_impl::get_ttl(service_t _service,
         instance_t _instance) const {
-    std::lock_guard<std::mutex> its_lock(services_mutex_);
     ttl_t its_ttl = DEFAULT_TTL;
-    auto its_service = find_service_unlocked(_service, _instance);
-    if (its_service)
-        its_ttl = its_service->ttl_;
+    const auto its_index = get_index();
+    const auto its_entry = its_index->find(_service, _instance);
+    if (its_entry)
+        its_ttl = its_entry->ttl_;
 
     return its_ttl;
 }
 
 bool configuration_impl::is_someip(service_t _service,
         instance_t _instance) const {
-    auto its_service = find_service(_service, _instance);
-    if (its_service)
-        return (its_service->protocol_ == "someip");
+    const auto its_index = get_index();
+    const auto its_entry = its_index->find(_service, _instance);
+    if (its_entry)
+        return its_entry->is_someip_;
     return true; // we need to explicitely configure a service to
                  // be something else than SOME/IP
 }
@@ -2458,6 +2578,48 @@ int configuration_impl::get_io_thread_nice_level(const std::string &_name) const
     return its_io_thread_nice_level;
 }
 
+bool configuration_impl::is_io_uring_enabled(const std::string &_name) const {
+    bool its_value(false);
+
+    auto found_application = applications_.find(_name);
+    if (found_application != applications_.end())
+        its_value = std::get<8>(found_application->second);
+
+    return its_value;
+}
+
+std::size_t configuration_impl::get_busy_poll_time(
+        const std::string &_name) const {
+    std::size_t its_busy_poll_time(VSOMEIP_BUSY_POLL_TIME);
+
+    auto found_application = applications_.find(_name);
+    if (found_application != applications_.end())
+        its_busy_poll_time = std::get<9>(found_application->second);
+
+    return its_busy_poll_time;
+}
+
+bool configuration_impl::has_inline_handlers(const std::string &_name) const {
+    bool its_value(false);
+
+    auto found_application = applications_.find(_name);
+    if (found_application != applications_.end())
+        its_value = std::get<10>(found_application->second);
+
+    return its_value;
+}
+
+std::size_t configuration_impl::get_max_queued_handlers(
+        const std::string &_name) const {
+    std::size_t its_max_queued_handlers(VSOMEIP_MAX_QUEUED_HANDLERS);
+
+    auto found_application = applications_.find(_name);
+    if (found_application != applications_.end())
+        its_max_queued_handlers = std::get<11>(found_application->second);
+
+    return its_max_queued_handlers;
+}
+
 std::size_t configuration_impl::get_max_dispatchers(
         const std::string &_name) const {
     std::size_t its_max_dispatchers = VSOMEIP_MAX_DISPATCHERS;
@@ -2488,7 +2650,7 @@ bool configuration_impl::has_session_handling(const std::string &_name) const {
 
     auto found_application = applications_.find(_name);
     if (found_application != applications_.end())
-        its_value = std::get<8>(found_application->second);
+        its_value = std::get<12>(found_application->second);
 
     return (its_value);
 }
@@ -2648,12 +2810,12 @@ configuration_impl::get_event_reliability(service_t _service,
 reliability_type_e
 configuration_impl::get_service_reliability(service_t _service,
         instance_t _instance) const {
-    std::lock_guard<std::mutex> its_lock(services_mutex_);
     reliability_type_e its_reliability(reliability_type_e::RT_UNKNOWN);
-    auto its_service = find_service_unlocked(_service, _instance);
-    if (its_service) {
-        if (its_service->reliable_ != ILLEGAL_PORT) {
-            if (its_service->unreliable_ != ILLEGAL_PORT) {
+    const auto its_index = get_index();
+    const auto its_entry = its_index->find(_service, _instance);
+    if (its_entry) {
+        if (its_entry->reliable_ != ILLEGAL_PORT) {
+            if (its_entry->unreliable_ != ILLEGAL_PORT) {
                 its_reliability = reliability_type_e::RT_BOTH;
             } else {
                 its_reliability = reliability_type_e::RT_RELIABLE;
@@ -2686,18 +2848,8 @@ std::shared_ptr<service> configuration_impl::find_service_unlocked(service_t _se
 
 service* configuration_impl::find_service_by_ip_port(
         service_t _service, const std::string& _ip, std::uint16_t _port) const {
-    service *its_service(0);
-    auto find_ip = services_by_ip_port_.find(_ip);
-    if(find_ip != services_by_ip_port_.end()) {
-        auto find_port = find_ip->second.find(_port);
-        if(find_port != find_ip->second.end()) {
-            auto find_service = find_port->second.find(_service);
-            if(find_service != find_port->second.end()) {
-                its_service = find_service->second.get();
-            }
-        }
-    }
-    return its_service;
+    // The services are kept alive by services_
+    return get_index()->find(_service, _ip, _port);
 }
 
 std::shared_ptr<eventgroup> configuration_impl::find_eventgroup(
@@ -2775,21 +2927,20 @@ uint32_t configuration_impl::get_log_version_interval() const {
 }
 
 bool configuration_impl::is_offered_remote(service_t _service, instance_t _instance) const {
-    uint16_t reliable_port = get_reliable_port(_service, _instance);
-    uint16_t unreliable_port = get_unreliable_port(_service, _instance);
-    return (reliable_port != ILLEGAL_PORT || unreliable_port != ILLEGAL_PORT);
+    const auto its_index = get_index();
+    const auto its_entry = its_index->find(_service, _instance);
+    return (its_entry && (its_entry->reliable_ != ILLEGAL_PORT
+            || its_entry->unreliable_ != ILLEGAL_PORT));
 }
 
 bool configuration_impl::is_local_service(service_t _service, instance_t _instance) const {
-    std::shared_ptr<service> s = find_service(_service, _instance);
-    if (s && !is_remote(s)) {
-        return true;
-    }
-    if (is_internal_service(_service, _instance)) {
+    const auto its_index = get_index();
+    const auto its_entry = its_index->find(_service, _instance);
+    if (its_entry && its_entry->is_local_) {
         return true;
     }
 
-    return false;
+    return its_index->is_internal(_service, _instance);
 }
 
 // Service Discovery configuration
@@ -2841,6 +2992,10 @@ std::uint32_t configuration_impl::get_sd_offer_debounce_time() const {
     return sd_offer_debounce_time_;
 }
 
+std::uint32_t configuration_impl::get_sd_processing_threads() const {
+    return sd_processing_threads_;
+}
+
 // Trace configuration
 std::shared_ptr<cfg::trace> configuration_impl::get_trace() const {
     return trace_;
@@ -3585,6 +3740,30 @@ configuration_impl::load_udp_receive_buffer_size(const configuration_element &_e
     }
 }
 
+void
+configuration_impl::load_tcp_coalescing_limit(const configuration_element &_element) {
+    const std::string tcl("tcp-coalescing-limit");
+    try {
+        if (_element.tree_.get_child_optional(tcl)) {
+            if (is_configured_[ET_TCP_COALESCING_LIMIT]) {
+                VSOMEIP_WARNING << "Multiple definitions of " << tcl
+                        << " Ignoring definition from " << _element.name_;
+            } else {
+                const std::string s(_element.tree_.get_child(tcl).data());
+                try {
+                    tcp_coalescing_limit_ = static_cast<std::uint32_t>(std::stoul(
+                            s.c_str(), NULL, 10));
+                } catch (const std::exception &e) {
+                    VSOMEIP_ERROR<< __func__ << ": " << tcl << " " << e.what();
+                }
+                is_configured_[ET_TCP_COALESCING_LIMIT] = true;
+            }
+        }
+    } catch (...) {
+        // intentionally left empty
+    }
+}
+
 void configuration_impl::load_secure_services(const configuration_element &_element) {
     std::lock_guard<std::mutex> its_lock(secure_services_mutex_);
     try {
@@ -3925,6 +4104,10 @@ std::uint32_t configuration_impl::get_udp_receive_buffer_size() const {
     return udp_receive_buffer_size_;
 }
 
+std::uint32_t configuration_impl::get_tcp_coalescing_limit() const {
+    return tcp_coalescing_limit_;
+}
+
 bool configuration_impl::tp_segment_messages_client_to_service(
         service_t _service, std::string _ip_target, std::uint16_t _port_target,
         method_t _method) const {
@@ -3977,6 +4160,9 @@ configuration_impl::load_overlay(const std::string &_name) {
 
         is_overlay_ = true;
         load_data(its_elements, true, true);
+
+        std::lock_guard<std::mutex> its_lock(services_mutex_);
+        update_index();
     }
 }
 #endif // VSOMEIP_ENABLE_CONFIGURATION_OVERLAYS
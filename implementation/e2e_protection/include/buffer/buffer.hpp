@@ -32,15 +32,53 @@ class buffer_view {
         : data_ptr_(_buffer.data() + _begin), data_length_(_end - _begin) {
     }
 
+    buffer_view(const buffer_view &_buffer, size_t _length)
+        : data_ptr_(_buffer.data_ptr_), data_length_(_length) {
+    }
+
+    buffer_view(const buffer_view &_buffer, size_t _begin, size_t _end)
+        : data_ptr_(_buffer.data_ptr_ + _begin), data_length_(_end - _begin) {
+    }
+
     const uint8_t *begin(void) const { return data_ptr_; }
 
     const uint8_t *end(void) const { return data_ptr_ + data_length_; }
 
+    size_t size(void) const { return data_length_; }
+
+    const uint8_t &operator[](size_t _index) const { return data_ptr_[_index]; }
+
 private:
     const uint8_t *data_ptr_;
     size_t data_length_;
 };
 
+// Writable view, used to protect messages within the buffer they are
+// sent from. As for buffer_view, the data is not owned.
+class mutable_buffer_view {
+  public:
+    mutable_buffer_view(uint8_t *_data_ptr, size_t _data_length)
+        : data_ptr_(_data_ptr), data_length_(_data_length) {
+    }
+
+    mutable_buffer_view(e2e_buffer &_buffer)
+        : data_ptr_(_buffer.data()), data_length_(_buffer.size()) {}
+
+    uint8_t *begin(void) const { return data_ptr_; }
+
+    uint8_t *end(void) const { return data_ptr_ + data_length_; }
+
+    size_t size(void) const { return data_length_; }
+
+    uint8_t &operator[](size_t _index) const { return data_ptr_[_index]; }
+
+    operator buffer_view() const { return buffer_view(data_ptr_, data_length_); }
+
+private:
+    uint8_t *data_ptr_;
+    size_t data_length_;
+};
+
 std::ostream &operator<<(std::ostream &_os, const e2e_buffer &_buffer);
 
 } // namespace vsomeip_v3
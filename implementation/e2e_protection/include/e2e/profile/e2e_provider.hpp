@@ -27,9 +27,9 @@ public:
     virtual std::size_t get_protection_base(e2exf::data_identifier_t _id) const = 0;
 
     virtual void protect(e2exf::data_identifier_t id,
-            e2e_buffer &_buffer, instance_t _instance) = 0;
+            const mutable_buffer_view &_buffer, instance_t _instance) = 0;
     virtual void check(e2exf::data_identifier_t id,
-            const e2e_buffer &_buffer, instance_t _instance,
+            const buffer_view &_buffer, instance_t _instance,
             e2e::profile_interface::check_status_t &_generic_check_status) = 0;
 };
 
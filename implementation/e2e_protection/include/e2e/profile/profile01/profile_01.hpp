@@ -20,9 +20,9 @@ struct profile_config;
 
 class profile_01 {
   public:
-    static uint8_t compute_crc(const profile_config &_config, const e2e_buffer &_buffer);
+    static uint8_t compute_crc(const profile_config &_config, const buffer_view &_buffer);
 
-    static bool is_buffer_length_valid(const profile_config &_config, const e2e_buffer &_buffer);
+    static bool is_buffer_length_valid(const profile_config &_config, const buffer_view &_buffer);
 };
 
 // [SWS_E2E_00200]
@@ -21,15 +21,15 @@ public:
 
     explicit protector(const profile_config &_config) : config_(_config), counter_(0) {};
 
-    void protect(e2e_buffer &_buffer, instance_t _instance) override final;
+    void protect(const mutable_buffer_view &_buffer, instance_t _instance) override final;
 
 private:
 
-    void write_counter(e2e_buffer &_buffer);
+    void write_counter(const mutable_buffer_view &_buffer);
 
-    void write_data_id(e2e_buffer &_buffer);
+    void write_data_id(const mutable_buffer_view &_buffer);
 
-    void write_crc(e2e_buffer &_buffer, uint8_t _computed_crc);
+    void write_crc(const mutable_buffer_view &_buffer, uint8_t _computed_crc);
 
     void increment_counter(void);
 
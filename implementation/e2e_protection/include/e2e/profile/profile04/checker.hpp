@@ -22,15 +22,15 @@ public:
     explicit profile_04_checker(const profile_config &_config) :
             config_(_config), counter_(0xffff) {}
 
-    void check(const e2e_buffer &_buffer, instance_t _instance,
+    void check(const buffer_view &_buffer, instance_t _instance,
             e2e::profile_interface::check_status_t &_generic_check_status) override final;
 
 private:
-    bool verify_input(const e2e_buffer &_buffer) const;
+    bool verify_input(const buffer_view &_buffer) const;
     bool verify_counter(uint16_t _received_counter) const;
 
-    bool read_16(const e2e_buffer &_buffer, uint16_t &_data, size_t _index) const;
-    bool read_32(const e2e_buffer &_buffer, uint32_t &_data, size_t _index) const;
+    bool read_16(const buffer_view &_buffer, uint16_t &_data, size_t _index) const;
+    bool read_32(const buffer_view &_buffer, uint32_t &_data, size_t _index) const;
 
     std::mutex check_mutex_;
 
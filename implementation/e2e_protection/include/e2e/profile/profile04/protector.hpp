@@ -21,14 +21,14 @@ public:
     explicit protector(const profile_config &_config)
         : config_(_config), counter_(0) {};
 
-    void protect(e2e_buffer &_buffer, instance_t _instance) override final;
+    void protect(const mutable_buffer_view &_buffer, instance_t _instance) override final;
 
 private:
-    bool verify_inputs(e2e_buffer &_buffer);
+    bool verify_inputs(const mutable_buffer_view &_buffer);
     void increment_counter();
 
-    void write_16(e2e_buffer &_buffer, uint16_t _data, size_t _index);
-    void write_32(e2e_buffer &_buffer, uint32_t _data, size_t _index);
+    void write_16(const mutable_buffer_view &_buffer, uint16_t _data, size_t _index);
+    void write_32(const mutable_buffer_view &_buffer, uint32_t _data, size_t _index);
 
 private:
     profile_config config_;
@@ -20,11 +20,11 @@ public:
 
     explicit protector(const profile_config &_config) : config_(_config){};
 
-    void protect(e2e_buffer &_buffer, instance_t _instance) override final;
+    void protect(const mutable_buffer_view &_buffer, instance_t _instance) override final;
 
 private:
 
-    void write_crc(e2e_buffer &_buffer, uint32_t _computed_crc);
+    void write_crc(const mutable_buffer_view &_buffer, uint32_t _computed_crc);
 
 private:
     profile_config config_;
@@ -104,7 +104,7 @@ std::size_t e2e_provider_impl::get_protection_base(e2exf::data_identifier_t id)
     return (0);
 }
 
-void e2e_provider_impl::protect(e2exf::data_identifier_t id, e2e_buffer &_buffer,
+void e2e_provider_impl::protect(e2exf::data_identifier_t id, const mutable_buffer_view &_buffer,
         instance_t _instance)
 {
     auto protector = custom_protectors_.find(id);
@@ -114,7 +114,7 @@ void e2e_provider_impl::protect(e2exf::data_identifier_t id, e2e_buffer &_buffer
 }
 
 void e2e_provider_impl::check(e2exf::data_identifier_t id,
-        const e2e_buffer &_buffer, instance_t _instance,
+        const buffer_view &_buffer, instance_t _instance,
         profile_interface::check_status_t &_generic_check_status)
 {
     auto checker = custom_checkers_.find(id);
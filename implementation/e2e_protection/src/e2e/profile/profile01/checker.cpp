@@ -16,7 +16,7 @@ namespace e2e {
 namespace profile01 {
 
 // [SWS_E2E_00196]
-void profile_01_checker::check(const e2e_buffer &_buffer, instance_t _instance,
+void profile_01_checker::check(const buffer_view &_buffer, instance_t _instance,
         e2e::profile_interface::check_status_t &_generic_check_status) {
 
     (void)_instance;
@@ -14,11 +14,13 @@ namespace vsomeip_v3 {
 namespace e2e {
 namespace profile01 {
 
-uint8_t profile_01::compute_crc(const profile_config &_config, const e2e_buffer &_buffer) {
+uint8_t profile_01::compute_crc(const profile_config &_config, const buffer_view &_buffer) {
     uint8_t computed_crc = 0xFF;
-    e2e_buffer data_id_buffer; //(_data, _data+_size);
-    data_id_buffer.push_back((uint8_t) (_config.data_id_ >> 8)); // insert MSB
-    data_id_buffer.push_back((uint8_t) _config.data_id_);        // insert LSB
+    const uint8_t data_id_buffer[2] = {
+        (uint8_t) (_config.data_id_ >> 8), // MSB
+        (uint8_t) _config.data_id_         // LSB
+    };
+    const uint8_t zero_buffer[1] = { 0x00 };
 
     switch (_config.data_id_mode_) {
         case p01_data_id_mode::E2E_P01_DATAID_BOTH: // CRC over 2 bytes
@@ -26,10 +28,10 @@ uint8_t profile_01::compute_crc(const profile_config &_config, const e2e_buffer
              * Two bytes are included in the CRC (double ID configuration) This is used in E2E variant 1A.
              */
             // CRC = Crc_CalculateCRC8(Config->DataID, 1, 0xFF, FALSE)
-            computed_crc = e2e_crc::calculate_profile_01(buffer_view(data_id_buffer, 1, 2), 0xFF); //CRC over low byte of Data ID (LSB)
+            computed_crc = e2e_crc::calculate_profile_01(buffer_view(&data_id_buffer[1], 1), 0xFF); //CRC over low byte of Data ID (LSB)
 
             // CRC = Crc_CalculateCRC8(Config->DataID >> 8,  1, CRC, FALSE)
-            computed_crc = e2e_crc::calculate_profile_01(buffer_view(data_id_buffer, 0, 1), computed_crc); //CRC over high byte of Data ID (MSB)
+            computed_crc = e2e_crc::calculate_profile_01(buffer_view(&data_id_buffer[0], 1), computed_crc); //CRC over high byte of Data ID (MSB)
 
             break;
         case p01_data_id_mode::E2E_P01_DATAID_LOW: // CRC over low byte only
@@ -38,7 +40,7 @@ uint8_t profile_01::compute_crc(const profile_config &_config, const e2e_buffer
              * This is applicable if the IDs in a particular system are 8 bits
              */
             // CRC = Crc_CalculateCRC8(Config->DataID, 1, 0xFF, FALSE)
-            computed_crc = e2e_crc::calculate_profile_01(buffer_view(data_id_buffer, 1, 2), 0xFF); //CRC over low byte of Data ID (LSB)
+            computed_crc = e2e_crc::calculate_profile_01(buffer_view(&data_id_buffer[1], 1), 0xFF); //CRC over low byte of Data ID (LSB)
             break;
 
         case p01_data_id_mode::E2E_P01_DATAID_ALT:
@@ -67,12 +69,10 @@ uint8_t profile_01::compute_crc(const profile_config &_config, const e2e_buffer
              * up to 12 bits. This is used in E2E variant 1C.
              */
             // CRC = Crc_CalculateCRC8(Config->DataID, 1, 0xFF, FALSE)
-            computed_crc = e2e_crc::calculate_profile_01(buffer_view(data_id_buffer, 1, 2), 0xFF); //CRC over low byte of Data ID (LSB)
+            computed_crc = e2e_crc::calculate_profile_01(buffer_view(&data_id_buffer[1], 1), 0xFF); //CRC over low byte of Data ID (LSB)
 
             // CRC = Crc_CalculateCRC8 (0, 1, CRC, FALSE)
-            data_id_buffer.clear();
-            data_id_buffer.push_back(0x00);
-            computed_crc = e2e_crc::calculate_profile_01(buffer_view(data_id_buffer, 0, 1), computed_crc); // CRC with 0x00
+            computed_crc = e2e_crc::calculate_profile_01(buffer_view(zero_buffer, 1), computed_crc); // CRC with 0x00
             break;
 
         default:
@@ -98,7 +98,7 @@ uint8_t profile_01::compute_crc(const profile_config &_config, const e2e_buffer
 }
 
 /** @req [SWS_E2E_00356] */
-bool profile_01::is_buffer_length_valid(const profile_config &_config, const e2e_buffer &_buffer) {
+bool profile_01::is_buffer_length_valid(const profile_config &_config, const buffer_view &_buffer) {
     return (((_config.data_length_ / 8) + 1U <= _buffer.size())
             && _config.crc_offset_ <= _buffer.size()
             && _config.counter_offset_ / 8 <= _buffer.size()
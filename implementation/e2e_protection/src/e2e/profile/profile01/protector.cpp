@@ -16,7 +16,7 @@ namespace e2e {
 namespace profile01 {
 
 /** @req [SWS_E2E_00195] */
-void protector::protect(e2e_buffer &_buffer, instance_t _instance) {
+void protector::protect(const mutable_buffer_view &_buffer, instance_t _instance) {
 
     (void)_instance;
 
@@ -40,7 +40,7 @@ void protector::protect(e2e_buffer &_buffer, instance_t _instance) {
 }
 
 /** @req [SRS_E2E_08528] */
-void protector::write_counter(e2e_buffer &_buffer) {
+void protector::write_counter(const mutable_buffer_view &_buffer) {
     if (config_.counter_offset_ % 8 == 0) {
         // write write counter value into low nibble
         _buffer[config_.counter_offset_ / 8] =
@@ -53,7 +53,7 @@ void protector::write_counter(e2e_buffer &_buffer) {
 }
 
 /** @req [SRS_E2E_08528] */
-void protector::write_data_id(e2e_buffer &_buffer) {
+void protector::write_data_id(const mutable_buffer_view &_buffer) {
     if (config_.data_id_mode_ == p01_data_id_mode::E2E_P01_DATAID_NIBBLE) {
         if (config_.data_id_nibble_offset_ % 8 == 0) {
             // write low nibble of high byte of Data ID
@@ -68,7 +68,7 @@ void protector::write_data_id(e2e_buffer &_buffer) {
 }
 
 /** @req [SRS_E2E_08528] */
-void protector::write_crc(e2e_buffer &_buffer, uint8_t _computed_crc) {
+void protector::write_crc(const mutable_buffer_view &_buffer, uint8_t _computed_crc) {
     _buffer[config_.crc_offset_] = _computed_crc;
 }
 
@@ -16,7 +16,7 @@ namespace e2e {
 namespace profile04 {
 
 // [SWS_E2E_00355]
-void profile_04_checker::check(const e2e_buffer &_buffer, instance_t _instance,
+void profile_04_checker::check(const buffer_view &_buffer, instance_t _instance,
         e2e::profile_interface::check_status_t &_generic_check_status) {
 
     std::lock_guard<std::mutex> lock(check_mutex_);
@@ -64,7 +64,7 @@ void profile_04_checker::check(const e2e_buffer &_buffer, instance_t _instance,
 }
 
 bool
-profile_04_checker::verify_input(const e2e_buffer &_buffer) const {
+profile_04_checker::verify_input(const buffer_view &_buffer) const {
 
     auto its_length = _buffer.size();
     return (its_length >= config_.min_data_length_
@@ -90,7 +90,7 @@ profile_04_checker::verify_counter(uint16_t _received_counter) const {
 }
 
 bool
-profile_04_checker::read_16(const e2e_buffer &_buffer,
+profile_04_checker::read_16(const buffer_view &_buffer,
         uint16_t &_data, size_t _index) const {
 
     _data = VSOMEIP_BYTES_TO_WORD(_buffer[config_.offset_ + _index],
@@ -99,7 +99,7 @@ profile_04_checker::read_16(const e2e_buffer &_buffer,
 }
 
 bool
-profile_04_checker::read_32(const e2e_buffer &_buffer,
+profile_04_checker::read_32(const buffer_view &_buffer,
         uint32_t &_data, size_t _index) const {
 
     _data = VSOMEIP_BYTES_TO_LONG(_buffer[config_.offset_ + _index],
@@ -16,7 +16,7 @@ namespace profile04 {
 
 /** @req [SWS_E2E_00195] */
 void
-protector::protect(e2e_buffer &_buffer, instance_t _instance) {
+protector::protect(const mutable_buffer_view &_buffer, instance_t _instance) {
     std::lock_guard<std::mutex> lock(protect_mutex_);
 
     if (_instance > VSOMEIP_E2E_PROFILE04_MAX_INSTANCE) {
@@ -49,21 +49,21 @@ protector::protect(e2e_buffer &_buffer, instance_t _instance) {
 }
 
 bool
-protector::verify_inputs(e2e_buffer &_buffer) {
+protector::verify_inputs(const mutable_buffer_view &_buffer) {
 
     return (_buffer.size() >= config_.min_data_length_
             && _buffer.size() <= config_.max_data_length_);
 }
 
 void
-protector::write_16(e2e_buffer &_buffer, uint16_t _data, size_t _index) {
+protector::write_16(const mutable_buffer_view &_buffer, uint16_t _data, size_t _index) {
 
     _buffer[config_.offset_ + _index] = VSOMEIP_WORD_BYTE1(_data);
     _buffer[config_.offset_ + _index + 1] = VSOMEIP_WORD_BYTE0(_data);
 }
 
 void
-protector::write_32(e2e_buffer &_buffer, uint32_t _data, size_t _index) {
+protector::write_32(const mutable_buffer_view &_buffer, uint32_t _data, size_t _index) {
 
     _buffer[config_.offset_ + _index] = VSOMEIP_LONG_BYTE3(_data);
     _buffer[config_.offset_ + _index + 1] = VSOMEIP_LONG_BYTE2(_data);
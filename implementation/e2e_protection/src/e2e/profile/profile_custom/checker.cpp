@@ -15,7 +15,7 @@ namespace vsomeip_v3 {
 namespace e2e {
 namespace profile_custom {
 
-void profile_custom_checker::check(const e2e_buffer &_buffer,
+void profile_custom_checker::check(const buffer_view &_buffer,
         instance_t _instance,
         e2e::profile_interface::check_status_t &_generic_check_status) {
 
@@ -40,7 +40,7 @@ void profile_custom_checker::check(const e2e_buffer &_buffer,
     }
 }
 
-uint32_t profile_custom_checker::read_crc(const e2e_buffer &_buffer) const {
+uint32_t profile_custom_checker::read_crc(const buffer_view &_buffer) const {
     return (static_cast<uint32_t>(_buffer[config_.crc_offset_ ]) << 24U) |
            (static_cast<uint32_t>(_buffer[config_.crc_offset_ + 1U]) << 16U) |
            (static_cast<uint32_t>(_buffer[config_.crc_offset_ + 2U]) << 8U) |
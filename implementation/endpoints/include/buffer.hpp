@@ -8,6 +8,7 @@
 
 #include <array>
 #include <chrono>
+#include <deque>
 #include <memory>
 #include <set>
 
@@ -36,28 +37,93 @@ struct timing {
 };
 
 struct train {
-    train(boost::asio::io_service& _io) : buffer_(std::make_shared<message_buffer_t>()),
+    train() : buffer_(std::make_shared<message_buffer_t>()),
               departure_(DEFAULT_NANOSECONDS_MAX),
               minimal_debounce_time_(DEFAULT_NANOSECONDS_MAX),
               minimal_max_retention_time_(DEFAULT_NANOSECONDS_MAX),
               last_departure_(std::chrono::steady_clock::now() - std::chrono::hours(1)),
-              departure_timer_(std::make_shared<boost::asio::steady_timer>(_io)) {};
+              departure_time_(std::chrono::steady_clock::time_point::max()),
+              scheduled_(std::chrono::steady_clock::time_point::max()) {};
 
     message_buffer_ptr_t buffer_;
     std::chrono::nanoseconds departure_;
     std::chrono::nanoseconds minimal_debounce_time_;
     std::chrono::nanoseconds minimal_max_retention_time_;
     std::chrono::steady_clock::time_point last_departure_;
-    std::shared_ptr<boost::asio::steady_timer> departure_timer_;
     std::set<std::pair<service_t, method_t> > passengers_;
 
-    void update_departure_time_and_stop_departure() {
-        departure_ = departure_timer_->expires_from_now();
-        boost::system::error_code ec;
-        departure_timer_->cancel(ec);
+    // Absolute time at which the current buffer must depart
+    std::chrono::steady_clock::time_point departure_time_;
+    // Buffers that had to depart before their debounce time was reached.
+    // They leave in order, each one at the given time.
+    std::deque<std::pair<std::chrono::steady_clock::time_point,
+        message_buffer_ptr_t> > departing_;
+    // Time of the train's entry in the endpoint's departure schedule
+    std::chrono::steady_clock::time_point scheduled_;
+
+    static std::chrono::steady_clock::time_point add(
+            const std::chrono::steady_clock::time_point &_time,
+            const std::chrono::nanoseconds &_duration) {
+        const auto its_max = std::chrono::steady_clock::time_point::max();
+        const auto its_duration = std::chrono::duration_cast<
+                std::chrono::steady_clock::duration>(_duration);
+        if (its_duration >= its_max - _time) {
+            return its_max;
+        }
+        return _time + its_duration;
+    }
+
+    void update_departure_time(
+            const std::chrono::steady_clock::time_point &_now) {
+        if (departure_time_ == std::chrono::steady_clock::time_point::max()) {
+            departure_ = DEFAULT_NANOSECONDS_MAX;
+        } else if (departure_time_ <= _now) {
+            departure_ = std::chrono::nanoseconds::zero();
+        } else {
+            departure_ = std::chrono::duration_cast<
+                    std::chrono::nanoseconds>(departure_time_ - _now);
+        }
+    }
+
+    std::chrono::steady_clock::time_point get_earliest_departure() const {
+        return add(last_departure_, minimal_debounce_time_);
     }
-};
 
+    std::chrono::steady_clock::time_point get_next_departure() const {
+        if (!departing_.empty()) {
+            return departing_.front().first;
+        }
+        if (buffer_->empty()) {
+            return std::chrono::steady_clock::time_point::max();
+        }
+        return departure_time_;
+    }
+
+    // Bytes of the buffers that wait for their departure. They count as
+    // queued when checking the queue limit.
+    std::size_t get_departing_size() const {
+        std::size_t its_size(0);
+        for (const auto &d : departing_)
+            its_size += d.second->size();
+        return its_size;
+    }
+
+    // Hands the current buffer over to the departing list instead of
+    // blocking the sender until the debounce time is reached.
+    void defer_departure(const std::chrono::steady_clock::time_point &_now) {
+        auto its_departure = get_earliest_departure();
+        if (its_departure < _now) {
+            its_departure = _now;
+        }
+        departing_.emplace_back(its_departure, buffer_);
+        buffer_ = std::make_shared<message_buffer_t>();
+        passengers_.clear();
+        last_departure_ = its_departure;
+        departure_time_ = std::chrono::steady_clock::time_point::max();
+        minimal_debounce_time_ = std::chrono::nanoseconds::max();
+        minimal_max_retention_time_ = std::chrono::nanoseconds::max();
+    }
+};
 
 } // namespace vsomeip_v3
 
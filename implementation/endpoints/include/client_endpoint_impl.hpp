@@ -23,6 +23,7 @@
 #include "buffer.hpp"
 #include "endpoint_impl.hpp"
 #include "client_endpoint.hpp"
+#include "io_uring_service.hpp"
 #include "tp.hpp"
 
 
@@ -105,11 +106,16 @@ protected:
             const std::uint8_t * const _data, std::uint32_t _size);
     bool check_queue_limit(const uint8_t *_data, std::uint32_t _size) const;
     void queue_train(bool _queue_size_zero_on_entry);
+    void depart_train_unlocked(bool _queue_size_zero_on_entry);
+    void schedule_train_unlocked();
 
 protected:
     mutable std::mutex socket_mutex_;
     std::unique_ptr<socket_type> socket_;
     const endpoint_type remote_;
+#ifdef VSOMEIP_ENABLE_IO_URING
+    io_uring_service *io_uring_;
+#endif
 
     boost::asio::steady_timer flush_timer_;
 
@@ -141,7 +147,6 @@ private:
     virtual std::uint32_t get_max_allowed_reconnects() const = 0;
     virtual void max_allowed_reconnects_reached() = 0;
     void send_segments(const tp::tp_split_messages_t &_segments);
-    void wait_until_debounce_time_reached() const;
 };
 
 } // namespace vsomeip_v3
@@ -10,6 +10,7 @@
 #include <memory>
 #include <atomic>
 #include <mutex>
+#include <tuple>
 
 #include <boost/asio/ip/address.hpp>
 #include <vsomeip/primitive_types.hpp>
@@ -42,10 +43,23 @@ private:
     std::atomic<uint16_t> remote_port_;
     bool is_reliable_;
 
-    static std::mutex definitions_mutex_;
-    static std::map<
-        std::tuple<service_t, instance_t, boost::asio::ip::address, uint16_t, bool>,
-        std::shared_ptr<endpoint_definition> > definitions_;
+    typedef std::tuple<service_t, instance_t,
+                boost::asio::ip::address, uint16_t, bool> definition_key_t;
+
+    // Definitions are distributed over several independently locked shards.
+    // Definitions that are no longer referenced outside of a shard are
+    // purged whenever the shard has doubled in size since the last purge.
+    struct definitions_shard_t {
+        std::mutex mutex_;
+        std::map<definition_key_t,
+            std::shared_ptr<endpoint_definition> > definitions_;
+        std::size_t purged_size_;
+    };
+
+    static std::size_t get_shard(const definition_key_t &_key);
+    static void purge_unlocked(definitions_shard_t &_shard);
+
+    static definitions_shard_t shards_[];
 };
 
 } // namespace vsomeip_v3
@@ -61,7 +61,7 @@ public:
     virtual void restart(bool _force) = 0;
 
 protected:
-    uint32_t find_magic_cookie(byte_t *_buffer, size_t _size);
+    uint32_t find_magic_cookie(const byte_t *_buffer, size_t _size);
 
 protected:
     enum class cms_ret_e : uint8_t {
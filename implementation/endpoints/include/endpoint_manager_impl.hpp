@@ -6,6 +6,8 @@
 #ifndef VSOMEIP_V3_ENDPOINT_MANAGER_IMPL_HPP_
 #define VSOMEIP_V3_ENDPOINT_MANAGER_IMPL_HPP_
 
+#include <unordered_map>
+
 #include "../include/endpoint_manager_base.hpp"
 
 namespace vsomeip_v3 {
@@ -103,6 +105,9 @@ private:
             const boost::asio::ip::address &_address, uint16_t _local_port,
             uint16_t _remote_port, bool _reliable);
 
+    void update_instance_cache_unlocked();
+    void update_instance_multicast_cache_unlocked();
+
 private:
     mutable std::recursive_mutex endpoint_mutex_;
     // Client endpoints for remote services
@@ -118,7 +123,22 @@ private:
     client_endpoints_by_ip_t client_endpoints_by_ip_;
 
     std::map<service_t, std::map<endpoint *, instance_t> > service_instances_;
-    std::map<service_t, std::map<boost::asio::ip::address, instance_t> > service_instances_multicast_;
+    typedef std::map<service_t,
+                std::map<boost::asio::ip::address, instance_t> > service_instances_multicast_t;
+    service_instances_multicast_t service_instances_multicast_;
+
+    // Immutable copies of service_instances_ and service_instances_multicast_
+    // for the receive path. They are replaced (while holding endpoint_mutex_)
+    // whenever the originals change and are read without taking it.
+    struct endpoint_service_hash {
+        std::size_t operator()(const std::pair<endpoint *, service_t> &_key) const {
+            return std::hash<endpoint *>()(_key.first) ^ _key.second;
+        }
+    };
+    typedef std::unordered_map<std::pair<endpoint *, service_t>, instance_t,
+                endpoint_service_hash> instance_cache_t;
+    std::shared_ptr<const instance_cache_t> instance_cache_;
+    std::shared_ptr<const service_instances_multicast_t> instance_multicast_cache_;
 
     std::map<bool, std::set<uint16_t>> used_client_ports_;
     std::mutex used_client_ports_mutex_;
@@ -0,0 +1,146 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_IO_URING_SERVICE_HPP_
+#define VSOMEIP_V3_IO_URING_SERVICE_HPP_
+
+#ifdef VSOMEIP_ENABLE_IO_URING
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/address.hpp>
+#include <boost/asio/posix/stream_descriptor.hpp>
+
+#include <vsomeip/export.hpp>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace vsomeip_v3 {
+
+// Receives from and sends to sockets by io_uring instead of the reactor
+// of the io_service. Completions are signalled by an eventfd that is read
+// by the io_service, thus handlers are called on the io threads just as
+// asio handlers are. Operations that are started while completions are
+// handled, or before a scheduled submission runs, are submitted together
+// by a single system call.
+//
+// The service is added to the io_service of an application that enables
+// io_uring. Endpoints use it if it is present and use asio otherwise.
+class io_uring_service : public boost::asio::io_service::service {
+public:
+    typedef std::function<
+        void (const boost::system::error_code &, std::size_t,
+                std::uint32_t, std::uint32_t)> receive_handler_t;
+    typedef std::function<
+        void (const boost::system::error_code &, std::size_t,
+                const boost::asio::ip::address &, std::uint16_t,
+                const boost::asio::ip::address &)> receive_from_handler_t;
+    typedef std::function<
+        void (const boost::system::error_code &, std::size_t)> send_handler_t;
+
+    static boost::asio::io_service::id id;
+
+    VSOMEIP_EXPORT explicit io_uring_service(boost::asio::io_service &_io);
+    VSOMEIP_EXPORT ~io_uring_service();
+
+    // Sets up the rings. Returns false if io_uring is not supported by the
+    // kernel. The service must not be used in that case.
+    VSOMEIP_EXPORT bool init(std::uint32_t _entries);
+
+    // Receives into _buffer. The handler gets the error, the number of
+    // received bytes and, if passed by the socket, the uid and gid of the
+    // sender (ANY_UID/ANY_GID otherwise).
+    VSOMEIP_EXPORT void async_receive(int _socket,
+            const boost::asio::mutable_buffer &_buffer,
+            receive_handler_t _handler);
+
+    // Receives a datagram into _buffer. The handler gets the error, the
+    // number of received bytes, the address and port of the sender and,
+    // if the socket passes IP_PKTINFO/IPV6_PKTINFO, the destination address.
+    VSOMEIP_EXPORT void async_receive_from(int _socket,
+            const boost::asio::mutable_buffer &_buffer,
+            receive_from_handler_t _handler);
+
+    // Writes _buffers by gathering writes. As boost::asio::async_write,
+    // partial writes are continued until all data is written. The buffers
+    // must stay valid until the handler is called.
+    VSOMEIP_EXPORT void async_send(int _socket,
+            const std::vector<boost::asio::const_buffer> &_buffers,
+            send_handler_t _handler);
+
+    // As async_send, but to _address:_port (unconnected datagram sockets).
+    VSOMEIP_EXPORT void async_send_to(int _socket,
+            const std::vector<boost::asio::const_buffer> &_buffers,
+            const boost::asio::ip::address &_address, std::uint16_t _port,
+            send_handler_t _handler);
+
+    // Aborts all operations of _socket. Must be called before the socket
+    // is closed.
+    VSOMEIP_EXPORT void cancel(int _socket);
+
+private:
+    struct operation;
+
+    void shutdown_service();
+
+    void completion_cbk(const boost::system::error_code &_error,
+            std::size_t _bytes);
+    void start_waiting();
+
+    void start(std::unique_ptr<operation> _operation);
+    bool start_unlocked(std::unique_ptr<operation> &_operation);
+    void complete(operation &_operation, int _result);
+
+    io_uring_sqe *get_sqe();
+    void submit();
+    void schedule_submit();
+    std::size_t reap(std::vector<std::pair<std::unique_ptr<operation>, int> > &_completed);
+    void close();
+
+    boost::asio::io_service &io_;
+    std::mutex mutex_;
+    int ring_fd_;
+    boost::asio::posix::stream_descriptor event_descriptor_;
+    std::uint64_t event_count_;
+
+    void *sq_ring_;
+    std::size_t sq_ring_size_;
+    void *cq_ring_;
+    std::size_t cq_ring_size_;
+    io_uring_sqe *sqes_;
+    std::size_t sqes_size_;
+
+    unsigned *sq_head_;
+    unsigned *sq_tail_;
+    unsigned sq_mask_;
+    unsigned sq_entries_;
+    unsigned *sq_array_;
+    unsigned *cq_head_;
+    unsigned *cq_tail_;
+    unsigned cq_mask_;
+    io_uring_cqe *cqes_;
+
+    unsigned to_submit_;
+    bool is_handling_;
+    bool is_submit_scheduled_;
+    bool is_shut_down_;
+
+    std::uint64_t next_id_;
+    std::unordered_map<std::uint64_t, std::unique_ptr<operation> > operations_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_ENABLE_IO_URING
+
+#endif // VSOMEIP_V3_IO_URING_SERVICE_HPP_
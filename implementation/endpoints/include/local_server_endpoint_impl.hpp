@@ -22,6 +22,8 @@
 #include <vsomeip/defines.hpp>
 
 #include "buffer.hpp"
+#include "io_uring_service.hpp"
+#include "receive_buffer.hpp"
 #include "server_endpoint_impl.hpp"
 
 namespace vsomeip_v3 {
@@ -116,7 +118,7 @@ private:
     private:
         connection(const std::shared_ptr<local_server_endpoint_impl>& _server,
                    std::uint32_t _max_message_size,
-                   std::uint32_t _initial_recv_buffer_size,
+                   std::size_t _recv_buffer_capacity,
                    std::uint32_t _buffer_shrink_threshold,
                    boost::asio::io_service &_io_service);
 
@@ -128,7 +130,6 @@ private:
                          , std::uint32_t const &_uid, std::uint32_t const &_gid
 #endif
         );
-        void calculate_shrink_count();
         const std::string get_path_local() const;
         const std::string get_path_remote() const;
         void handle_recv_buffer_exception(const std::exception &_e);
@@ -137,14 +138,13 @@ private:
         local_server_endpoint_impl::socket_type socket_;
         std::weak_ptr<local_server_endpoint_impl> server_;
 
-        const std::uint32_t recv_buffer_size_initial_;
         const std::uint32_t max_message_size_;
 
-        message_buffer_t recv_buffer_;
-        size_t recv_buffer_size_;
+        receive_buffer recv_buffer_;
         std::uint32_t missing_capacity_;
-        std::uint32_t shrink_count_;
-        const std::uint32_t buffer_shrink_threshold_;
+#ifdef VSOMEIP_ENABLE_IO_URING
+        io_uring_service *io_uring_;
+#endif
 
         client_t bound_client_;
 #ifndef _WIN32
@@ -0,0 +1,82 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_RECEIVE_BUFFER_HPP_
+#define VSOMEIP_V3_RECEIVE_BUFFER_HPP_
+
+#include <cstdint>
+
+#include <boost/asio/buffer.hpp>
+
+#include <vsomeip/primitive_types.hpp>
+
+#include "buffer.hpp"
+
+namespace vsomeip_v3 {
+
+// Receive buffer of stream connections. Received data is appended behind
+// the unread data and consumed from its front.
+//
+// If supported by the platform, the buffer memory is mapped twice in a row.
+// Thus, the unread data as well as the free space behind it are contiguous
+// wherever they start, and neither consuming data nor receiving the rest of
+// a partial message requires data to be moved. Otherwise, a linear buffer
+// is used that is compacted only if the free space does not suffice.
+//
+// Messages that do not fit into the ring are received into a separate
+// buffer that is sized from the message length. This buffer is kept for
+// further large messages until the shrink threshold is exceeded.
+class receive_buffer {
+public:
+    receive_buffer(std::size_t _capacity, std::uint32_t _shrink_threshold);
+    ~receive_buffer();
+
+    receive_buffer(const receive_buffer &) = delete;
+    receive_buffer &operator=(const receive_buffer &) = delete;
+
+    // Unread data, valid until the next call to prepare or consume.
+    const byte_t *data() const;
+    std::size_t size() const;
+
+    // Number of bytes that can currently be held.
+    std::size_t capacity() const;
+
+    // Returns the free space behind the unread data. The free space is at
+    // least _required bytes. If a separate buffer is needed to provide it,
+    // exactly _required bytes are returned so that no data following the
+    // current message is received into the separate buffer.
+    boost::asio::mutable_buffer prepare(std::size_t _required);
+
+    // Appends _bytes received into the space returned by prepare.
+    void commit(std::size_t _bytes);
+
+    // Removes _bytes from the front of the unread data.
+    void consume(std::size_t _bytes);
+
+    // Drops the unread data and releases the separate buffer.
+    void clear();
+
+private:
+    bool map_ring();
+    void unmap_ring();
+
+    byte_t *ring_;
+    std::size_t ring_capacity_;
+    bool is_mirrored_;
+    message_buffer_t linear_;
+
+    message_buffer_t large_;
+    bool is_large_;
+
+    std::size_t begin_;
+    std::size_t size_;
+
+    const std::uint32_t shrink_threshold_;
+    std::uint32_t shrink_count_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_RECEIVE_BUFFER_HPP_
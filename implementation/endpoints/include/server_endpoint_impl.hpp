@@ -15,6 +15,7 @@
 
 #include <boost/array.hpp>
 #include <boost/asio/io_service.hpp>
+#include <boost/asio/steady_timer.hpp>
 
 #include "buffer.hpp"
 #include "endpoint_impl.hpp"
@@ -62,11 +63,11 @@ public:
 
 public:
     void connect_cbk(boost::system::error_code const &_error);
+    // _sent_trains: queued trains written by the operation
     void send_cbk(const queue_iterator_type _queue_iterator,
+                  const std::vector<message_buffer_ptr_t> &_sent_trains,
                   boost::system::error_code const &_error, std::size_t _bytes);
-    void flush_cbk(endpoint_type _target,
-                   const std::shared_ptr<train>& _train,
-                   const boost::system::error_code &_error_code);
+    void flush_cbk(const boost::system::error_code &_error_code);
 
 protected:
     virtual bool send_intern(endpoint_type _target, const byte_t *_data,
@@ -92,6 +93,12 @@ protected:
                      bool _queue_size_zero_on_entry);
     queue_iterator_type find_or_create_queue_unlocked(const endpoint_type& _target);
     std::shared_ptr<train> find_or_create_train_unlocked(const endpoint_type& _target);
+    void depart_train_unlocked(const queue_iterator_type _queue_iterator,
+                               const std::shared_ptr<train>& _train,
+                               bool _queue_size_zero_on_entry);
+    void schedule_train_unlocked(const endpoint_type& _target,
+                                 const std::shared_ptr<train>& _train);
+    void start_departure_timer_unlocked();
 
     void send_segments(const tp::tp_split_messages_t &_segments, const endpoint_type &_target);
 
@@ -103,6 +110,12 @@ protected:
 
     std::map<endpoint_type, std::shared_ptr<train>> trains_;
 
+    // Departure schedule of all trains, ordered by deadline. A single timer
+    // is armed for the earliest entry.
+    std::set<std::pair<std::chrono::steady_clock::time_point, endpoint_type>> departures_;
+    boost::asio::steady_timer departure_timer_;
+    std::chrono::steady_clock::time_point departure_timer_expiry_;
+
     std::map<service_t, endpoint::prepare_stop_handler_t> prepare_stop_handlers_;
 
     mutable std::mutex mutex_;
@@ -118,7 +131,6 @@ private:
             const endpoint_type& _remote) const = 0;
     virtual bool tp_segmentation_enabled(service_t _service,
                                          method_t _method) const = 0;
-    void wait_until_debounce_time_reached(const std::shared_ptr<train>& _train) const;
 };
 
 } // namespace vsomeip_v3
@@ -43,13 +43,15 @@ public:
                   const message_buffer_ptr_t& _sent_msg);
 private:
     void send_queued();
+    void send_trains_cbk(boost::system::error_code const &_error,
+                         std::size_t _bytes,
+                         const std::vector<message_buffer_ptr_t> &_sent_trains);
     void get_configured_times_from_endpoint(
             service_t _service, method_t _method,
             std::chrono::nanoseconds *_debouncing,
             std::chrono::nanoseconds *_maximum_retention) const;
     bool is_magic_cookie(const message_buffer_ptr_t& _recv_buffer,
                          size_t _offset) const;
-    void send_magic_cookie(message_buffer_ptr_t &_buffer);
 
     void receive_cbk(boost::system::error_code const &_error,
                      std::size_t _bytes,
@@ -91,6 +93,8 @@ private:
     const boost::asio::ip::address remote_address_;
     const std::uint16_t remote_port_;
     std::chrono::steady_clock::time_point last_cookie_sent_;
+    // Maximum number of bytes written by a single write operation
+    const std::uint32_t coalescing_limit_;
     const std::chrono::milliseconds send_timeout_;
     const std::chrono::milliseconds send_timeout_warning_;
 
@@ -13,6 +13,8 @@
 
 #include <vsomeip/defines.hpp>
 #include <vsomeip/export.hpp>
+#include "io_uring_service.hpp"
+#include "receive_buffer.hpp"
 #include "server_endpoint_impl.hpp"
 
 #include <chrono>
@@ -88,16 +90,18 @@ private:
     private:
         connection(const std::weak_ptr<tcp_server_endpoint_impl>& _server,
                    std::uint32_t _max_message_size,
-                   std::uint32_t _recv_buffer_size_initial,
+                   std::size_t _recv_buffer_capacity,
                    std::uint32_t _buffer_shrink_threshold,
                    bool _magic_cookies_enabled,
                    boost::asio::io_service & _io_service,
                    std::chrono::milliseconds _send_timeout);
-        bool send_magic_cookie(message_buffer_ptr_t &_buffer);
+        void collect_trains(const queue_iterator_type _queue_iterator,
+                std::uint32_t _limit,
+                std::vector<boost::asio::const_buffer> &_buffers,
+                std::size_t &_size, std::vector<message_buffer_ptr_t> &_trains);
         bool is_magic_cookie(size_t _offset) const;
         void receive_cbk(boost::system::error_code const &_error,
                          std::size_t _bytes);
-        void calculate_shrink_count();
         const std::string get_address_port_local() const;
         void handle_recv_buffer_exception(const std::exception &_e);
         std::size_t write_completion_condition(
@@ -113,13 +117,12 @@ private:
         std::weak_ptr<tcp_server_endpoint_impl> server_;
 
         const uint32_t max_message_size_;
-        const uint32_t recv_buffer_size_initial_;
 
-        message_buffer_t recv_buffer_;
-        size_t recv_buffer_size_;
+        receive_buffer recv_buffer_;
         std::uint32_t missing_capacity_;
-        std::uint32_t shrink_count_;
-        const std::uint32_t buffer_shrink_threshold_;
+#ifdef VSOMEIP_ENABLE_IO_URING
+        io_uring_service *io_uring_;
+#endif
 
         endpoint_type remote_;
         boost::asio::ip::address remote_address_;
@@ -138,6 +141,8 @@ private:
     const std::uint32_t buffer_shrink_threshold_;
     const std::uint16_t local_port_;
     const std::chrono::milliseconds send_timeout_;
+    // Maximum number of bytes written by a single write operation
+    const std::uint32_t coalescing_limit_;
 
 private:
     void remove_connection(connection *_connection);
@@ -13,6 +13,7 @@
 
 #include <vsomeip/defines.hpp>
 
+#include "io_uring_service.hpp"
 #include "server_endpoint_impl.hpp"
 #include "tp_reassembler.hpp"
 
@@ -85,6 +86,21 @@ private:
             boost::asio::ip::address const &_destination,
             uint8_t _multicast_id);
 
+#ifdef VSOMEIP_ENABLE_IO_URING
+    void on_unicast_received_from(boost::system::error_code const &_error,
+            std::size_t _bytes,
+            boost::asio::ip::address const &_remote_address,
+            std::uint16_t _remote_port,
+            boost::asio::ip::address const &_destination);
+
+    void on_multicast_received_from(boost::system::error_code const &_error,
+            std::size_t _bytes,
+            boost::asio::ip::address const &_remote_address,
+            std::uint16_t _remote_port,
+            boost::asio::ip::address const &_destination,
+            uint8_t _multicast_id);
+#endif
+
     void on_message_received(boost::system::error_code const &_error,
                      std::size_t _bytes,
                      boost::asio::ip::address const &_destination,
@@ -113,6 +129,10 @@ private:
 
     std::shared_ptr<tp::tp_reassembler> tp_reassembler_;
     boost::asio::steady_timer tp_cleanup_timer_;
+
+#ifdef VSOMEIP_ENABLE_IO_URING
+    io_uring_service *io_uring_;
+#endif
 };
 
 } // namespace vsomeip_v3
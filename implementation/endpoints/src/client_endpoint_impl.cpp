@@ -6,7 +6,6 @@
 #include <chrono>
 #include <iomanip>
 #include <sstream>
-#include <thread>
 #include <limits>
 
 #include <boost/asio/buffer.hpp>
@@ -19,6 +18,7 @@
 
 #include "../include/client_endpoint_impl.hpp"
 #include "../include/endpoint_host.hpp"
+#include "../../utility/include/allocation_statistics.hpp"
 #include "../../utility/include/utility.hpp"
 #include "../../utility/include/byteorder.hpp"
 
@@ -37,11 +37,15 @@ client_endpoint_impl<Protocol>::client_endpoint_impl(
         : endpoint_impl<Protocol>(_endpoint_host, _routing_host, _local, _io,
                 _max_message_size, _queue_limit, _configuration),
           socket_(new socket_type(_io)), remote_(_remote),
+#ifdef VSOMEIP_ENABLE_IO_URING
+          io_uring_(boost::asio::has_service<io_uring_service>(_io) ?
+                  &boost::asio::use_service<io_uring_service>(_io) : nullptr),
+#endif
           flush_timer_(_io), connect_timer_(_io),
           connect_timeout_(VSOMEIP_DEFAULT_CONNECT_TIMEOUT), // TODO: use config variable
           state_(cei_state_e::CLOSED),
           reconnect_counter_(0),
-          train_(_io),
+          train_(),
           queue_size_(0),
           was_not_connected_(false),
           local_port_(0),
@@ -113,6 +117,7 @@ void client_endpoint_impl<Protocol>::stop() {
         // delete unsent messages
         queue_.clear();
         queue_size_ = 0;
+        train_.departing_.clear();
     }
     {
         std::lock_guard<std::mutex> its_lock(connect_timer_mutex_);
@@ -150,6 +155,7 @@ bool client_endpoint_impl<Protocol>::send_error(
 
 template<typename Protocol>
 bool client_endpoint_impl<Protocol>::send(const uint8_t *_data, uint32_t _size) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::ENDPOINT);
     std::lock_guard<std::mutex> its_lock(mutex_);
     bool must_depart(false);
     const bool queue_size_zero_on_entry(queue_.empty());
@@ -177,8 +183,10 @@ bool client_endpoint_impl<Protocol>::send(const uint8_t *_data, uint32_t _size)
             break;
     }
 
-    // STEP 1: Determine elapsed time and update the departure time and cancel the departure timer
-    train_.update_departure_time_and_stop_departure();
+    // STEP 1: Determine the time left until the train departs
+    const std::chrono::steady_clock::time_point its_now
+        = std::chrono::steady_clock::now();
+    train_.update_departure_time(its_now);
 
     // STEP 3: Get configured timings
     const service_t its_service = VSOMEIP_BYTES_TO_WORD(
@@ -233,14 +241,9 @@ bool client_endpoint_impl<Protocol>::send(const uint8_t *_data, uint32_t _size)
     // STEP 8: if necessary, send current buffer and create a new one
     if (must_depart) {
         // STEP 8.1: check if debounce time would be undershot here if the train
-        // departs. Block sending until train is allowed to depart.
-        wait_until_debounce_time_reached();
-        train_.passengers_.clear();
-        queue_train(queue_size_zero_on_entry);
-        train_.last_departure_ = std::chrono::steady_clock::now();
+        // departs. If so, the train is scheduled to depart once it is allowed to.
+        depart_train_unlocked(queue_size_zero_on_entry);
         train_.departure_ = its_retention;
-        train_.minimal_debounce_time_ = std::chrono::nanoseconds::max();
-        train_.minimal_max_retention_time_ = std::chrono::nanoseconds::max();
     }
 
     // STEP 9: insert current message buffer
@@ -255,17 +258,9 @@ bool client_endpoint_impl<Protocol>::send(const uint8_t *_data, uint32_t _size)
         train_.minimal_max_retention_time_ = its_retention;
     }
 
-    // STEP 10: restart timer with current departure time
-#ifndef _WIN32
-    train_.departure_timer_->expires_from_now(train_.departure_);
-#else
-    train_.departure_timer_->expires_from_now(
-            std::chrono::duration_cast<
-                std::chrono::steady_clock::duration>(train_.departure_));
-#endif
-    train_.departure_timer_->async_wait(
-            std::bind(&client_endpoint_impl<Protocol>::flush_cbk,
-                      this->shared_from_this(), std::placeholders::_1));
+    // STEP 10: schedule the train for its current departure time
+    train_.departure_time_ = train::add(its_now, train_.departure_);
+    schedule_train_unlocked();
 
     return true;
 }
@@ -299,37 +294,64 @@ void client_endpoint_impl<Protocol>::send_segments(
     // We only need to respect the debouncing. There is no need to wait for further
     // messages as we will send several now anyway.
     if (!train_.passengers_.empty()) {
-        wait_until_debounce_time_reached();
-        train_.passengers_.clear();
-        queue_train(queue_size_zero_on_entry);
-        train_.last_departure_ = std::chrono::steady_clock::now();
+        depart_train_unlocked(queue_size_zero_on_entry);
         train_.departure_ = its_retention;
-        train_.minimal_debounce_time_ = std::chrono::nanoseconds::max();
-        train_.minimal_max_retention_time_ = std::chrono::nanoseconds::max();
     }
-    const bool queue_size_still_zero(queue_.empty());
-    for (const auto& s : _segments) {
-        queue_.emplace_back(s);
-        queue_size_ += s->size();
+
+    // respect minimal debounce time
+    const std::chrono::steady_clock::time_point its_now
+        = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point its_departure
+        = train::add(train_.last_departure_, its_debouncing);
+    if (train_.departing_.empty() && its_departure <= its_now) {
+        const bool queue_size_still_zero(queue_.empty());
+        for (const auto& s : _segments) {
+            queue_.emplace_back(s);
+            queue_size_ += s->size();
+        }
+
+        if (queue_size_still_zero && !queue_.empty()) { // no writing in progress
+            // ignore retention time and send immediately as the train is full anyway
+            send_queued();
+        }
+        train_.last_departure_ = its_now;
+    } else {
+        // segments leave together as soon as the debounce time is reached
+        if (its_departure < its_now) {
+            its_departure = its_now;
+        }
+        for (const auto& s : _segments) {
+            train_.departing_.emplace_back(its_departure, s);
+        }
+        train_.last_departure_ = its_departure;
+        schedule_train_unlocked();
     }
+}
 
-    if (queue_size_still_zero && !queue_.empty()) { // no writing in progress
-        // respect minimal debounce time
-        wait_until_debounce_time_reached();
-        // ignore retention time and send immediately as the train is full anyway
-        send_queued();
+template<typename Protocol>
+void client_endpoint_impl<Protocol>::depart_train_unlocked(
+        bool _queue_size_zero_on_entry) {
+    if (train_.departing_.empty()
+            && train_.get_earliest_departure() <= std::chrono::steady_clock::now()) {
+        queue_train(_queue_size_zero_on_entry);
+    } else {
+        train_.defer_departure(std::chrono::steady_clock::now());
     }
-    train_.last_departure_ = std::chrono::steady_clock::now();
 }
 
 template<typename Protocol>
-void client_endpoint_impl<Protocol>::wait_until_debounce_time_reached() const {
-    const std::chrono::nanoseconds time_since_last_departure =
-            std::chrono::duration_cast<std::chrono::nanoseconds>(
-                    std::chrono::steady_clock::now() - train_.last_departure_);
-    if (time_since_last_departure < train_.minimal_debounce_time_) {
-        std::this_thread::sleep_for(
-                train_.minimal_debounce_time_ - time_since_last_departure);
+void client_endpoint_impl<Protocol>::schedule_train_unlocked() {
+    // The timer is only ever moved forward. If it expires too early, the
+    // train is rescheduled by flush_cbk.
+    const std::chrono::steady_clock::time_point its_departure
+        = train_.get_next_departure();
+    if (its_departure < train_.scheduled_) {
+        train_.scheduled_ = its_departure;
+        boost::system::error_code ec;
+        flush_timer_.expires_at(its_departure, ec);
+        flush_timer_.async_wait(
+                std::bind(&client_endpoint_impl<Protocol>::flush_cbk,
+                          this->shared_from_this(), std::placeholders::_1));
     }
 }
 
@@ -346,12 +368,8 @@ template<typename Protocol>
 bool client_endpoint_impl<Protocol>::flush() {
     bool is_successful(true);
     std::lock_guard<std::mutex> its_lock(mutex_);
-    if (!train_.buffer_->empty()) {
+    if (!train_.buffer_->empty() || !train_.departing_.empty()) {
         queue_train(!queue_.size());
-        train_.last_departure_ = std::chrono::steady_clock::now();
-        train_.passengers_.clear();
-        train_.minimal_debounce_time_ = std::chrono::nanoseconds::max();
-        train_.minimal_max_retention_time_ = std::chrono::nanoseconds::max();
     } else {
         is_successful = false;
     }
@@ -536,9 +554,29 @@ void client_endpoint_impl<Protocol>::send_cbk(
 template<typename Protocol>
 void client_endpoint_impl<Protocol>::flush_cbk(
         boost::system::error_code const &_error) {
-    if (!_error) {
-        (void) flush();
+    if (_error) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> its_lock(mutex_);
+    const std::chrono::steady_clock::time_point its_now
+        = std::chrono::steady_clock::now();
+    train_.scheduled_ = std::chrono::steady_clock::time_point::max();
+    const bool queue_size_zero_on_entry(queue_.empty());
+    while (!train_.departing_.empty()
+            && train_.departing_.front().first <= its_now) {
+        queue_.push_back(train_.departing_.front().second);
+        queue_size_ += train_.departing_.front().second->size();
+        train_.departing_.pop_front();
     }
+    if (train_.departing_.empty() && !train_.buffer_->empty()
+            && train_.departure_time_ <= its_now) {
+        queue_train(false);
+    }
+    if (queue_size_zero_on_entry && !queue_.empty()) { // no writing in progress
+        send_queued();
+    }
+    schedule_train_unlocked();
 }
 
 template<typename Protocol>
@@ -557,6 +595,10 @@ void client_endpoint_impl<Protocol>::shutdown_and_close_socket_unlocked(bool _re
                     << std::string(std::strerror(errno))
                     << "' (" << errno << ") " << get_remote_information();
         }
+#endif
+#ifdef VSOMEIP_ENABLE_IO_URING
+        if (io_uring_)
+            io_uring_->cancel(socket_->native_handle());
 #endif
         boost::system::error_code its_error;
         socket_->shutdown(Protocol::socket::shutdown_both, its_error);
@@ -623,7 +665,8 @@ typename endpoint_impl<Protocol>::cms_ret_e client_endpoint_impl<Protocol>::chec
 template<typename Protocol>
 bool client_endpoint_impl<Protocol>::check_queue_limit(const uint8_t *_data, std::uint32_t _size) const {
     if (endpoint_impl<Protocol>::queue_limit_ != QUEUE_SIZE_UNLIMITED
-            && queue_size_ + _size > endpoint_impl<Protocol>::queue_limit_) {
+            && queue_size_ + train_.get_departing_size() + _size
+                > endpoint_impl<Protocol>::queue_limit_) {
         service_t its_service(0);
         method_t its_method(0);
         client_t its_client(0);
@@ -653,6 +696,7 @@ bool client_endpoint_impl<Protocol>::check_queue_limit(const uint8_t *_data, std
                 << std::hex << std::setw(4) << std::setfill('0') << its_method << "."
                 << std::hex << std::setw(4) << std::setfill('0') << its_session << "] "
                 << "queue_size: " << std::dec << queue_size_
+                << " departing: " << std::dec << train_.get_departing_size()
                 << " data size: " << std::dec << _size;
         return false;
     }
@@ -661,9 +705,22 @@ bool client_endpoint_impl<Protocol>::check_queue_limit(const uint8_t *_data, std
 
 template<typename Protocol>
 void client_endpoint_impl<Protocol>::queue_train(bool _queue_size_zero_on_entry) {
-    queue_.push_back(train_.buffer_);
-    queue_size_ += train_.buffer_->size();
-    train_.buffer_ = std::make_shared<message_buffer_t>();
+    // deferred departures leave first to keep the message order
+    for (const auto &d : train_.departing_) {
+        queue_.push_back(d.second);
+        queue_size_ += d.second->size();
+    }
+    train_.departing_.clear();
+    if (!train_.buffer_->empty()) {
+        queue_.push_back(train_.buffer_);
+        queue_size_ += train_.buffer_->size();
+        train_.buffer_ = std::make_shared<message_buffer_t>();
+    }
+    train_.last_departure_ = std::chrono::steady_clock::now();
+    train_.passengers_.clear();
+    train_.departure_time_ = std::chrono::steady_clock::time_point::max();
+    train_.minimal_debounce_time_ = std::chrono::nanoseconds::max();
+    train_.minimal_max_retention_time_ = std::chrono::nanoseconds::max();
     if (_queue_size_zero_on_entry && !queue_.empty()) { // no writing in progress
         send_queued();
     }
@@ -9,32 +9,70 @@
 
 namespace vsomeip_v3 {
 
-std::map<std::tuple<service_t, instance_t, boost::asio::ip::address, uint16_t, bool>,
-         std::shared_ptr<endpoint_definition> > endpoint_definition::definitions_;
+#define VSOMEIP_ENDPOINT_DEFINITION_SHARDS          16
+#define VSOMEIP_ENDPOINT_DEFINITION_PURGE_THRESHOLD 64
 
-std::mutex endpoint_definition::definitions_mutex_;
+endpoint_definition::definitions_shard_t
+endpoint_definition::shards_[VSOMEIP_ENDPOINT_DEFINITION_SHARDS];
 
 std::shared_ptr<endpoint_definition>
 endpoint_definition::get(const boost::asio::ip::address &_address,
                          uint16_t _port, bool _is_reliable, service_t _service, instance_t _instance) {
     auto key = std::make_tuple(_service, _instance, _address, _port, _is_reliable);
-    std::lock_guard<std::mutex> its_lock(definitions_mutex_);
+    definitions_shard_t &its_shard = shards_[get_shard(key)];
+    std::lock_guard<std::mutex> its_lock(its_shard.mutex_);
     std::shared_ptr<endpoint_definition> its_result;
 
-    auto found_endpoint = definitions_.find(key);
-    if (found_endpoint != definitions_.end()) {
+    auto found_endpoint = its_shard.definitions_.find(key);
+    if (found_endpoint != its_shard.definitions_.end()) {
         its_result = found_endpoint->second;
     }
 
     if (!its_result) {
-            its_result = std::make_shared<endpoint_definition>(
-                             _address, _port, _is_reliable);
-            definitions_[key] = its_result;
+        its_result = std::make_shared<endpoint_definition>(
+                         _address, _port, _is_reliable);
+        its_shard.definitions_[key] = its_result;
+
+        if (its_shard.definitions_.size() >= VSOMEIP_ENDPOINT_DEFINITION_PURGE_THRESHOLD
+                && its_shard.definitions_.size() >= 2 * its_shard.purged_size_) {
+            purge_unlocked(its_shard);
+        }
     }
 
     return its_result;
 }
 
+std::size_t
+endpoint_definition::get_shard(const definition_key_t &_key) {
+    std::size_t its_hash = (std::size_t(std::get<0>(_key)) << 16)
+            ^ std::get<1>(_key) ^ (std::size_t(std::get<3>(_key)) << 1)
+            ^ std::size_t(std::get<4>(_key));
+
+    const boost::asio::ip::address &its_address = std::get<2>(_key);
+    if (its_address.is_v4()) {
+        its_hash ^= its_address.to_v4().to_ulong();
+    } else {
+        for (const auto b : its_address.to_v6().to_bytes())
+            its_hash = (its_hash * 31) ^ b;
+    }
+
+    return ((its_hash ^ (its_hash >> 8)) % VSOMEIP_ENDPOINT_DEFINITION_SHARDS);
+}
+
+void
+endpoint_definition::purge_unlocked(definitions_shard_t &_shard) {
+    // A definition that is only referenced by the shard cannot be handed out
+    // concurrently as long as the shard's mutex is held.
+    for (auto it = _shard.definitions_.begin(); it != _shard.definitions_.end(); ) {
+        if (it->second.use_count() == 1) {
+            it = _shard.definitions_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    _shard.purged_size_ = _shard.definitions_.size();
+}
+
 endpoint_definition::endpoint_definition(
         const boost::asio::ip::address &_address, uint16_t _port,
         bool _is_reliable)
@@ -53,7 +53,7 @@ void endpoint_impl<Protocol>::enable_magic_cookies() {
 
 template<typename Protocol>
 uint32_t endpoint_impl<Protocol>::find_magic_cookie(
-        byte_t *_buffer, size_t _size) {
+        const byte_t *_buffer, size_t _size) {
     bool is_found(false);
     uint32_t its_offset = 0xFFFFFFFF;
 
@@ -35,7 +35,9 @@ namespace vsomeip_v3 {
 endpoint_manager_impl::endpoint_manager_impl(
         routing_manager_base* const _rm, boost::asio::io_service& _io,
         const std::shared_ptr<configuration>& _configuration) :
-        endpoint_manager_base(_rm, _io, _configuration) {
+        endpoint_manager_base(_rm, _io, _configuration),
+        instance_cache_(std::make_shared<instance_cache_t>()),
+        instance_multicast_cache_(std::make_shared<service_instances_multicast_t>()) {
 }
 
 std::shared_ptr<endpoint> endpoint_manager_impl::find_or_create_remote_client(
@@ -303,6 +305,7 @@ std::shared_ptr<endpoint> endpoint_manager_impl::find_or_create_server_endpoint(
         std::lock_guard<std::recursive_mutex> its_lock(endpoint_mutex_);
         if (!_is_multicast) {
             service_instances_[_service][its_endpoint.get()] =  _instance;
+            update_instance_cache_unlocked();
         }
         its_endpoint->increment_use_count();
     }
@@ -342,6 +345,7 @@ void endpoint_manager_impl::clear_client_endpoints(service_t _service, instance_
                 const auto found_reliability = found_instance->second.find(_reliable);
                 if (found_reliability != found_instance->second.end()) {
                     service_instances_[_service].erase(found_reliability->second.get());
+                    update_instance_cache_unlocked();
                     endpoint_to_delete = found_reliability->second;
 
                     found_instance->second.erase(found_reliability);
@@ -454,6 +458,7 @@ void endpoint_manager_impl::find_or_create_multicast_endpoint(
         if (!multicast_known) {
             std::lock_guard<std::recursive_mutex> its_lock(endpoint_mutex_);
             service_instances_multicast_[_service][_sender] = _instance;
+            update_instance_multicast_cache_unlocked();
         }
         dynamic_cast<udp_server_endpoint_impl*>(its_endpoint.get())->join_unlocked(
                 _address.to_string());
@@ -646,13 +651,10 @@ endpoint_manager_impl::create_local_server(
 instance_t endpoint_manager_impl::find_instance(
         service_t _service, endpoint* const _endpoint) const {
     instance_t its_instance(0xFFFF);
-    std::lock_guard<std::recursive_mutex> its_lock(endpoint_mutex_);
-    auto found_service = service_instances_.find(_service);
-    if (found_service != service_instances_.end()) {
-        auto found_endpoint = found_service->second.find(_endpoint);
-        if (found_endpoint != found_service->second.end()) {
-            its_instance = found_endpoint->second;
-        }
+    const auto its_cache = std::atomic_load(&instance_cache_);
+    auto found_instance = its_cache->find(std::make_pair(_endpoint, _service));
+    if (found_instance != its_cache->end()) {
+        its_instance = found_instance->second;
     }
     return its_instance;
 }
@@ -660,9 +662,9 @@ instance_t endpoint_manager_impl::find_instance(
 instance_t endpoint_manager_impl::find_instance_multicast(
         service_t _service, const boost::asio::ip::address &_sender) const {
     instance_t its_instance(0xFFFF);
-    std::lock_guard<std::recursive_mutex> its_lock(endpoint_mutex_);
-    auto found_service = service_instances_multicast_.find(_service);
-    if (found_service != service_instances_multicast_.end()) {
+    const auto its_cache = std::atomic_load(&instance_multicast_cache_);
+    auto found_service = its_cache->find(_service);
+    if (found_service != its_cache->end()) {
         auto found_sender = found_service->second.find(_sender);
         if (found_sender != found_service->second.end()) {
             its_instance = found_sender->second;
@@ -680,6 +682,7 @@ bool endpoint_manager_impl::remove_instance(service_t _service,
             if (!found_service->second.size()) {
                 service_instances_.erase(found_service);
             }
+            update_instance_cache_unlocked();
         }
     }
     _endpoint->decrement_use_count();
@@ -697,6 +700,7 @@ bool endpoint_manager_impl::remove_instance_multicast(service_t _service,
                     if (!found_service->second.size()) {
                         service_instances_multicast_.erase(_service);
                     }
+                    update_instance_multicast_cache_unlocked();
                 }
                 return (true);
             }
@@ -862,6 +866,7 @@ std::shared_ptr<endpoint> endpoint_manager_impl::find_remote_client(
                             remote_services_[_service][_instance][_reliable] =
                                     its_endpoint;
                             service_instances_[_service][its_endpoint.get()] = _instance;
+                            update_instance_cache_unlocked();
                             // add endpoint to serviceinfo object
                             auto found_service_info = rm_->find_service(_service,_instance);
                             if (found_service_info) {
@@ -913,6 +918,7 @@ std::shared_ptr<endpoint> endpoint_manager_impl::create_remote_client(
                 used_client_ports_[_reliable].insert(its_local_port);
                 its_lock.unlock();
                 service_instances_[_service][its_endpoint.get()] = _instance;
+                update_instance_cache_unlocked();
                 remote_services_[_service][_instance][_reliable] = its_endpoint;
 
                 client_endpoints_by_ip_[its_endpoint_def->get_address()]
@@ -1072,4 +1078,23 @@ endpoint_manager_impl::log_server_states() const {
         VSOMEIP_INFO << "ESQ: [" << its_log.str() << "]";
 }
 
+void endpoint_manager_impl::update_instance_cache_unlocked() {
+    auto its_cache = std::make_shared<instance_cache_t>();
+    for (const auto &its_service : service_instances_) {
+        for (const auto &its_endpoint : its_service.second) {
+            (*its_cache)[std::make_pair(its_endpoint.first, its_service.first)]
+                = its_endpoint.second;
+        }
+    }
+    std::atomic_store(&instance_cache_,
+            std::shared_ptr<const instance_cache_t>(its_cache));
+}
+
+void endpoint_manager_impl::update_instance_multicast_cache_unlocked() {
+    std::atomic_store(&instance_multicast_cache_,
+            std::shared_ptr<const service_instances_multicast_t>(
+                std::make_shared<service_instances_multicast_t>(
+                        service_instances_multicast_)));
+}
+
 } // namespace vsomeip_v3
@@ -0,0 +1,599 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifdef VSOMEIP_ENABLE_IO_URING
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+
+#include <linux/io_uring.h>
+#include <netinet/in.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <boost/asio/ip/udp.hpp>
+
+#include <vsomeip/internal/logger.hpp>
+
+#include "../include/io_uring_service.hpp"
+#include "../../configuration/include/internal.hpp"
+
+namespace vsomeip_v3 {
+
+struct io_uring_service::operation {
+    enum class type_e : std::uint8_t { RECEIVE, RECEIVE_FROM, SEND };
+
+    operation(type_e _type, int _socket)
+        : type_(_type),
+          socket_(_socket),
+          is_cancelled_(false),
+          first_(0),
+          transferred_(0),
+          size_(0) {
+        std::memset(&msg_, 0, sizeof(msg_));
+        std::memset(&name_, 0, sizeof(name_));
+        if (type_ != type_e::SEND) {
+            msg_.msg_control = control_;
+            msg_.msg_controllen = sizeof(control_);
+        }
+        if (type_ == type_e::RECEIVE_FROM) {
+            msg_.msg_name = &name_;
+            msg_.msg_namelen = sizeof(name_);
+        }
+    }
+
+    void add(void *_data, std::size_t _size) {
+        iovec its_iov;
+        its_iov.iov_base = _data;
+        its_iov.iov_len = _size;
+        iovs_.push_back(its_iov);
+        size_ += _size;
+    }
+
+    void prepare(io_uring_sqe *_sqe, std::uint64_t _id) {
+        msg_.msg_iov = &iovs_[first_];
+        msg_.msg_iovlen = std::min<std::size_t>(iovs_.size() - first_, IOV_MAX);
+        if (type_ == type_e::SEND) {
+            _sqe->opcode = IORING_OP_SENDMSG;
+            _sqe->msg_flags = MSG_NOSIGNAL;
+        } else {
+            _sqe->opcode = IORING_OP_RECVMSG;
+        }
+        _sqe->fd = socket_;
+        _sqe->addr = reinterpret_cast<std::uint64_t>(&msg_);
+        _sqe->len = 1;
+        _sqe->user_data = _id;
+    }
+
+    // Advances a send operation by _bytes. Returns true if data remains.
+    bool consume(std::size_t _bytes) {
+        transferred_ += _bytes;
+        while (_bytes > 0 && first_ < iovs_.size()) {
+            iovec &its_iov = iovs_[first_];
+            if (_bytes < its_iov.iov_len) {
+                its_iov.iov_base = static_cast<char *>(its_iov.iov_base) + _bytes;
+                its_iov.iov_len -= _bytes;
+                _bytes = 0;
+            } else {
+                _bytes -= its_iov.iov_len;
+                first_++;
+            }
+        }
+        return (transferred_ < size_);
+    }
+
+    const type_e type_;
+    const int socket_;
+    receive_handler_t receive_handler_;
+    receive_from_handler_t receive_from_handler_;
+    send_handler_t send_handler_;
+    bool is_cancelled_;
+
+    std::vector<iovec> iovs_;
+    std::size_t first_;
+    std::size_t transferred_;
+    std::size_t size_;
+
+    msghdr msg_;
+    sockaddr_storage name_;
+    union {
+        cmsghdr cmh_;
+        char control_[CMSG_SPACE(sizeof(ucred))
+                      + CMSG_SPACE(sizeof(in6_pktinfo))];
+    };
+};
+
+boost::asio::io_service::id io_uring_service::id;
+
+io_uring_service::io_uring_service(boost::asio::io_service &_io)
+    : boost::asio::io_service::service(_io),
+      io_(_io),
+      ring_fd_(-1),
+      event_descriptor_(_io),
+      event_count_(0),
+      sq_ring_(MAP_FAILED),
+      sq_ring_size_(0),
+      cq_ring_(MAP_FAILED),
+      cq_ring_size_(0),
+      sqes_(nullptr),
+      sqes_size_(0),
+      sq_head_(nullptr),
+      sq_tail_(nullptr),
+      sq_mask_(0),
+      sq_entries_(0),
+      sq_array_(nullptr),
+      cq_head_(nullptr),
+      cq_tail_(nullptr),
+      cq_mask_(0),
+      cqes_(nullptr),
+      to_submit_(0),
+      is_handling_(false),
+      is_submit_scheduled_(false),
+      is_shut_down_(false),
+      next_id_(0) {
+}
+
+io_uring_service::~io_uring_service() {
+    shutdown_service();
+}
+
+bool io_uring_service::init(std::uint32_t _entries) {
+    io_uring_params its_params;
+    std::memset(&its_params, 0, sizeof(its_params));
+
+    ring_fd_ = static_cast<int>(syscall(__NR_io_uring_setup, _entries, &its_params));
+    if (ring_fd_ < 0) {
+        VSOMEIP_WARNING << "io_uring_service::" << __func__
+                << ": io_uring_setup failed: " << std::strerror(errno);
+        ring_fd_ = -1;
+        return false;
+    }
+
+    sq_ring_size_ = its_params.sq_off.array
+            + its_params.sq_entries * sizeof(unsigned);
+    cq_ring_size_ = its_params.cq_off.cqes
+            + its_params.cq_entries * sizeof(io_uring_cqe);
+    const bool is_single_mmap(its_params.features & IORING_FEAT_SINGLE_MMAP);
+    if (is_single_mmap && cq_ring_size_ > sq_ring_size_)
+        sq_ring_size_ = cq_ring_size_;
+
+    sq_ring_ = mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+    if (sq_ring_ != MAP_FAILED) {
+        if (is_single_mmap) {
+            cq_ring_ = sq_ring_;
+        } else {
+            cq_ring_ = mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING);
+        }
+    }
+    sqes_size_ = its_params.sq_entries * sizeof(io_uring_sqe);
+    void *its_sqes(MAP_FAILED);
+    if (cq_ring_ != MAP_FAILED) {
+        its_sqes = mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES);
+    }
+    if (its_sqes == MAP_FAILED) {
+        VSOMEIP_WARNING << "io_uring_service::" << __func__
+                << ": mapping the rings failed: " << std::strerror(errno);
+        close();
+        return false;
+    }
+    sqes_ = static_cast<io_uring_sqe *>(its_sqes);
+
+    char *its_sq = static_cast<char *>(sq_ring_);
+    sq_head_ = reinterpret_cast<unsigned *>(its_sq + its_params.sq_off.head);
+    sq_tail_ = reinterpret_cast<unsigned *>(its_sq + its_params.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<unsigned *>(its_sq + its_params.sq_off.ring_mask);
+    sq_entries_ = its_params.sq_entries;
+    sq_array_ = reinterpret_cast<unsigned *>(its_sq + its_params.sq_off.array);
+
+    char *its_cq = static_cast<char *>(cq_ring_);
+    cq_head_ = reinterpret_cast<unsigned *>(its_cq + its_params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned *>(its_cq + its_params.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<unsigned *>(its_cq + its_params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe *>(its_cq + its_params.cq_off.cqes);
+
+    int its_event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (its_event_fd < 0
+            || syscall(__NR_io_uring_register, ring_fd_,
+                    IORING_REGISTER_EVENTFD, &its_event_fd, 1) < 0) {
+        VSOMEIP_WARNING << "io_uring_service::" << __func__
+                << ": registering the eventfd failed: " << std::strerror(errno);
+        if (its_event_fd >= 0)
+            ::close(its_event_fd);
+        close();
+        return false;
+    }
+
+    boost::system::error_code its_error;
+    event_descriptor_.assign(its_event_fd, its_error);
+    if (its_error) {
+        ::close(its_event_fd);
+        close();
+        return false;
+    }
+
+    start_waiting();
+    return true;
+}
+
+void io_uring_service::async_receive(int _socket,
+        const boost::asio::mutable_buffer &_buffer,
+        receive_handler_t _handler) {
+    std::unique_ptr<operation> its_operation(
+            new operation(operation::type_e::RECEIVE, _socket));
+    its_operation->add(boost::asio::buffer_cast<void *>(_buffer),
+            boost::asio::buffer_size(_buffer));
+    its_operation->receive_handler_ = _handler;
+    start(std::move(its_operation));
+}
+
+void io_uring_service::async_receive_from(int _socket,
+        const boost::asio::mutable_buffer &_buffer,
+        receive_from_handler_t _handler) {
+    std::unique_ptr<operation> its_operation(
+            new operation(operation::type_e::RECEIVE_FROM, _socket));
+    its_operation->add(boost::asio::buffer_cast<void *>(_buffer),
+            boost::asio::buffer_size(_buffer));
+    its_operation->receive_from_handler_ = _handler;
+    start(std::move(its_operation));
+}
+
+void io_uring_service::async_send(int _socket,
+        const std::vector<boost::asio::const_buffer> &_buffers,
+        send_handler_t _handler) {
+    std::unique_ptr<operation> its_operation(
+            new operation(operation::type_e::SEND, _socket));
+    for (const auto &b : _buffers) {
+        its_operation->add(
+                const_cast<void *>(boost::asio::buffer_cast<const void *>(b)),
+                boost::asio::buffer_size(b));
+    }
+    its_operation->send_handler_ = _handler;
+    start(std::move(its_operation));
+}
+
+void io_uring_service::async_send_to(int _socket,
+        const std::vector<boost::asio::const_buffer> &_buffers,
+        const boost::asio::ip::address &_address, std::uint16_t _port,
+        send_handler_t _handler) {
+    std::unique_ptr<operation> its_operation(
+            new operation(operation::type_e::SEND, _socket));
+    for (const auto &b : _buffers) {
+        its_operation->add(
+                const_cast<void *>(boost::asio::buffer_cast<const void *>(b)),
+                boost::asio::buffer_size(b));
+    }
+    const boost::asio::ip::udp::endpoint its_destination(_address, _port);
+    std::memcpy(&its_operation->name_, its_destination.data(),
+            its_destination.size());
+    its_operation->msg_.msg_name = &its_operation->name_;
+    its_operation->msg_.msg_namelen
+        = static_cast<socklen_t>(its_destination.size());
+    its_operation->send_handler_ = _handler;
+    start(std::move(its_operation));
+}
+
+void io_uring_service::cancel(int _socket) {
+    std::lock_guard<std::mutex> its_lock(mutex_);
+    if (is_shut_down_)
+        return;
+
+    for (auto &o : operations_) {
+        if (o.second->socket_ == _socket && !o.second->is_cancelled_) {
+            io_uring_sqe *its_sqe = get_sqe();
+            if (its_sqe) {
+                its_sqe->opcode = IORING_OP_ASYNC_CANCEL;
+                its_sqe->fd = -1;
+                its_sqe->addr = o.first;
+                its_sqe->user_data = 0;
+            }
+            o.second->is_cancelled_ = true;
+        }
+    }
+    // Submit at once, the socket is closed afterwards
+    submit();
+}
+
+void io_uring_service::shutdown_service() {
+    std::vector<std::pair<std::unique_ptr<operation>, int> > its_dropped;
+    {
+        std::lock_guard<std::mutex> its_lock(mutex_);
+        if (is_shut_down_)
+            return;
+        is_shut_down_ = true;
+
+        if (ring_fd_ >= 0) {
+            for (auto &o : operations_) {
+                io_uring_sqe *its_sqe = get_sqe();
+                if (its_sqe) {
+                    its_sqe->opcode = IORING_OP_ASYNC_CANCEL;
+                    its_sqe->fd = -1;
+                    its_sqe->addr = o.first;
+                    its_sqe->user_data = 0;
+                }
+                o.second->is_cancelled_ = true;
+            }
+            submit();
+
+            // The kernel must not write to the operations after they
+            // have been released.
+            int its_attempts(0);
+            while (!operations_.empty() && its_attempts++ < 100) {
+                reap(its_dropped);
+                if (!operations_.empty())
+                    syscall(__NR_io_uring_enter, ring_fd_, 0, 1,
+                            IORING_ENTER_GETEVENTS, nullptr, 0);
+            }
+        }
+
+        boost::system::error_code its_error;
+        event_descriptor_.close(its_error);
+        close();
+    }
+    // Handlers are dropped without being called, as asio does on shutdown.
+    its_dropped.clear();
+}
+
+void io_uring_service::completion_cbk(
+        const boost::system::error_code &_error, std::size_t _bytes) {
+    (void)_bytes;
+    if (_error) {
+        if (_error != boost::asio::error::operation_aborted) {
+            VSOMEIP_ERROR << "io_uring_service::" << __func__
+                    << ": reading the eventfd failed: " << _error.message();
+        }
+        return;
+    }
+
+    std::vector<std::pair<std::unique_ptr<operation>, int> > its_completed;
+    {
+        std::lock_guard<std::mutex> its_lock(mutex_);
+        if (is_shut_down_)
+            return;
+        is_handling_ = true;
+        reap(its_completed);
+    }
+
+    for (auto &c : its_completed)
+        complete(*c.first, c.second);
+    its_completed.clear();
+
+    {
+        std::lock_guard<std::mutex> its_lock(mutex_);
+        is_handling_ = false;
+        if (is_shut_down_)
+            return;
+        // Operations started by the handlers
+        submit();
+    }
+    start_waiting();
+}
+
+void io_uring_service::start(std::unique_ptr<operation> _operation) {
+    std::unique_lock<std::mutex> its_lock(mutex_);
+    if (is_shut_down_)
+        return;
+
+    if (!start_unlocked(_operation)) {
+        its_lock.unlock();
+        std::shared_ptr<operation> its_operation(std::move(_operation));
+        io_.post([this, its_operation]() {
+            complete(*its_operation, -ENOBUFS);
+        });
+        return;
+    }
+    schedule_submit();
+}
+
+bool io_uring_service::start_unlocked(std::unique_ptr<operation> &_operation) {
+    io_uring_sqe *its_sqe = get_sqe();
+    if (!its_sqe)
+        return false;
+
+    const std::uint64_t its_id(++next_id_);
+    _operation->prepare(its_sqe, its_id);
+    operations_[its_id] = std::move(_operation);
+    return true;
+}
+
+void io_uring_service::complete(operation &_operation, int _result) {
+    boost::system::error_code its_error;
+    std::size_t its_bytes(0);
+    if (_operation.is_cancelled_ || _result == -ECANCELED) {
+        its_error = boost::asio::error::operation_aborted;
+    } else if (_result < 0) {
+        its_error = boost::system::error_code(-_result,
+                boost::system::system_category());
+    } else if (_result == 0 && _operation.type_ == operation::type_e::RECEIVE) {
+        its_error = boost::asio::error::eof;
+    } else {
+        its_bytes = static_cast<std::size_t>(_result);
+    }
+
+    switch (_operation.type_) {
+    case operation::type_e::RECEIVE: {
+        std::uint32_t its_uid(ANY_UID), its_gid(ANY_GID);
+        for (cmsghdr *its_cmsg = (its_error ? nullptr : CMSG_FIRSTHDR(&_operation.msg_));
+                its_cmsg != nullptr;
+                its_cmsg = CMSG_NXTHDR(&_operation.msg_, its_cmsg)) {
+            if (its_cmsg->cmsg_level == SOL_SOCKET
+                    && its_cmsg->cmsg_type == SCM_CREDENTIALS
+                    && its_cmsg->cmsg_len == CMSG_LEN(sizeof(ucred))) {
+                ucred its_credentials;
+                std::memcpy(&its_credentials, CMSG_DATA(its_cmsg),
+                        sizeof(its_credentials));
+                its_uid = its_credentials.uid;
+                its_gid = its_credentials.gid;
+            }
+        }
+        _operation.receive_handler_(its_error, its_bytes, its_uid, its_gid);
+        break;
+    }
+    case operation::type_e::RECEIVE_FROM: {
+        boost::asio::ip::address its_remote_address, its_destination;
+        std::uint16_t its_remote_port(0);
+        if (!its_error) {
+            boost::asio::ip::udp::endpoint its_remote;
+            if (_operation.msg_.msg_namelen <= its_remote.capacity()) {
+                std::memcpy(its_remote.data(), &_operation.name_,
+                        _operation.msg_.msg_namelen);
+                its_remote.resize(_operation.msg_.msg_namelen);
+                its_remote_address = its_remote.address();
+                its_remote_port = its_remote.port();
+            }
+        }
+        for (cmsghdr *its_cmsg = (its_error ? nullptr : CMSG_FIRSTHDR(&_operation.msg_));
+                its_cmsg != nullptr;
+                its_cmsg = CMSG_NXTHDR(&_operation.msg_, its_cmsg)) {
+            if (its_cmsg->cmsg_level == IPPROTO_IP
+                    && its_cmsg->cmsg_type == IP_PKTINFO) {
+                in_pktinfo its_info;
+                std::memcpy(&its_info, CMSG_DATA(its_cmsg), sizeof(its_info));
+                its_destination = boost::asio::ip::address_v4(
+                        ntohl(its_info.ipi_addr.s_addr));
+            } else if (its_cmsg->cmsg_level == IPPROTO_IPV6
+                    && its_cmsg->cmsg_type == IPV6_PKTINFO) {
+                in6_pktinfo its_info;
+                std::memcpy(&its_info, CMSG_DATA(its_cmsg), sizeof(its_info));
+                boost::asio::ip::address_v6::bytes_type its_bytes_v6;
+                std::memcpy(its_bytes_v6.data(), its_info.ipi6_addr.s6_addr,
+                        its_bytes_v6.size());
+                its_destination = boost::asio::ip::address_v6(its_bytes_v6);
+            }
+        }
+        _operation.receive_from_handler_(its_error, its_bytes,
+                its_remote_address, its_remote_port, its_destination);
+        break;
+    }
+    case operation::type_e::SEND:
+        // Partial writes were accounted when they were continued
+        _operation.send_handler_(its_error, _operation.transferred_);
+        break;
+    }
+}
+
+void io_uring_service::start_waiting() {
+    // Reading the eventfd (instead of waiting for it) lets asio try the
+    // read at once and thus no completion signal gets lost.
+    event_descriptor_.async_read_some(
+            boost::asio::buffer(&event_count_, sizeof(event_count_)),
+            std::bind(&io_uring_service::completion_cbk, this,
+                    std::placeholders::_1, std::placeholders::_2));
+}
+
+io_uring_sqe *io_uring_service::get_sqe() {
+    unsigned its_tail(*sq_tail_);
+    if (its_tail - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) >= sq_entries_) {
+        submit();
+        if (its_tail - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) >= sq_entries_) {
+            VSOMEIP_ERROR << "io_uring_service::" << __func__
+                    << ": submission queue is full.";
+            return nullptr;
+        }
+    }
+
+    const unsigned its_index(its_tail & sq_mask_);
+    io_uring_sqe *its_sqe = &sqes_[its_index];
+    std::memset(its_sqe, 0, sizeof(*its_sqe));
+    sq_array_[its_index] = its_index;
+    __atomic_store_n(sq_tail_, its_tail + 1, __ATOMIC_RELEASE);
+    to_submit_++;
+
+    return its_sqe;
+}
+
+void io_uring_service::submit() {
+    while (to_submit_ > 0) {
+        long its_result = syscall(__NR_io_uring_enter, ring_fd_,
+                to_submit_, 0, 0, nullptr, 0);
+        if (its_result < 0) {
+            if (errno == EINTR)
+                continue;
+            if (errno != EAGAIN && errno != EBUSY) {
+                VSOMEIP_ERROR << "io_uring_service::" << __func__
+                        << ": io_uring_enter failed: " << std::strerror(errno);
+            }
+            // Retried with the next submission
+            break;
+        }
+        to_submit_ -= static_cast<unsigned>(its_result);
+    }
+}
+
+void io_uring_service::schedule_submit() {
+    // While completions are handled, the submission is done afterwards.
+    if (is_handling_ || is_submit_scheduled_)
+        return;
+
+    is_submit_scheduled_ = true;
+    io_.post([this]() {
+        std::lock_guard<std::mutex> its_lock(mutex_);
+        is_submit_scheduled_ = false;
+        if (!is_shut_down_)
+            submit();
+    });
+}
+
+std::size_t io_uring_service::reap(
+        std::vector<std::pair<std::unique_ptr<operation>, int> > &_completed) {
+    std::size_t its_count(0);
+    unsigned its_head(*cq_head_);
+    const unsigned its_tail(__atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE));
+    for (; its_head != its_tail; its_head++) {
+        const io_uring_cqe &its_cqe = cqes_[its_head & cq_mask_];
+        if (its_cqe.user_data == 0)
+            continue;
+
+        auto found_operation = operations_.find(its_cqe.user_data);
+        if (found_operation == operations_.end())
+            continue;
+
+        std::unique_ptr<operation> its_operation(
+                std::move(found_operation->second));
+        operations_.erase(found_operation);
+        int its_result(its_cqe.res);
+        if (its_operation->type_ == operation::type_e::SEND
+                && its_result > 0 && !its_operation->is_cancelled_
+                && its_operation->consume(static_cast<std::size_t>(its_result))) {
+            // Partial write, continue with the remaining data
+            if (start_unlocked(its_operation))
+                continue;
+            its_result = -ENOBUFS;
+        }
+        _completed.emplace_back(std::move(its_operation), its_result);
+        its_count++;
+    }
+    __atomic_store_n(cq_head_, its_head, __ATOMIC_RELEASE);
+    return its_count;
+}
+
+void io_uring_service::close() {
+    if (sqes_) {
+        munmap(sqes_, sqes_size_);
+        sqes_ = nullptr;
+    }
+    if (cq_ring_ != MAP_FAILED && cq_ring_ != sq_ring_)
+        munmap(cq_ring_, cq_ring_size_);
+    cq_ring_ = MAP_FAILED;
+    if (sq_ring_ != MAP_FAILED)
+        munmap(sq_ring_, sq_ring_size_);
+    sq_ring_ = MAP_FAILED;
+    if (ring_fd_ >= 0) {
+        ::close(ring_fd_);
+        ring_fd_ = -1;
+    }
+}
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_ENABLE_IO_URING
@@ -16,6 +16,7 @@
 #include "../include/local_server_endpoint_impl.hpp"
 #include "../../routing/include/routing_host.hpp"
 #include "../../security/include/security.hpp"
+#include "../../utility/include/allocation_statistics.hpp"
 
 // Credentials
 #ifndef _WIN32
@@ -161,6 +162,24 @@ void local_client_endpoint_impl::connect() {
 void local_client_endpoint_impl::receive() {
     std::lock_guard<std::mutex> its_lock(socket_mutex_);
     if (socket_->is_open()) {
+#ifdef VSOMEIP_ENABLE_IO_URING
+        if (io_uring_) {
+            io_uring_->async_receive(socket_->native_handle(),
+                boost::asio::buffer(recv_buffer_),
+                strand_.wrap(
+                    std::bind(
+                        &local_client_endpoint_impl::receive_cbk,
+                        std::dynamic_pointer_cast<
+                            local_client_endpoint_impl
+                        >(shared_from_this()),
+                        std::placeholders::_1,
+                        std::placeholders::_2
+                    )
+                )
+            );
+            return;
+        }
+#endif
         socket_->async_receive(
             boost::asio::buffer(recv_buffer_),
             strand_.wrap(
@@ -180,6 +199,7 @@ void local_client_endpoint_impl::receive() {
 // this overrides client_endpoint_impl::send to disable the pull method
 // for local communication
 bool local_client_endpoint_impl::send(const uint8_t *_data, uint32_t _size) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::ENDPOINT);
     std::lock_guard<std::mutex> its_lock(mutex_);
     bool ret(true);
     const bool queue_size_zero_on_entry(queue_.empty());
@@ -221,6 +241,22 @@ void local_client_endpoint_impl::send_queued() {
 
     {
         std::lock_guard<std::mutex> its_lock(socket_mutex_);
+#ifdef VSOMEIP_ENABLE_IO_URING
+        if (io_uring_) {
+            io_uring_->async_send(socket_->native_handle(), bufs,
+                std::bind(
+                    &client_endpoint_impl::send_cbk,
+                    std::dynamic_pointer_cast<
+                        local_client_endpoint_impl
+                    >(shared_from_this()),
+                    std::placeholders::_1,
+                    std::placeholders::_2,
+                    its_buffer
+                )
+            );
+            return;
+        }
+#endif
         boost::asio::async_write(
             *socket_,
             bufs,
@@ -253,6 +289,7 @@ void local_client_endpoint_impl::send_magic_cookie() {
 
 void local_client_endpoint_impl::receive_cbk(
         boost::system::error_code const &_error, std::size_t _bytes) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::ENDPOINT);
     if (_error) {
         if (_error == boost::asio::error::operation_aborted) {
             // endpoint was stopped
@@ -376,10 +413,15 @@ bool local_client_endpoint_impl::send(const std::vector<byte_t>& _cmd_header,
 
     const std::uint32_t its_complete_size = static_cast<std::uint32_t>(
                                                     _cmd_header.size() + _size);
+    // The command header may already contain the SOME/IP header
+    const byte_t *its_message = _data;
+    if (_cmd_header.size() >= VSOMEIP_SEND_COMMAND_PAYLOAD_POS + VSOMEIP_FULL_HEADER_SIZE) {
+        its_message = &_cmd_header[VSOMEIP_SEND_COMMAND_PAYLOAD_POS];
+    }
     if (endpoint_impl::sending_blocked_ ||
         check_message_size(nullptr, its_complete_size) != cms_ret_e::MSG_OK ||
         !check_packetizer_space(its_complete_size)||
-        !check_queue_limit(_data, its_complete_size)) {
+        !check_queue_limit(its_message, its_complete_size)) {
         ret = false;
     } else {
 #if 0
@@ -392,7 +434,9 @@ bool local_client_endpoint_impl::send(const std::vector<byte_t>& _cmd_header,
 #endif
         train_.buffer_->reserve(its_complete_size);
         train_.buffer_->insert(train_.buffer_->end(), _cmd_header.begin(), _cmd_header.end());
-        train_.buffer_->insert(train_.buffer_->end(), _data, _data + _size);
+        if (_size > 0) {
+            train_.buffer_->insert(train_.buffer_->end(), _data, _data + _size);
+        }
         queue_train(queue_size_zero_on_entry);
     }
     return ret;
@@ -16,6 +16,7 @@
 #include "../../routing/include/routing_host.hpp"
 #include "../include/local_server_endpoint_impl.hpp"
 #include "../../security/include/security.hpp"
+#include "../../utility/include/allocation_statistics.hpp"
 #include "../../utility/include/byteorder.hpp"
 #include "../../configuration/include/configuration.hpp"
 #include "../../utility/include/utility.hpp"
@@ -143,6 +144,7 @@ void local_server_endpoint_impl::stop() {
 }
 
 bool local_server_endpoint_impl::send(const uint8_t *_data, uint32_t _size) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::ENDPOINT);
 #if 0
     std::stringstream msg;
     msg << "lse::send ";
@@ -324,18 +326,18 @@ void local_server_endpoint_impl::accept_cbk(
 local_server_endpoint_impl::connection::connection(
         const std::shared_ptr<local_server_endpoint_impl>& _server,
         std::uint32_t _max_message_size,
-        std::uint32_t _initial_recv_buffer_size,
+        std::size_t _recv_buffer_capacity,
         std::uint32_t _buffer_shrink_threshold,
         boost::asio::io_service &_io_service)
     : socket_(_io_service),
       server_(_server),
-      recv_buffer_size_initial_(_initial_recv_buffer_size + 8),
       max_message_size_(_max_message_size),
-      recv_buffer_(recv_buffer_size_initial_, 0),
-      recv_buffer_size_(0),
+      recv_buffer_(_recv_buffer_capacity, _buffer_shrink_threshold),
       missing_capacity_(0),
-      shrink_count_(0),
-      buffer_shrink_threshold_(_buffer_shrink_threshold),
+#ifdef VSOMEIP_ENABLE_IO_URING
+      io_uring_(boost::asio::has_service<io_uring_service>(_io_service) ?
+              &boost::asio::use_service<io_uring_service>(_io_service) : nullptr),
+#endif
       bound_client_(VSOMEIP_CLIENT_UNSET),
 #ifndef _WIN32
       bound_uid_(ANY_UID),
@@ -354,11 +356,9 @@ local_server_endpoint_impl::connection::create(
         std::uint32_t _max_message_size,
         std::uint32_t _buffer_shrink_threshold,
         boost::asio::io_service &_io_service) {
-    const std::uint32_t its_initial_buffer_size = VSOMEIP_COMMAND_HEADER_SIZE
-            + static_cast<std::uint32_t>(sizeof(instance_t) + sizeof(bool)
-                    + sizeof(bool));
-    return ptr(new connection(_server, _max_message_size, its_initial_buffer_size,
-            _buffer_shrink_threshold, _io_service));
+    return ptr(new connection(_server, _max_message_size,
+            VSOMEIP_STREAM_RECEIVE_BUFFER_SIZE, _buffer_shrink_threshold,
+            _io_service));
 }
 
 local_server_endpoint_impl::socket_type &
@@ -374,37 +374,37 @@ local_server_endpoint_impl::connection::get_socket_lock() {
 void local_server_endpoint_impl::connection::start() {
     std::lock_guard<std::mutex> its_lock(socket_mutex_);
     if (socket_.is_open()) {
-        const std::size_t its_capacity(recv_buffer_.capacity());
-        size_t buffer_size = its_capacity - recv_buffer_size_;
+        boost::asio::mutable_buffer its_buffer;
         try {
-            if (missing_capacity_) {
-                if (missing_capacity_ > MESSAGE_SIZE_UNLIMITED) {
-                    VSOMEIP_ERROR << "Missing receive buffer capacity exceeds allowed maximum!";
-                    return;
-                }
-                const std::size_t its_required_capacity(recv_buffer_size_ + missing_capacity_);
-                if (its_capacity < its_required_capacity) {
-                    recv_buffer_.reserve(its_required_capacity);
-                    recv_buffer_.resize(its_required_capacity, 0x0);
-                }
-                buffer_size = missing_capacity_;
-                missing_capacity_ = 0;
-            } else if (buffer_shrink_threshold_
-                    && shrink_count_ > buffer_shrink_threshold_
-                    && recv_buffer_size_ == 0) {
-                recv_buffer_.resize(recv_buffer_size_initial_, 0x0);
-                recv_buffer_.shrink_to_fit();
-                buffer_size = recv_buffer_size_initial_;
-                shrink_count_ = 0;
+            if (missing_capacity_ > MESSAGE_SIZE_UNLIMITED) {
+                VSOMEIP_ERROR << "Missing receive buffer capacity exceeds allowed maximum!";
+                return;
             }
+            its_buffer = recv_buffer_.prepare(missing_capacity_);
+            missing_capacity_ = 0;
         } catch (const std::exception &e) {
             handle_recv_buffer_exception(e);
             // don't start receiving again
             return;
         }
+#ifdef VSOMEIP_ENABLE_IO_URING
+        if (io_uring_) {
+            io_uring_->async_receive(socket_.native_handle(), its_buffer,
+                std::bind(
+                    &local_server_endpoint_impl::connection::receive_cbk,
+                    shared_from_this(),
+                    std::placeholders::_1,
+                    std::placeholders::_2,
+                    std::placeholders::_3,
+                    std::placeholders::_4
+                )
+            );
+            return;
+        }
+#endif
 #ifndef _WIN32
         socket_.async_receive(
-            boost::asio::buffer(&recv_buffer_[recv_buffer_size_], buffer_size),
+            its_buffer,
             std::bind(
                 &local_server_endpoint_impl::connection::receive_cbk,
                 shared_from_this(),
@@ -416,7 +416,7 @@ void local_server_endpoint_impl::connection::start() {
         );
 #else
         socket_.async_receive(
-            boost::asio::buffer(&recv_buffer_[recv_buffer_size_], buffer_size),
+            its_buffer,
             std::bind(
                 &local_server_endpoint_impl::connection::receive_cbk,
                 shared_from_this(),
@@ -436,6 +436,10 @@ void local_server_endpoint_impl::connection::stop() {
             VSOMEIP_ERROR << "lse: socket/handle closed already '" << std::string(std::strerror(errno))
                           << "' (" << errno << ") " << get_path_local();
         }
+#endif
+#ifdef VSOMEIP_ENABLE_IO_URING
+        if (io_uring_)
+            io_uring_->cancel(socket_.native_handle());
 #endif
         boost::system::error_code its_error;
         socket_.shutdown(socket_.shutdown_both, its_error);
@@ -471,6 +475,18 @@ void local_server_endpoint_impl::connection::send_queued(
 
     {
         std::lock_guard<std::mutex> its_lock(socket_mutex_);
+#ifdef VSOMEIP_ENABLE_IO_URING
+        if (io_uring_) {
+            io_uring_->async_send(socket_.native_handle(), bufs,
+                    std::bind(
+                        &local_server_endpoint_impl::connection::send_cbk,
+                        shared_from_this(),
+                        _buffer,
+                        std::placeholders::_1,
+                        std::placeholders::_2));
+            return;
+        }
+#endif
         boost::asio::async_write(
             socket_,
             bufs,
@@ -532,6 +548,7 @@ void local_server_endpoint_impl::connection::receive_cbk(
 #endif
         )
 {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::ENDPOINT);
     std::shared_ptr<local_server_endpoint_impl> its_server(server_.lock());
     if (!its_server) {
         VSOMEIP_TRACE << "local_server_endpoint_impl::connection::receive_cbk "
@@ -564,17 +581,22 @@ void local_server_endpoint_impl::connection::receive_cbk(
 #if 0
         std::stringstream msg;
         msg << "lse::c<" << this << ">rcb: ";
-        for (std::size_t i = 0; i < _bytes + recv_buffer_size_; i++)
+        for (std::size_t i = 0; i < _bytes + recv_buffer_.size(); i++)
             msg << std::setw(2) << std::setfill('0') << std::hex
-                << (int) (recv_buffer_[i]) << " ";
+                << (int) (recv_buffer_.data()[i]) << " ";
         VSOMEIP_INFO << msg.str();
 #endif
 
-        if (recv_buffer_size_ + _bytes < recv_buffer_size_) {
+        if (recv_buffer_.size() + _bytes < recv_buffer_.size()) {
             VSOMEIP_ERROR << "receive buffer overflow in local server endpoint ~> abort!";
             return;
         }
-        recv_buffer_size_ += _bytes;
+        recv_buffer_.commit(_bytes);
+
+        // Commands are parsed in place. The parsed part is consumed
+        // after the loop; unread data stays where it is.
+        const byte_t *its_buffer = recv_buffer_.data();
+        std::size_t its_remaining = recv_buffer_.size();
 
         bool message_is_empty(false);
         bool found_message(false);
@@ -588,27 +610,27 @@ void local_server_endpoint_impl::connection::receive_cbk(
                 VSOMEIP_ERROR << "buffer overflow in local server endpoint ~> abort!";
                 return;
             }
-            while (its_start + 3 < recv_buffer_size_ + its_iteration_gap &&
-                (recv_buffer_[its_start] != 0x67 ||
-                recv_buffer_[its_start+1] != 0x37 ||
-                recv_buffer_[its_start+2] != 0x6d ||
-                recv_buffer_[its_start+3] != 0x07)) {
+            while (its_start + 3 < its_remaining + its_iteration_gap &&
+                (its_buffer[its_start] != 0x67 ||
+                its_buffer[its_start+1] != 0x37 ||
+                its_buffer[its_start+2] != 0x6d ||
+                its_buffer[its_start+3] != 0x07)) {
                 its_start++;
             }
 
-            if (its_start + 3 == recv_buffer_size_ + its_iteration_gap) {
+            if (its_start + 3 == its_remaining + its_iteration_gap) {
                 message_is_empty = true;
             } else {
                 its_start += 4;
             }
 
             if (!message_is_empty) {
-                if (its_start + 6 < recv_buffer_size_ + its_iteration_gap) {
+                if (its_start + 6 < its_remaining + its_iteration_gap) {
                     its_command_size = VSOMEIP_BYTES_TO_LONG(
-                                    recv_buffer_[its_start + 6],
-                                    recv_buffer_[its_start + 5],
-                                    recv_buffer_[its_start + 4],
-                                    recv_buffer_[its_start + 3]);
+                                    its_buffer[its_start + 6],
+                                    its_buffer[its_start + 5],
+                                    its_buffer[its_start + 4],
+                                    its_buffer[its_start + 3]);
 
                     its_end = its_start + 6 + its_command_size;
                 } else {
@@ -621,19 +643,18 @@ void local_server_endpoint_impl::connection::receive_cbk(
                           << "maximum message size (" << std::dec << its_command_size
                           << ") aborting! local: " << get_path_local() << " remote: "
                           << get_path_remote();
-                    recv_buffer_.resize(recv_buffer_size_initial_, 0x0);
-                    recv_buffer_.shrink_to_fit();
+                    recv_buffer_.clear();
                     return;
                 }
                 if (its_end + 3 < its_end) {
                     VSOMEIP_ERROR << "buffer overflow in local server endpoint ~> abort!";
                     return;
                 }
-                while (its_end + 3 < recv_buffer_size_ + its_iteration_gap &&
-                    (recv_buffer_[its_end] != 0x07 ||
-                    recv_buffer_[its_end+1] != 0x6d ||
-                    recv_buffer_[its_end+2] != 0x37 ||
-                    recv_buffer_[its_end+3] != 0x67)) {
+                while (its_end + 3 < its_remaining + its_iteration_gap &&
+                    (its_buffer[its_end] != 0x07 ||
+                    its_buffer[its_end+1] != 0x6d ||
+                    its_buffer[its_end+2] != 0x37 ||
+                    its_buffer[its_end+3] != 0x67)) {
                     its_end ++;
                 }
                 if (its_end + 4 < its_end) {
@@ -641,40 +662,40 @@ void local_server_endpoint_impl::connection::receive_cbk(
                     return;
                 }
                 // check if we received a full message
-                if (recv_buffer_size_ + its_iteration_gap < its_end + 4
-                        || recv_buffer_[its_end] != 0x07
-                        || recv_buffer_[its_end+1] != 0x6d
-                        || recv_buffer_[its_end+2] != 0x37
-                        || recv_buffer_[its_end+3] != 0x67) {
+                if (its_remaining + its_iteration_gap < its_end + 4
+                        || its_buffer[its_end] != 0x07
+                        || its_buffer[its_end+1] != 0x6d
+                        || its_buffer[its_end+2] != 0x37
+                        || its_buffer[its_end+3] != 0x67) {
                     // command (1 Byte) + client id (2 Byte)
                     // + command size (4 Byte) + data itself + stop tag (4 byte)
                     // = 11 Bytes not covered in command size.
-                    if (its_start - its_iteration_gap + its_command_size + 11 > recv_buffer_size_) {
+                    if (its_start - its_iteration_gap + its_command_size + 11 > its_remaining) {
                         missing_capacity_ =
                                 std::uint32_t(its_start) - std::uint32_t(its_iteration_gap)
-                                + its_command_size + 11 - std::uint32_t(recv_buffer_size_);
-                    } else if (recv_buffer_size_ < 11) {
+                                + its_command_size + 11 - std::uint32_t(its_remaining);
+                    } else if (its_remaining < 11) {
                         // to little data to read out the command size
                         // minimal amount of data needed to read out command size = 11
-                        missing_capacity_ = 11 - static_cast<std::uint32_t>(recv_buffer_size_);
+                        missing_capacity_ = 11 - static_cast<std::uint32_t>(its_remaining);
                     } else {
                         std::stringstream local_msg;
                         for (std::size_t i = its_iteration_gap;
-                                i < recv_buffer_size_ + its_iteration_gap &&
+                                i < its_remaining + its_iteration_gap &&
                                 i - its_iteration_gap < 32; i++) {
                             local_msg << std::setw(2) << std::setfill('0')
-                                << std::hex << (int) recv_buffer_[i] << " ";
+                                << std::hex << (int) its_buffer[i] << " ";
                         }
                         VSOMEIP_ERROR << "lse::c<" << this
                                 << ">rcb: recv_buffer_size is: " << std::dec
-                                << recv_buffer_size_ << " but couldn't read "
+                                << its_remaining << " but couldn't read "
                                 "out command size. recv_buffer_capacity: "
                                 << std::dec << recv_buffer_.capacity()
                                 << " its_iteration_gap: " << std::dec
                                 << its_iteration_gap << " bound client: 0x"
                                 << std::hex << bound_client_ << " buffer: "
                                 << local_msg.str();
-                        recv_buffer_size_ = 0;
+                        its_remaining = 0;
                         missing_capacity_ = 0;
                         its_iteration_gap = 0;
                         message_is_empty = true;
@@ -683,12 +704,12 @@ void local_server_endpoint_impl::connection::receive_cbk(
             }
 
             if (!message_is_empty &&
-                its_end + 3 < recv_buffer_size_ + its_iteration_gap) {
+                its_end + 3 < its_remaining + its_iteration_gap) {
 
                 if (its_server->is_routing_endpoint_
-                        && recv_buffer_[its_start] == VSOMEIP_ASSIGN_CLIENT) {
+                        && its_buffer[its_start] == VSOMEIP_ASSIGN_CLIENT) {
                     client_t its_client = its_server->assign_client(
-                            &recv_buffer_[its_start], uint32_t(its_end - its_start));
+                            &its_buffer[its_start], uint32_t(its_end - its_start));
 #ifndef _WIN32
                     if (security::get()->is_enabled()) {
                         if (!its_server->add_connection(its_client, shared_from_this())) {
@@ -725,7 +746,7 @@ void local_server_endpoint_impl::connection::receive_cbk(
 #else
                     credentials_t its_credentials = std::make_pair(ANY_UID, ANY_GID);
 #endif
-                    its_host->on_message(&recv_buffer_[its_start],
+                    its_host->on_message(&its_buffer[its_start],
                                          uint32_t(its_end - its_start), its_server.get(),
                                          boost::asio::ip::address(), bound_client_, its_credentials);
                 } else {
@@ -737,33 +758,20 @@ void local_server_endpoint_impl::connection::receive_cbk(
                         local_msg << "lse::c<" << this << ">rcb::thunk: ";
                         for (std::size_t i = its_start; i < its_end; i++)
                             local_msg << std::setw(2) << std::setfill('0') << std::hex
-                                << (int) recv_buffer_[i] << " ";
+                                << (int) its_buffer[i] << " ";
                         VSOMEIP_INFO << local_msg.str();
                 #endif
-                calculate_shrink_count();
-                recv_buffer_size_ -= (its_end + 4 - its_iteration_gap);
+                its_remaining -= (its_end + 4 - its_iteration_gap);
                 missing_capacity_ = 0;
                 its_command_size = 0;
                 found_message = true;
                 its_iteration_gap = its_end + 4;
-            } else {
-                if (its_iteration_gap) {
-                    // Message not complete and not in front of the buffer!
-                    // Copy last part to front for consume in future receive_cbk call!
-                    for (size_t i = 0; i < recv_buffer_size_; ++i) {
-                        recv_buffer_[i] = recv_buffer_[i + its_iteration_gap];
-                    }
-                    // Still more capacity needed after shifting everything to front?
-                    if (missing_capacity_ &&
-                            missing_capacity_ <= recv_buffer_.capacity() - recv_buffer_size_) {
-                        missing_capacity_ = 0;
-                    }
-                } else if (message_is_empty) {
-                    VSOMEIP_ERROR << "Received garbage data.";
-                    is_error = true;
-                }
+            } else if (!its_iteration_gap && message_is_empty) {
+                VSOMEIP_ERROR << "Received garbage data.";
+                is_error = true;
             }
-        } while (recv_buffer_size_ > 0 && found_message);
+        } while (its_remaining > 0 && found_message);
+        recv_buffer_.consume(recv_buffer_.size() - its_remaining);
     }
 
     if (_error == boost::asio::error::eof
@@ -792,18 +800,6 @@ void local_server_endpoint_impl::connection::set_bound_uid_gid(uid_t _uid, gid_t
 }
 #endif
 
-void local_server_endpoint_impl::connection::calculate_shrink_count() {
-    if (buffer_shrink_threshold_) {
-        if (recv_buffer_.capacity() != recv_buffer_size_initial_) {
-            if (recv_buffer_size_ < (recv_buffer_.capacity() >> 1)) {
-                shrink_count_++;
-            } else {
-                shrink_count_ = 0;
-            }
-        }
-    }
-}
-
 const std::string local_server_endpoint_impl::connection::get_path_local() const {
     boost::system::error_code ec;
     std::string its_local_path;
@@ -848,15 +844,17 @@ void local_server_endpoint_impl::connection::handle_recv_buffer_exception(
             << _e.what() << " local: " << get_path_local() << " remote: "
             << get_path_remote() << " shutting down connection. Start of buffer: ";
 
-    for (std::size_t i = 0; i < recv_buffer_size_ && i < 16; i++) {
+    const byte_t *its_buffer = recv_buffer_.data();
+    const std::size_t its_size = recv_buffer_.size();
+    for (std::size_t i = 0; i < its_size && i < 16; i++) {
         its_message << std::setw(2) << std::setfill('0') << std::hex
-            << (int) (recv_buffer_[i]) << " ";
+            << (int) (its_buffer[i]) << " ";
     }
 
     its_message << " Last 16 Bytes captured: ";
-    for (int i = 15; recv_buffer_size_ > 15u && i >= 0; i--) {
+    for (std::size_t i = (its_size > 16 ? its_size - 16 : its_size); i < its_size; i++) {
         its_message << std::setw(2) << std::setfill('0') << std::hex
-            << (int) (recv_buffer_[static_cast<size_t>(i)]) << " ";
+            << (int) (its_buffer[i]) << " ";
     }
     VSOMEIP_ERROR << its_message.str();
     recv_buffer_.clear();
@@ -866,6 +864,10 @@ void local_server_endpoint_impl::connection::handle_recv_buffer_exception(
             VSOMEIP_ERROR << "lse: socket/handle closed already '" << std::string(std::strerror(errno))
                           << "' (" << errno << ") " << get_path_local();
         }
+#endif
+#ifdef VSOMEIP_ENABLE_IO_URING
+        if (io_uring_)
+            io_uring_->cancel(socket_.native_handle());
 #endif
         boost::system::error_code its_error;
         socket_.shutdown(socket_.shutdown_both, its_error);
@@ -0,0 +1,186 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <cstring>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "../include/receive_buffer.hpp"
+
+#if defined(__linux__) && !defined(ANDROID) && defined(MFD_CLOEXEC)
+#define VSOMEIP_HAS_MIRRORED_RECEIVE_BUFFER
+#endif
+
+namespace vsomeip_v3 {
+
+receive_buffer::receive_buffer(std::size_t _capacity,
+        std::uint32_t _shrink_threshold)
+    : ring_(nullptr),
+      ring_capacity_(_capacity),
+      is_mirrored_(false),
+      is_large_(false),
+      begin_(0),
+      size_(0),
+      shrink_threshold_(_shrink_threshold),
+      shrink_count_(0) {
+    is_mirrored_ = map_ring();
+    if (!is_mirrored_) {
+        linear_.resize(ring_capacity_, 0x0);
+        ring_ = &linear_[0];
+    }
+}
+
+receive_buffer::~receive_buffer() {
+    unmap_ring();
+}
+
+const byte_t *receive_buffer::data() const {
+    return (is_large_ ? &large_[begin_] : &ring_[begin_]);
+}
+
+std::size_t receive_buffer::size() const {
+    return size_;
+}
+
+std::size_t receive_buffer::capacity() const {
+    return (is_large_ ? large_.size() : ring_capacity_);
+}
+
+boost::asio::mutable_buffer receive_buffer::prepare(std::size_t _required) {
+    if (_required == 0)
+        _required = 1;
+
+    if (is_large_) {
+        if (size_ + _required <= ring_capacity_) {
+            // Back to the ring
+            std::memcpy(ring_, &large_[begin_], size_);
+            is_large_ = false;
+            begin_ = 0;
+        }
+    } else if (size_ + _required > ring_capacity_) {
+        if (large_.size() < size_ + _required)
+            large_ = message_buffer_t(size_ + _required, 0x0);
+        std::memcpy(&large_[0], &ring_[begin_], size_);
+        is_large_ = true;
+        begin_ = 0;
+        shrink_count_ = 0;
+    }
+
+    if (is_large_) {
+        if (large_.size() < size_ + _required) {
+            message_buffer_t its_buffer(size_ + _required, 0x0);
+            std::memcpy(&its_buffer[0], &large_[begin_], size_);
+            large_.swap(its_buffer);
+            begin_ = 0;
+        } else if (large_.size() - begin_ - size_ < _required) {
+            std::memmove(&large_[0], &large_[begin_], size_);
+            begin_ = 0;
+        }
+        return boost::asio::buffer(&large_[begin_ + size_], _required);
+    }
+
+    if (is_mirrored_)
+        return boost::asio::buffer(&ring_[begin_ + size_], ring_capacity_ - size_);
+
+    if (ring_capacity_ - begin_ - size_ < _required
+            || begin_ > (ring_capacity_ >> 1)) {
+        std::memmove(ring_, &ring_[begin_], size_);
+        begin_ = 0;
+    }
+    return boost::asio::buffer(&ring_[begin_ + size_],
+            ring_capacity_ - begin_ - size_);
+}
+
+void receive_buffer::commit(std::size_t _bytes) {
+    size_ += _bytes;
+}
+
+void receive_buffer::consume(std::size_t _bytes) {
+    if (_bytes >= size_) {
+        begin_ = 0;
+        size_ = 0;
+        is_large_ = false;
+    } else {
+        begin_ += _bytes;
+        size_ -= _bytes;
+        if (is_mirrored_ && !is_large_ && begin_ >= ring_capacity_)
+            begin_ -= ring_capacity_;
+    }
+
+    if (!is_large_ && shrink_threshold_ && !large_.empty()
+            && ++shrink_count_ > shrink_threshold_) {
+        message_buffer_t().swap(large_);
+        shrink_count_ = 0;
+    }
+}
+
+void receive_buffer::clear() {
+    begin_ = 0;
+    size_ = 0;
+    is_large_ = false;
+    message_buffer_t().swap(large_);
+    shrink_count_ = 0;
+}
+
+#ifdef VSOMEIP_HAS_MIRRORED_RECEIVE_BUFFER
+bool receive_buffer::map_ring() {
+    const long its_page_size = sysconf(_SC_PAGESIZE);
+    if (its_page_size <= 0)
+        return false;
+
+    const std::size_t its_page(static_cast<std::size_t>(its_page_size));
+    const std::size_t its_capacity
+        = ((ring_capacity_ + its_page - 1) / its_page) * its_page;
+
+    int its_fd = memfd_create("vsomeip-receive-buffer", MFD_CLOEXEC);
+    if (its_fd == -1)
+        return false;
+
+    bool is_mapped(false);
+    if (ftruncate(its_fd, static_cast<off_t>(its_capacity)) == 0) {
+        // Reserve address space for both mappings, then map the same
+        // memory into both halves.
+        void *its_address = mmap(nullptr, 2 * its_capacity, PROT_NONE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (its_address != MAP_FAILED) {
+            byte_t *its_ring = static_cast<byte_t *>(its_address);
+            if (mmap(its_ring, its_capacity, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_FIXED, its_fd, 0) != MAP_FAILED
+                    && mmap(its_ring + its_capacity, its_capacity,
+                        PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED,
+                        its_fd, 0) != MAP_FAILED) {
+                ring_ = its_ring;
+                ring_capacity_ = its_capacity;
+                is_mapped = true;
+            } else {
+                munmap(its_address, 2 * its_capacity);
+            }
+        }
+    }
+    close(its_fd);
+
+    return is_mapped;
+}
+
+void receive_buffer::unmap_ring() {
+    if (is_mirrored_) {
+        munmap(ring_, 2 * ring_capacity_);
+        ring_ = nullptr;
+        is_mirrored_ = false;
+    }
+}
+#else
+bool receive_buffer::map_ring() {
+    return false;
+}
+
+void receive_buffer::unmap_ring() {
+}
+#endif
+
+} // namespace vsomeip_v3
@@ -6,7 +6,6 @@
 #include <iomanip>
 #include <sstream>
 #include <limits>
-#include <thread>
 #include <algorithm>
 
 #include <boost/asio/buffer.hpp>
@@ -20,6 +19,7 @@
 #include "../include/server_endpoint_impl.hpp"
 #include "../include/endpoint_definition.hpp"
 
+#include "../../utility/include/allocation_statistics.hpp"
 #include "../../utility/include/byteorder.hpp"
 #include "../../utility/include/utility.hpp"
 #include "../../service_discovery/include/defines.hpp"
@@ -35,6 +35,8 @@ server_endpoint_impl<Protocol>::server_endpoint_impl(
         const std::shared_ptr<configuration>& _configuration)
     : endpoint_impl<Protocol>(_endpoint_host, _routing_host, _local, _io, _max_message_size,
                               _queue_limit, _configuration),
+                              departure_timer_(_io),
+                              departure_timer_expiry_(std::chrono::steady_clock::time_point::max()),
                               sent_timer_(_io) {
     is_sending_ = false;
 }
@@ -51,9 +53,13 @@ void server_endpoint_impl<Protocol>::prepare_stop(
     if (_service == ANY_SERVICE) { // endpoint is shutting down completely
         endpoint_impl<Protocol>::sending_blocked_ = true;
         boost::system::error_code ec;
+        departure_timer_.cancel(ec);
+        departure_timer_expiry_ = std::chrono::steady_clock::time_point::max();
+        departures_.clear();
         for (auto const& train_iter : trains_) {
-            train_iter.second->departure_timer_->cancel(ec);
-            if (train_iter.second->buffer_->size() > 0) {
+            train_iter.second->scheduled_ = std::chrono::steady_clock::time_point::max();
+            if (train_iter.second->buffer_->size() > 0
+                    || !train_iter.second->departing_.empty()) {
                 auto target_queue_iter = queues_.find(train_iter.first);
                 if (target_queue_iter != queues_.end()) {
                     auto& its_qpair = target_queue_iter->second;
@@ -66,23 +72,25 @@ void server_endpoint_impl<Protocol>::prepare_stop(
         }
     } else {
         for (auto const& train_iter : trains_) {
+            // Deferred departures may carry messages of the service as well
+            bool has_passenger(!train_iter.second->departing_.empty());
             for (auto const& passenger_iter : train_iter.second->passengers_) {
                 if (passenger_iter.first == _service) {
-                    // cancel departure timer
-                    boost::system::error_code ec;
-                    train_iter.second->departure_timer_->cancel(ec);
-                    // queue train
-                    auto target_queue_iter = queues_.find(train_iter.first);
-                    if (target_queue_iter != queues_.end()) {
-                        const auto& its_qpair = target_queue_iter->second;
-                        const bool queue_size_zero_on_entry(its_qpair.second.empty());
-                        queue_train(target_queue_iter, train_iter.second,
-                                queue_size_zero_on_entry);
-                        queued_train = true;
-                    }
+                    has_passenger = true;
                     break;
                 }
             }
+            if (has_passenger) {
+                // queue train
+                auto target_queue_iter = queues_.find(train_iter.first);
+                if (target_queue_iter != queues_.end()) {
+                    const auto& its_qpair = target_queue_iter->second;
+                    const bool queue_size_zero_on_entry(its_qpair.second.empty());
+                    queue_train(target_queue_iter, train_iter.second,
+                            queue_size_zero_on_entry);
+                    queued_train = true;
+                }
+            }
         }
     }
     if (!queued_train) {
@@ -166,6 +174,7 @@ void server_endpoint_impl<Protocol>::set_connected(bool _connected) {
 
 template<typename Protocol>bool server_endpoint_impl<Protocol>::send(const uint8_t *_data,
         uint32_t _size) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::ENDPOINT);
 #if 0
     std::stringstream msg;
     msg << "sei::send ";
@@ -284,11 +293,17 @@ bool server_endpoint_impl<Protocol>::send_intern(
     std::shared_ptr<train> target_train = find_or_create_train_unlocked(_target);
 
     const bool queue_size_zero_on_entry(target_queue_iterator->second.second.empty());
-    if (!check_queue_limit(_data, _size, target_queue_iterator->second.first)) {
+    std::size_t its_queue_size(target_queue_iterator->second.first);
+    if (endpoint_impl<Protocol>::queue_limit_ != QUEUE_SIZE_UNLIMITED) {
+        its_queue_size += target_train->get_departing_size();
+    }
+    if (!check_queue_limit(_data, _size, its_queue_size)) {
         return false;
     }
-    // STEP 2: Determine elapsed time and update the departure time and cancel the timer
-    target_train->update_departure_time_and_stop_departure();
+    // STEP 2: Determine the time left until the train departs
+    const std::chrono::steady_clock::time_point its_now
+        = std::chrono::steady_clock::now();
+    target_train->update_departure_time(its_now);
 
     // STEP 3: Get configured timings
     const service_t its_service = VSOMEIP_BYTES_TO_WORD(
@@ -346,9 +361,8 @@ bool server_endpoint_impl<Protocol>::send_intern(
     // STEP 8: if necessary, send current buffer and create a new one
     if (must_depart) {
         // STEP 8.1: check if debounce time would be undershot here if the train
-        // departs. Block sending until train is allowed to depart.
-        wait_until_debounce_time_reached(target_train);
-        queue_train(target_queue_iterator, target_train,
+        // departs. If so, the train is scheduled to depart once it is allowed to.
+        depart_train_unlocked(target_queue_iterator, target_train,
                 queue_size_zero_on_entry);
         target_train->departure_ = its_retention;
     }
@@ -365,18 +379,9 @@ bool server_endpoint_impl<Protocol>::send_intern(
         target_train->minimal_max_retention_time_ = its_retention;
     }
 
-    // STEP 10: restart timer with current departure time
-#ifndef _WIN32
-    target_train->departure_timer_->expires_from_now(target_train->departure_);
-#else
-    target_train->departure_timer_->expires_from_now(
-            std::chrono::duration_cast<
-                std::chrono::steady_clock::duration>(target_train->departure_));
-#endif
-    target_train->departure_timer_->async_wait(
-        std::bind(&server_endpoint_impl<Protocol>::flush_cbk,
-                  this->shared_from_this(), _target,
-                  target_train, std::placeholders::_1));
+    // STEP 10: schedule the train for its current departure time
+    target_train->departure_time_ = train::add(its_now, target_train->departure_);
+    schedule_train_unlocked(_target, target_train);
 
     return (true);
 }
@@ -392,7 +397,6 @@ void server_endpoint_impl<Protocol>::send_segments(
     const bool queue_size_zero_on_entry(target_queue_iterator->second.second.empty());
 
     std::shared_ptr<train> target_train = find_or_create_train_unlocked(_target);
-    target_train->update_departure_time_and_stop_departure();
 
     const service_t its_service = VSOMEIP_BYTES_TO_WORD(
             (*(_segments[0]))[VSOMEIP_SERVICE_POS_MIN], (*(_segments[0]))[VSOMEIP_SERVICE_POS_MAX]);
@@ -415,34 +419,35 @@ void server_endpoint_impl<Protocol>::send_segments(
     // We only need to respect the debouncing. There is no need to wait for further
     // messages as we will send several now anyway.
     if (!target_train->passengers_.empty()) {
-        wait_until_debounce_time_reached(target_train);
-        queue_train(target_queue_iterator, target_train, queue_size_zero_on_entry);
-    }
-
-    const bool queue_size_still_zero(target_queue_iterator->second.second.empty());
-    for (const auto &s : _segments) {
-        target_queue_iterator->second.second.emplace_back(s);
-        target_queue_iterator->second.first += s->size();
+        depart_train_unlocked(target_queue_iterator, target_train, queue_size_zero_on_entry);
     }
-    if (queue_size_still_zero && !target_queue_iterator->second.second.empty()) { // no writing in progress
-        // respect minimal debounce time
-        wait_until_debounce_time_reached(target_train);
-        // ignore retention time and send immediately as the train is full anyway
-        send_queued(target_queue_iterator);
-    }
-    target_train->last_departure_ = std::chrono::steady_clock::now();
-}
-
-template<typename Protocol>
-void server_endpoint_impl<Protocol>::wait_until_debounce_time_reached(
-        const std::shared_ptr<train>& _train) const {
-    const std::chrono::nanoseconds time_since_last_departure =
-            std::chrono::duration_cast<std::chrono::nanoseconds>(
-                    std::chrono::steady_clock::now() - _train->last_departure_);
 
-    if (time_since_last_departure < _train->minimal_debounce_time_) {
-        std::this_thread::sleep_for(
-                _train->minimal_debounce_time_ - time_since_last_departure);
+    // respect minimal debounce time
+    const std::chrono::steady_clock::time_point its_now
+        = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point its_departure
+        = train::add(target_train->last_departure_, its_debouncing);
+    if (target_train->departing_.empty() && its_departure <= its_now) {
+        const bool queue_size_still_zero(target_queue_iterator->second.second.empty());
+        for (const auto &s : _segments) {
+            target_queue_iterator->second.second.emplace_back(s);
+            target_queue_iterator->second.first += s->size();
+        }
+        if (queue_size_still_zero && !target_queue_iterator->second.second.empty()) { // no writing in progress
+            // ignore retention time and send immediately as the train is full anyway
+            send_queued(target_queue_iterator);
+        }
+        target_train->last_departure_ = its_now;
+    } else {
+        // segments leave together as soon as the debounce time is reached
+        if (its_departure < its_now) {
+            its_departure = its_now;
+        }
+        for (const auto &s : _segments) {
+            target_train->departing_.emplace_back(its_departure, s);
+        }
+        target_train->last_departure_ = its_departure;
+        schedule_train_unlocked(_target, target_train);
     }
 }
 
@@ -520,11 +525,20 @@ void server_endpoint_impl<Protocol>::queue_train(
                      const queue_iterator_type _queue_iterator,
                      const std::shared_ptr<train>& _train,
                      bool _queue_size_zero_on_entry) {
-    _queue_iterator->second.second.emplace_back(_train->buffer_);
-    _queue_iterator->second.first += _train->buffer_->size();
+    // deferred departures leave first to keep the message order
+    for (const auto &d : _train->departing_) {
+        _queue_iterator->second.second.emplace_back(d.second);
+        _queue_iterator->second.first += d.second->size();
+    }
+    _train->departing_.clear();
+    if (!_train->buffer_->empty()) {
+        _queue_iterator->second.second.emplace_back(_train->buffer_);
+        _queue_iterator->second.first += _train->buffer_->size();
+        _train->buffer_ = std::make_shared<message_buffer_t>();
+    }
     _train->last_departure_ = std::chrono::steady_clock::now();
     _train->passengers_.clear();
-    _train->buffer_ = std::make_shared<message_buffer_t>();
+    _train->departure_time_ = std::chrono::steady_clock::time_point::max();
     _train->minimal_debounce_time_ = std::chrono::nanoseconds::max();
     _train->minimal_max_retention_time_ = std::chrono::nanoseconds::max();
     if (_queue_size_zero_on_entry && !_queue_iterator->second.second.empty()) { // no writing in progress
@@ -553,18 +567,61 @@ std::shared_ptr<train> server_endpoint_impl<Protocol>::find_or_create_train_unlo
     auto train_iter = trains_.find(_target);
     if (train_iter == trains_.end()) {
         train_iter = trains_.insert(trains_.begin(),
-                                    std::make_pair(_target, std::make_shared<train>(this->service_)));
+                                    std::make_pair(_target, std::make_shared<train>()));
     }
     return train_iter->second;
 }
 
+template<typename Protocol>
+void server_endpoint_impl<Protocol>::depart_train_unlocked(
+        const queue_iterator_type _queue_iterator,
+        const std::shared_ptr<train>& _train,
+        bool _queue_size_zero_on_entry) {
+    if (_train->departing_.empty()
+            && _train->get_earliest_departure() <= std::chrono::steady_clock::now()) {
+        queue_train(_queue_iterator, _train, _queue_size_zero_on_entry);
+    } else {
+        _train->defer_departure(std::chrono::steady_clock::now());
+    }
+}
+
+template<typename Protocol>
+void server_endpoint_impl<Protocol>::schedule_train_unlocked(
+        const endpoint_type& _target, const std::shared_ptr<train>& _train) {
+    // Entries are only ever moved forward. Outdated ones are dropped when
+    // they are due and the train is rescheduled then.
+    const std::chrono::steady_clock::time_point its_departure
+        = _train->get_next_departure();
+    if (its_departure < _train->scheduled_) {
+        if (_train->scheduled_ != std::chrono::steady_clock::time_point::max()) {
+            departures_.erase(std::make_pair(_train->scheduled_, _target));
+        }
+        departures_.emplace(its_departure, _target);
+        _train->scheduled_ = its_departure;
+        start_departure_timer_unlocked();
+    }
+}
+
+template<typename Protocol>
+void server_endpoint_impl<Protocol>::start_departure_timer_unlocked() {
+    if (!departures_.empty()
+            && departures_.begin()->first < departure_timer_expiry_) {
+        departure_timer_expiry_ = departures_.begin()->first;
+        boost::system::error_code ec;
+        departure_timer_.expires_at(departure_timer_expiry_, ec);
+        departure_timer_.async_wait(
+            std::bind(&server_endpoint_impl<Protocol>::flush_cbk,
+                      this->shared_from_this(), std::placeholders::_1));
+    }
+}
+
 template<typename Protocol>
 bool server_endpoint_impl<Protocol>::flush(
         endpoint_type _target,
         const std::shared_ptr<train>& _train) {
     std::lock_guard<std::mutex> its_lock(mutex_);
     bool is_flushed = false;
-    if (!_train->buffer_->empty()) {
+    if (!_train->buffer_->empty() || !_train->departing_.empty()) {
         const queue_iterator_type target_queue_iterator = queues_.find(_target);
         if (target_queue_iterator != queues_.end()) {
             const bool queue_size_zero_on_entry(target_queue_iterator->second.second.empty());
@@ -593,6 +650,7 @@ void server_endpoint_impl<Protocol>::connect_cbk(
 template<typename Protocol>
 void server_endpoint_impl<Protocol>::send_cbk(
         const queue_iterator_type _queue_iterator,
+        const std::vector<message_buffer_ptr_t> &_sent_trains,
         boost::system::error_code const &_error, std::size_t _bytes) {
     (void)_bytes;
 
@@ -677,8 +735,16 @@ void server_endpoint_impl<Protocol>::send_cbk(
 
     auto& its_qpair = _queue_iterator->second;
     if (!_error) {
-        its_qpair.first -= its_qpair.second.front()->size();
-        its_qpair.second.pop_front();
+        // Only remove the sent trains, the queue might have changed while
+        // the write was in progress
+        bool has_sent(false);
+        for (const auto &t : _sent_trains) {
+            if (its_qpair.second.empty() || its_qpair.second.front() != t)
+                break;
+            its_qpair.first -= t->size();
+            its_qpair.second.pop_front();
+            has_sent = true;
+        }
 
         if (!prepare_stop_handlers_.empty() && !endpoint_impl<Protocol>::sending_blocked_) {
             // only one service instance is stopped
@@ -686,7 +752,9 @@ void server_endpoint_impl<Protocol>::send_cbk(
         }
 
         if (its_qpair.second.size() > 0) {
-            send_queued(_queue_iterator);
+            if (has_sent) {
+                send_queued(_queue_iterator);
+            }
         } else if (!prepare_stop_handlers_.empty() && endpoint_impl<Protocol>::sending_blocked_) {
             // endpoint is shutting down completely
             queues_.erase(_queue_iterator);
@@ -694,8 +762,8 @@ void server_endpoint_impl<Protocol>::send_cbk(
         }
     } else {
         message_buffer_ptr_t its_buffer;
-        if (_queue_iterator->second.second.size()) {
-            its_buffer = _queue_iterator->second.second.front();
+        if (_sent_trains.size()) {
+            its_buffer = _sent_trains.front();
         }
         service_t its_service(0);
         method_t its_method(0);
@@ -743,11 +811,50 @@ void server_endpoint_impl<Protocol>::send_cbk(
 
 template<typename Protocol>
 void server_endpoint_impl<Protocol>::flush_cbk(
-        endpoint_type _target,
-        const std::shared_ptr<train>& _train, const boost::system::error_code &_error_code) {
-    if (!_error_code) {
-        (void) flush(_target, _train);
+        const boost::system::error_code &_error_code) {
+    if (_error_code) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> its_lock(mutex_);
+    const std::chrono::steady_clock::time_point its_now
+        = std::chrono::steady_clock::now();
+    while (!departures_.empty() && departures_.begin()->first <= its_now) {
+        const endpoint_type its_target(departures_.begin()->second);
+        departures_.erase(departures_.begin());
+
+        auto found_train = trains_.find(its_target);
+        if (found_train == trains_.end()) {
+            continue;
+        }
+        const std::shared_ptr<train> its_train(found_train->second);
+        its_train->scheduled_ = std::chrono::steady_clock::time_point::max();
+
+        const queue_iterator_type target_queue_iterator = queues_.find(its_target);
+        if (target_queue_iterator == queues_.end()) {
+            VSOMEIP_WARNING << "sei::flush_cbk couldn't find target queue, "
+                    "won't queue train to: " << get_remote_information(its_target);
+            continue;
+        }
+        auto& its_qpair = target_queue_iterator->second;
+        const bool queue_size_zero_on_entry(its_qpair.second.empty());
+        while (!its_train->departing_.empty()
+                && its_train->departing_.front().first <= its_now) {
+            its_qpair.second.emplace_back(its_train->departing_.front().second);
+            its_qpair.first += its_train->departing_.front().second->size();
+            its_train->departing_.pop_front();
+        }
+        if (its_train->departing_.empty() && !its_train->buffer_->empty()
+                && its_train->departure_time_ <= its_now) {
+            queue_train(target_queue_iterator, its_train, false);
+        }
+        if (queue_size_zero_on_entry && !its_qpair.second.empty()) { // no writing in progress
+            send_queued(target_queue_iterator);
+        }
+        schedule_train_unlocked(its_target, its_train);
     }
+    departure_timer_expiry_ = std::chrono::steady_clock::time_point::max();
+    start_departure_timer_unlocked();
 }
 
 template<typename Protocol>
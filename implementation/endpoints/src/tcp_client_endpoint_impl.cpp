@@ -14,6 +14,7 @@
 #include "../include/endpoint_host.hpp"
 #include "../../routing/include/routing_host.hpp"
 #include "../include/tcp_client_endpoint_impl.hpp"
+#include "../../utility/include/allocation_statistics.hpp"
 #include "../../utility/include/utility.hpp"
 #include "../../utility/include/byteorder.hpp"
 
@@ -44,6 +45,7 @@ tcp_client_endpoint_impl::tcp_client_endpoint_impl(
       remote_address_(_remote.address()),
       remote_port_(_remote.port()),
       last_cookie_sent_(std::chrono::steady_clock::now() - std::chrono::seconds(11)),
+      coalescing_limit_(configuration_->get_tcp_coalescing_limit()),
       // send timeout after 2/3 of configured ttl, warning after 1/3
       send_timeout_(configuration_->get_sd_ttl() * 666),
       send_timeout_warning_(send_timeout_ / 2),
@@ -261,6 +263,24 @@ void tcp_client_endpoint_impl::receive(message_buffer_ptr_t  _recv_buffer,
             // don't start receiving again
             return;
         }
+#ifdef VSOMEIP_ENABLE_IO_URING
+        if (io_uring_) {
+            io_uring_->async_receive(socket_->native_handle(),
+                boost::asio::buffer(&(*_recv_buffer)[_recv_buffer_size], buffer_size),
+                strand_.wrap(
+                    std::bind(
+                        &tcp_client_endpoint_impl::receive_cbk,
+                        std::dynamic_pointer_cast< tcp_client_endpoint_impl >(shared_from_this()),
+                        std::placeholders::_1,
+                        std::placeholders::_2,
+                        _recv_buffer,
+                        _recv_buffer_size
+                    )
+                )
+            );
+            return;
+        }
+#endif
         socket_->async_receive(
             boost::asio::buffer(&(*_recv_buffer)[_recv_buffer_size], buffer_size),
             strand_.wrap(
@@ -297,16 +317,31 @@ void tcp_client_endpoint_impl::send_queued() {
             (*its_buffer)[VSOMEIP_SESSION_POS_MIN],
             (*its_buffer)[VSOMEIP_SESSION_POS_MAX]);
 
+    std::vector<boost::asio::const_buffer> its_buffers;
+    std::size_t its_size(0);
     if (has_enabled_magic_cookies_) {
         const std::chrono::steady_clock::time_point now =
                 std::chrono::steady_clock::now();
         if (std::chrono::duration_cast<std::chrono::milliseconds>(
                 now - last_cookie_sent_) > std::chrono::milliseconds(10000)) {
-            send_magic_cookie(its_buffer);
+            its_buffers.push_back(boost::asio::buffer(CLIENT_COOKIE));
+            its_size += sizeof(CLIENT_COOKIE);
             last_cookie_sent_ = now;
         }
     }
 
+    // Write as many queued trains as the coalescing limit allows, but
+    // at least one, with a single (gathering) write operation. The trains
+    // stay queued until send_trains_cbk removes them and are bound to the
+    // completion handler to keep them alive even if the queue is cleared.
+    std::vector<message_buffer_ptr_t> its_trains;
+    for (const auto &t : queue_) {
+        if (!its_trains.empty() && its_size + t->size() > coalescing_limit_)
+            break;
+        its_buffers.push_back(boost::asio::buffer(*t));
+        its_size += t->size();
+        its_trains.push_back(t);
+    }
 
 #if 0
     std::stringstream msg;
@@ -324,22 +359,43 @@ void tcp_client_endpoint_impl::send_queued() {
                 std::lock_guard<std::mutex> its_sent_lock(sent_mutex_);
                 is_sending_ = true;
             }
+#ifdef VSOMEIP_ENABLE_IO_URING
+            if (io_uring_) {
+                const std::shared_ptr<tcp_client_endpoint_impl> its_endpoint(
+                        std::static_pointer_cast<tcp_client_endpoint_impl>(shared_from_this()));
+                const std::chrono::steady_clock::time_point its_start(
+                        std::chrono::steady_clock::now());
+                io_uring_->async_send(socket_->native_handle(), its_buffers,
+                        [its_endpoint, its_trains, its_size, its_service,
+                         its_method, its_client, its_session, its_start](
+                                const boost::system::error_code &_error,
+                                std::size_t _bytes) {
+                    // Reports errors and slow writes as the completion
+                    // condition of async_write does
+                    its_endpoint->write_completion_condition(_error, _bytes,
+                            its_size, its_service, its_method, its_client,
+                            its_session, its_start);
+                    its_endpoint->send_trains_cbk(_error, _bytes, its_trains);
+                });
+                return;
+            }
+#endif
             boost::asio::async_write(
                 *socket_,
-                boost::asio::buffer(*its_buffer),
+                its_buffers,
                 std::bind(&tcp_client_endpoint_impl::write_completion_condition,
                           std::static_pointer_cast<tcp_client_endpoint_impl>(shared_from_this()),
                           std::placeholders::_1,
                           std::placeholders::_2,
-                          its_buffer->size(),
+                          its_size,
                           its_service, its_method, its_client, its_session,
                           std::chrono::steady_clock::now()),
                 std::bind(
-                    &tcp_client_endpoint_base_impl::send_cbk,
-                    shared_from_this(),
+                    &tcp_client_endpoint_impl::send_trains_cbk,
+                    std::static_pointer_cast<tcp_client_endpoint_impl>(shared_from_this()),
                     std::placeholders::_1,
                     std::placeholders::_2,
-                    its_buffer
+                    its_trains
                 )
             );
         }
@@ -440,24 +496,10 @@ bool tcp_client_endpoint_impl::is_magic_cookie(const message_buffer_ptr_t& _recv
     return (0 == std::memcmp(SERVICE_COOKIE, &(*_recv_buffer)[_offset], sizeof(SERVICE_COOKIE)));
 }
 
-void tcp_client_endpoint_impl::send_magic_cookie(message_buffer_ptr_t &_buffer) {
-    if (max_message_size_ == MESSAGE_SIZE_UNLIMITED
-            || max_message_size_ - _buffer->size() >=
-        VSOMEIP_SOMEIP_HEADER_SIZE + VSOMEIP_SOMEIP_MAGIC_COOKIE_SIZE) {
-        _buffer->insert(
-            _buffer->begin(),
-            CLIENT_COOKIE,
-            CLIENT_COOKIE + sizeof(CLIENT_COOKIE)
-        );
-        queue_size_ += sizeof(CLIENT_COOKIE);
-    } else {
-        VSOMEIP_WARNING << "Packet full. Cannot insert magic cookie!";
-    }
-}
-
 void tcp_client_endpoint_impl::receive_cbk(
         boost::system::error_code const &_error, std::size_t _bytes,
         const message_buffer_ptr_t& _recv_buffer, std::size_t _recv_buffer_size) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::ENDPOINT);
     if (_error == boost::asio::error::operation_aborted) {
         // endpoint was stopped
         return;
@@ -782,6 +824,10 @@ void tcp_client_endpoint_impl::handle_recv_buffer_exception(
         connect_timer_.cancel(ec);
     }
     if (socket_->is_open()) {
+#ifdef VSOMEIP_ENABLE_IO_URING
+        if (io_uring_)
+            io_uring_->cancel(socket_->native_handle());
+#endif
         boost::system::error_code its_error;
         socket_->shutdown(socket_type::shutdown_both, its_error);
         socket_->close(its_error);
@@ -820,6 +866,13 @@ std::string tcp_client_endpoint_impl::get_remote_information() const {
 void tcp_client_endpoint_impl::send_cbk(boost::system::error_code const &_error,
                                         std::size_t _bytes,
                                         const message_buffer_ptr_t& _sent_msg) {
+    send_trains_cbk(_error, _bytes,
+            std::vector<message_buffer_ptr_t>(1, _sent_msg));
+}
+
+void tcp_client_endpoint_impl::send_trains_cbk(
+        boost::system::error_code const &_error, std::size_t _bytes,
+        const std::vector<message_buffer_ptr_t> &_sent_trains) {
     (void)_bytes;
 
     {
@@ -835,9 +888,17 @@ void tcp_client_endpoint_impl::send_cbk(boost::system::error_code const &_error,
 
     if (!_error) {
         std::lock_guard<std::mutex> its_lock(mutex_);
-        if (queue_.size() > 0) {
-            queue_size_ -= queue_.front()->size();
+        // Only remove the sent trains. The queue might have been cleared
+        // (and refilled) by a restart while the write was in progress.
+        bool has_sent(false);
+        for (const auto &t : _sent_trains) {
+            if (queue_.empty() || queue_.front() != t)
+                break;
+            queue_size_ -= t->size();
             queue_.pop_front();
+            has_sent = true;
+        }
+        if (has_sent && queue_.size() > 0) {
             send_queued();
         }
     } else if (_error == boost::system::errc::destination_address_required) {
@@ -865,19 +926,21 @@ void tcp_client_endpoint_impl::send_cbk(boost::system::error_code const &_error,
         method_t its_method(0);
         client_t its_client(0);
         session_t its_session(0);
-        if (_sent_msg && _sent_msg->size() > VSOMEIP_SESSION_POS_MAX) {
+        const message_buffer_ptr_t its_sent_msg(
+                _sent_trains.empty() ? nullptr : _sent_trains.front());
+        if (its_sent_msg && its_sent_msg->size() > VSOMEIP_SESSION_POS_MAX) {
             its_service = VSOMEIP_BYTES_TO_WORD(
-                    (*_sent_msg)[VSOMEIP_SERVICE_POS_MIN],
-                    (*_sent_msg)[VSOMEIP_SERVICE_POS_MAX]);
+                    (*its_sent_msg)[VSOMEIP_SERVICE_POS_MIN],
+                    (*its_sent_msg)[VSOMEIP_SERVICE_POS_MAX]);
             its_method = VSOMEIP_BYTES_TO_WORD(
-                    (*_sent_msg)[VSOMEIP_METHOD_POS_MIN],
-                    (*_sent_msg)[VSOMEIP_METHOD_POS_MAX]);
+                    (*its_sent_msg)[VSOMEIP_METHOD_POS_MIN],
+                    (*its_sent_msg)[VSOMEIP_METHOD_POS_MAX]);
             its_client = VSOMEIP_BYTES_TO_WORD(
-                    (*_sent_msg)[VSOMEIP_CLIENT_POS_MIN],
-                    (*_sent_msg)[VSOMEIP_CLIENT_POS_MAX]);
+                    (*its_sent_msg)[VSOMEIP_CLIENT_POS_MIN],
+                    (*its_sent_msg)[VSOMEIP_CLIENT_POS_MAX]);
             its_session = VSOMEIP_BYTES_TO_WORD(
-                    (*_sent_msg)[VSOMEIP_SESSION_POS_MIN],
-                    (*_sent_msg)[VSOMEIP_SESSION_POS_MAX]);
+                    (*its_sent_msg)[VSOMEIP_SESSION_POS_MIN],
+                    (*its_sent_msg)[VSOMEIP_SESSION_POS_MAX]);
         }
         VSOMEIP_WARNING << "tce::send_cbk received error: "
                 << _error.message() << " (" << std::dec
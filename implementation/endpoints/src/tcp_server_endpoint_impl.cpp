@@ -15,6 +15,7 @@
 #include "../include/endpoint_host.hpp"
 #include "../../routing/include/routing_host.hpp"
 #include "../include/tcp_server_endpoint_impl.hpp"
+#include "../../utility/include/allocation_statistics.hpp"
 #include "../../utility/include/utility.hpp"
 #include "../../utility/include/byteorder.hpp"
 
@@ -36,7 +37,8 @@ tcp_server_endpoint_impl::tcp_server_endpoint_impl(
         buffer_shrink_threshold_(configuration_->get_buffer_shrink_threshold()),
         local_port_(_local.port()),
         // send timeout after 2/3 of configured ttl, warning after 1/3
-        send_timeout_(configuration_->get_sd_ttl() * 666) {
+        send_timeout_(configuration_->get_sd_ttl() * 666),
+        coalescing_limit_(configuration_->get_tcp_coalescing_limit()) {
     is_supporting_magic_cookies_ = true;
 
     boost::system::error_code ec;
@@ -110,6 +112,7 @@ void tcp_server_endpoint_impl::stop() {
 bool tcp_server_endpoint_impl::send_to(
         const std::shared_ptr<endpoint_definition> _target,
         const byte_t *_data,  uint32_t _size) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::ENDPOINT);
     std::lock_guard<std::mutex> its_lock(mutex_);
     endpoint_type its_target(_target->get_address(), _target->get_port());
     return send_intern(its_target, _data, _size);
@@ -269,7 +272,7 @@ bool tcp_server_endpoint_impl::is_reliable() const {
 tcp_server_endpoint_impl::connection::connection(
         const std::weak_ptr<tcp_server_endpoint_impl>& _server,
         std::uint32_t _max_message_size,
-        std::uint32_t _recv_buffer_size_initial,
+        std::size_t _recv_buffer_capacity,
         std::uint32_t _buffer_shrink_threshold,
         bool _magic_cookies_enabled,
         boost::asio::io_service &_io_service,
@@ -277,12 +280,12 @@ tcp_server_endpoint_impl::connection::connection(
         socket_(_io_service),
         server_(_server),
         max_message_size_(_max_message_size),
-        recv_buffer_size_initial_(_recv_buffer_size_initial),
-        recv_buffer_(_recv_buffer_size_initial, 0),
-        recv_buffer_size_(0),
+        recv_buffer_(_recv_buffer_capacity, _buffer_shrink_threshold),
         missing_capacity_(0),
-        shrink_count_(0),
-        buffer_shrink_threshold_(_buffer_shrink_threshold),
+#ifdef VSOMEIP_ENABLE_IO_URING
+        io_uring_(boost::asio::has_service<io_uring_service>(_io_service) ?
+                &boost::asio::use_service<io_uring_service>(_io_service) : nullptr),
+#endif
         remote_port_(0),
         magic_cookies_enabled_(_magic_cookies_enabled),
         last_cookie_sent_(std::chrono::steady_clock::now() - std::chrono::seconds(11)),
@@ -298,10 +301,8 @@ tcp_server_endpoint_impl::connection::create(
         bool _magic_cookies_enabled,
         boost::asio::io_service & _io_service,
         std::chrono::milliseconds _send_timeout) {
-    const std::uint32_t its_initial_receveive_buffer_size =
-            VSOMEIP_SOMEIP_HEADER_SIZE + 8 + MAGIC_COOKIE_SIZE + 8;
     return ptr(new connection(_server, _max_message_size,
-                    its_initial_receveive_buffer_size,
+                    VSOMEIP_STREAM_RECEIVE_BUFFER_SIZE,
                     _buffer_shrink_threshold, _magic_cookies_enabled,
                     _io_service, _send_timeout));
 }
@@ -323,41 +324,35 @@ void tcp_server_endpoint_impl::connection::start() {
 void tcp_server_endpoint_impl::connection::receive() {
     std::lock_guard<std::mutex> its_lock(socket_mutex_);
     if(socket_.is_open()) {
-        const std::size_t its_capacity(recv_buffer_.capacity());
-        size_t buffer_size = its_capacity - recv_buffer_size_;
+        boost::asio::mutable_buffer its_buffer;
         try {
-            if (missing_capacity_) {
-                if (missing_capacity_ > MESSAGE_SIZE_UNLIMITED) {
-                    VSOMEIP_ERROR << "Missing receive buffer capacity exceeds allowed maximum!";
-                    return;
-                }
-                const std::size_t its_required_capacity(recv_buffer_size_ + missing_capacity_);
-                if (its_capacity < its_required_capacity) {
-                    recv_buffer_.reserve(its_required_capacity);
-                    recv_buffer_.resize(its_required_capacity, 0x0);
-                    if (recv_buffer_.size() > 1048576) {
-                        VSOMEIP_INFO << "tse: recv_buffer size is: " <<
-                                recv_buffer_.size()
-                                << " local: " << get_address_port_local()
-                                << " remote: " << get_address_port_remote();
-                    }
-                }
-                buffer_size = missing_capacity_;
-                missing_capacity_ = 0;
-            } else if (buffer_shrink_threshold_
-                    && shrink_count_ > buffer_shrink_threshold_
-                    && recv_buffer_size_ == 0) {
-                recv_buffer_.resize(recv_buffer_size_initial_, 0x0);
-                recv_buffer_.shrink_to_fit();
-                buffer_size = recv_buffer_size_initial_;
-                shrink_count_ = 0;
+            if (missing_capacity_ > MESSAGE_SIZE_UNLIMITED) {
+                VSOMEIP_ERROR << "Missing receive buffer capacity exceeds allowed maximum!";
+                return;
             }
+            its_buffer = recv_buffer_.prepare(missing_capacity_);
+            if (missing_capacity_ && recv_buffer_.capacity() > 1048576) {
+                VSOMEIP_INFO << "tse: recv_buffer size is: " <<
+                        recv_buffer_.capacity()
+                        << " local: " << get_address_port_local()
+                        << " remote: " << get_address_port_remote();
+            }
+            missing_capacity_ = 0;
         } catch (const std::exception &e) {
             handle_recv_buffer_exception(e);
             // don't start receiving again
             return;
         }
-        socket_.async_receive(boost::asio::buffer(&recv_buffer_[recv_buffer_size_], buffer_size),
+#ifdef VSOMEIP_ENABLE_IO_URING
+        if (io_uring_) {
+            io_uring_->async_receive(socket_.native_handle(), its_buffer,
+                    std::bind(&tcp_server_endpoint_impl::connection::receive_cbk,
+                            shared_from_this(), std::placeholders::_1,
+                            std::placeholders::_2));
+            return;
+        }
+#endif
+        socket_.async_receive(its_buffer,
                 std::bind(&tcp_server_endpoint_impl::connection::receive_cbk,
                         shared_from_this(), std::placeholders::_1,
                         std::placeholders::_2));
@@ -367,6 +362,10 @@ void tcp_server_endpoint_impl::connection::receive() {
 void tcp_server_endpoint_impl::connection::stop() {
     std::lock_guard<std::mutex> its_lock(socket_mutex_);
     if (socket_.is_open()) {
+#ifdef VSOMEIP_ENABLE_IO_URING
+        if (io_uring_)
+            io_uring_->cancel(socket_.native_handle());
+#endif
         boost::system::error_code its_error;
         socket_.shutdown(socket_.shutdown_both, its_error);
         socket_.close(its_error);
@@ -394,17 +393,12 @@ void tcp_server_endpoint_impl::connection::send_queued(
     const session_t its_session = VSOMEIP_BYTES_TO_WORD(
             (*its_buffer)[VSOMEIP_SESSION_POS_MIN],
             (*its_buffer)[VSOMEIP_SESSION_POS_MAX]);
-    if (magic_cookies_enabled_) {
-        const std::chrono::steady_clock::time_point now =
-                std::chrono::steady_clock::now();
-        if (std::chrono::duration_cast<std::chrono::milliseconds>(
-                now - last_cookie_sent_) > std::chrono::milliseconds(10000)) {
-            if (send_magic_cookie(its_buffer)) {
-                last_cookie_sent_ = now;
-                _queue_iterator->second.first += sizeof(SERVICE_COOKIE);
-            }
-        }
-    }
+
+    std::vector<boost::asio::const_buffer> its_buffers;
+    std::size_t its_size(0);
+    std::vector<message_buffer_ptr_t> its_trains;
+    collect_trains(_queue_iterator, its_server->coalescing_limit_,
+            its_buffers, its_size, its_trains);
 
     {
         std::lock_guard<std::mutex> its_lock(socket_mutex_);
@@ -413,17 +407,40 @@ void tcp_server_endpoint_impl::connection::send_queued(
             its_server->is_sending_ = true;
         }
 
-        boost::asio::async_write(socket_, boost::asio::buffer(*its_buffer),
+#ifdef VSOMEIP_ENABLE_IO_URING
+        if (io_uring_) {
+            const ptr its_connection(shared_from_this());
+            const std::chrono::steady_clock::time_point its_start(
+                    std::chrono::steady_clock::now());
+            io_uring_->async_send(socket_.native_handle(), its_buffers,
+                    [its_connection, its_server, _queue_iterator, its_trains,
+                     its_size, its_service, its_method, its_client,
+                     its_session, its_start](
+                            const boost::system::error_code &_error,
+                            std::size_t _bytes) {
+                // Reports errors and slow writes as the completion
+                // condition of async_write does
+                its_connection->write_completion_condition(_error, _bytes,
+                        its_size, its_service, its_method, its_client,
+                        its_session, its_start);
+                its_server->send_cbk(_queue_iterator, its_trains,
+                        _error, _bytes);
+            });
+            return;
+        }
+#endif
+        boost::asio::async_write(socket_, its_buffers,
                  std::bind(&tcp_server_endpoint_impl::connection::write_completion_condition,
                            shared_from_this(),
                            std::placeholders::_1,
                            std::placeholders::_2,
-                           its_buffer->size(),
+                           its_size,
                            its_service, its_method, its_client, its_session,
                            std::chrono::steady_clock::now()),
                 std::bind(&tcp_server_endpoint_base_impl::send_cbk,
                           its_server,
                           _queue_iterator,
+                          its_trains,
                           std::placeholders::_1,
                           std::placeholders::_2));
     }
@@ -431,22 +448,21 @@ void tcp_server_endpoint_impl::connection::send_queued(
 
 void tcp_server_endpoint_impl::connection::send_queued_sync(
         const queue_iterator_type _queue_iterator) {
-    message_buffer_ptr_t its_buffer = _queue_iterator->second.second.front();
-    if (magic_cookies_enabled_) {
-        const std::chrono::steady_clock::time_point now =
-                std::chrono::steady_clock::now();
-        if (std::chrono::duration_cast<std::chrono::milliseconds>(
-                now - last_cookie_sent_) > std::chrono::milliseconds(10000)) {
-            if (send_magic_cookie(its_buffer)) {
-                last_cookie_sent_ = now;
-                _queue_iterator->second.first += sizeof(SERVICE_COOKIE);
-            }
-        }
+    std::shared_ptr<tcp_server_endpoint_impl> its_server(server_.lock());
+    if (!its_server) {
+        VSOMEIP_TRACE << "tcp_server_endpoint_impl::connection::send_queued_sync "
+                " couldn't lock server_";
+        return;
     }
+    std::vector<boost::asio::const_buffer> its_buffers;
+    std::size_t its_size(0);
+    std::vector<message_buffer_ptr_t> its_trains;
+    collect_trains(_queue_iterator, its_server->coalescing_limit_,
+            its_buffers, its_size, its_trains);
 
     try {
         std::lock_guard<std::mutex> its_lock(socket_mutex_);
-        boost::asio::write(socket_, boost::asio::buffer(*its_buffer));
+        boost::asio::write(socket_, its_buffers);
     } catch (const boost::system::system_error &e) {
         if (e.code() != boost::asio::error::broken_pipe) {
             VSOMEIP_ERROR << "tcp_server_endpoint_impl::connection::"
@@ -455,26 +471,43 @@ void tcp_server_endpoint_impl::connection::send_queued_sync(
     }
 }
 
-bool tcp_server_endpoint_impl::connection::send_magic_cookie(
-        message_buffer_ptr_t &_buffer) {
-    if (max_message_size_ == MESSAGE_SIZE_UNLIMITED
-            || max_message_size_ - _buffer->size() >=
-    VSOMEIP_SOMEIP_HEADER_SIZE + VSOMEIP_SOMEIP_MAGIC_COOKIE_SIZE) {
-        _buffer->insert(_buffer->begin(), SERVICE_COOKIE,
-                SERVICE_COOKIE + sizeof(SERVICE_COOKIE));
-        return true;
+// Collects the queued trains that are written by a single (gathering)
+// write operation: as many as the coalescing limit allows, but at least
+// one, preceded by a magic cookie if one is due. The trains stay queued
+// until send_cbk removes them, _trains keeps them alive until then.
+void tcp_server_endpoint_impl::connection::collect_trains(
+        const queue_iterator_type _queue_iterator, std::uint32_t _limit,
+        std::vector<boost::asio::const_buffer> &_buffers,
+        std::size_t &_size, std::vector<message_buffer_ptr_t> &_trains) {
+    if (magic_cookies_enabled_) {
+        const std::chrono::steady_clock::time_point now =
+                std::chrono::steady_clock::now();
+        if (std::chrono::duration_cast<std::chrono::milliseconds>(
+                now - last_cookie_sent_) > std::chrono::milliseconds(10000)) {
+            _buffers.push_back(boost::asio::buffer(SERVICE_COOKIE));
+            _size += sizeof(SERVICE_COOKIE);
+            last_cookie_sent_ = now;
+        }
+    }
+
+    for (const auto &t : _queue_iterator->second.second) {
+        if (!_trains.empty() && _size + t->size() > _limit)
+            break;
+        _buffers.push_back(boost::asio::buffer(*t));
+        _size += t->size();
+        _trains.push_back(t);
     }
-    return false;
 }
 
 bool tcp_server_endpoint_impl::connection::is_magic_cookie(size_t _offset) const {
-    return (0 == std::memcmp(CLIENT_COOKIE, &recv_buffer_[_offset],
+    return (0 == std::memcmp(CLIENT_COOKIE, recv_buffer_.data() + _offset,
                              sizeof(CLIENT_COOKIE)));
 }
 
 void tcp_server_endpoint_impl::connection::receive_cbk(
         boost::system::error_code const &_error,
         std::size_t _bytes) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::ENDPOINT);
     if (_error == boost::asio::error::operation_aborted) {
         // endpoint was stopped
         return;
@@ -487,33 +520,38 @@ void tcp_server_endpoint_impl::connection::receive_cbk(
     }
 #if 0
     std::stringstream msg;
-    for (std::size_t i = 0; i < _bytes + recv_buffer_size_; ++i)
+    for (std::size_t i = 0; i < _bytes + recv_buffer_.size(); ++i)
         msg << std::hex << std::setw(2) << std::setfill('0')
-                << (int) recv_buffer_[i] << " ";
+                << (int) recv_buffer_.data()[i] << " ";
     VSOMEIP_INFO << msg.str();
 #endif
     std::shared_ptr<routing_host> its_host = its_server->routing_host_.lock();
     if (its_host) {
         if (!_error && 0 < _bytes) {
-            if (recv_buffer_size_ + _bytes < recv_buffer_size_) {
+            if (recv_buffer_.size() + _bytes < recv_buffer_.size()) {
                 VSOMEIP_ERROR << "receive buffer overflow in tcp client endpoint ~> abort!";
                 return;
             }
-            recv_buffer_size_ += _bytes;
+            recv_buffer_.commit(_bytes);
+
+            // Messages are parsed in place. The parsed part is consumed
+            // after the loop; unread data stays where it is.
+            const byte_t *its_buffer = recv_buffer_.data();
+            std::size_t its_remaining = recv_buffer_.size();
 
             size_t its_iteration_gap = 0;
             bool has_full_message;
             do {
                 uint64_t read_message_size
-                    = utility::get_message_size(&recv_buffer_[its_iteration_gap],
-                            recv_buffer_size_);
+                    = utility::get_message_size(&its_buffer[its_iteration_gap],
+                            its_remaining);
                 if (read_message_size > MESSAGE_SIZE_UNLIMITED) {
                     VSOMEIP_ERROR << "Message size exceeds allowed maximum!";
                     return;
                 }
                 uint32_t current_message_size = static_cast<uint32_t>(read_message_size);
                 has_full_message = (current_message_size > VSOMEIP_RETURN_CODE_POS
-                                   && current_message_size <= recv_buffer_size_);
+                                   && current_message_size <= its_remaining);
                 if (has_full_message) {
                     bool needs_forwarding(true);
                     if (is_magic_cookie(its_iteration_gap)) {
@@ -521,8 +559,8 @@ void tcp_server_endpoint_impl::connection::receive_cbk(
                     } else {
                         if (magic_cookies_enabled_) {
                             uint32_t its_offset
-                                = its_server->find_magic_cookie(&recv_buffer_[its_iteration_gap],
-                                        recv_buffer_size_);
+                                = its_server->find_magic_cookie(&its_buffer[its_iteration_gap],
+                                        its_remaining);
                             if (its_offset < current_message_size) {
                                 {
                                     std::lock_guard<std::mutex> its_lock(socket_mutex_);
@@ -533,8 +571,8 @@ void tcp_server_endpoint_impl::connection::receive_cbk(
                                 if (!is_magic_cookie(its_iteration_gap)) {
                                     auto its_endpoint_host = its_server->endpoint_host_.lock();
                                     if (its_endpoint_host) {
-                                        its_endpoint_host->on_error(&recv_buffer_[its_iteration_gap],
-                                                static_cast<length_t>(recv_buffer_size_),its_server.get(),
+                                        its_endpoint_host->on_error(&its_buffer[its_iteration_gap],
+                                                static_cast<length_t>(its_remaining),its_server.get(),
                                                 remote_address_, remote_port_);
                                     }
                                 }
@@ -545,22 +583,22 @@ void tcp_server_endpoint_impl::connection::receive_cbk(
                     }
                     if (needs_forwarding) {
                         if (utility::is_request(
-                                recv_buffer_[its_iteration_gap
+                                its_buffer[its_iteration_gap
                                         + VSOMEIP_MESSAGE_TYPE_POS])) {
                             const client_t its_client = VSOMEIP_BYTES_TO_WORD(
-                                    recv_buffer_[its_iteration_gap + VSOMEIP_CLIENT_POS_MIN],
-                                    recv_buffer_[its_iteration_gap + VSOMEIP_CLIENT_POS_MAX]);
+                                    its_buffer[its_iteration_gap + VSOMEIP_CLIENT_POS_MIN],
+                                    its_buffer[its_iteration_gap + VSOMEIP_CLIENT_POS_MAX]);
                             if (its_client != MAGIC_COOKIE_CLIENT) {
                                 const session_t its_session = VSOMEIP_BYTES_TO_WORD(
-                                        recv_buffer_[its_iteration_gap + VSOMEIP_SESSION_POS_MIN],
-                                        recv_buffer_[its_iteration_gap + VSOMEIP_SESSION_POS_MAX]);
+                                        its_buffer[its_iteration_gap + VSOMEIP_SESSION_POS_MIN],
+                                        its_buffer[its_iteration_gap + VSOMEIP_SESSION_POS_MAX]);
                                 its_server->clients_mutex_.lock();
                                 its_server->clients_[its_client][its_session] = remote_;
                                 its_server->clients_mutex_.unlock();
                             }
                         }
                         if (!magic_cookies_enabled_) {
-                            its_host->on_message(&recv_buffer_[its_iteration_gap],
+                            its_host->on_message(&its_buffer[its_iteration_gap],
                                     current_message_size, its_server.get(),
                                     boost::asio::ip::address(),
                                     VSOMEIP_ROUTING_CLIENT,
@@ -569,7 +607,7 @@ void tcp_server_endpoint_impl::connection::receive_cbk(
                         } else {
                             // Only call on_message without a magic cookie in front of the buffer!
                             if (!is_magic_cookie(its_iteration_gap)) {
-                                its_host->on_message(&recv_buffer_[its_iteration_gap],
+                                its_host->on_message(&its_buffer[its_iteration_gap],
                                         current_message_size, its_server.get(),
                                         boost::asio::ip::address(),
                                         VSOMEIP_ROUTING_CLIENT,
@@ -578,15 +616,14 @@ void tcp_server_endpoint_impl::connection::receive_cbk(
                             }
                         }
                     }
-                    calculate_shrink_count();
                     missing_capacity_ = 0;
-                    recv_buffer_size_ -= current_message_size;
+                    its_remaining -= current_message_size;
                     its_iteration_gap += current_message_size;
-                } else if (magic_cookies_enabled_ && recv_buffer_size_ > 0) {
+                } else if (magic_cookies_enabled_ && its_remaining > 0) {
                     uint32_t its_offset =
-                            its_server->find_magic_cookie(&recv_buffer_[its_iteration_gap],
-                                    recv_buffer_size_);
-                    if (its_offset < recv_buffer_size_) {
+                            its_server->find_magic_cookie(&its_buffer[its_iteration_gap],
+                                    its_remaining);
+                    if (its_offset < its_remaining) {
                         {
                             std::lock_guard<std::mutex> its_lock(socket_mutex_);
                             VSOMEIP_ERROR << "Detected Magic Cookie within message data. Resyncing."
@@ -596,19 +633,19 @@ void tcp_server_endpoint_impl::connection::receive_cbk(
                         if (!is_magic_cookie(its_iteration_gap)) {
                             auto its_endpoint_host = its_server->endpoint_host_.lock();
                             if (its_endpoint_host) {
-                                its_endpoint_host->on_error(&recv_buffer_[its_iteration_gap],
-                                        static_cast<length_t>(recv_buffer_size_), its_server.get(),
+                                its_endpoint_host->on_error(&its_buffer[its_iteration_gap],
+                                        static_cast<length_t>(its_remaining), its_server.get(),
                                         remote_address_, remote_port_);
                             }
                         }
-                        recv_buffer_size_ -= its_offset;
+                        its_remaining -= its_offset;
                         its_iteration_gap += its_offset;
                         has_full_message = true; // trigger next loop
                         if (!is_magic_cookie(its_iteration_gap)) {
                             auto its_endpoint_host = its_server->endpoint_host_.lock();
                             if (its_endpoint_host) {
-                                its_endpoint_host->on_error(&recv_buffer_[its_iteration_gap],
-                                        static_cast<length_t>(recv_buffer_size_), its_server.get(),
+                                its_endpoint_host->on_error(&its_buffer[its_iteration_gap],
+                                        static_cast<length_t>(its_remaining), its_server.get(),
                                         remote_address_, remote_port_);
                             }
                         }
@@ -616,43 +653,43 @@ void tcp_server_endpoint_impl::connection::receive_cbk(
                 }
 
                 if (!has_full_message) {
-                    if (recv_buffer_size_ > VSOMEIP_RETURN_CODE_POS &&
-                        (recv_buffer_[its_iteration_gap + VSOMEIP_PROTOCOL_VERSION_POS] != VSOMEIP_PROTOCOL_VERSION ||
-                         !utility::is_valid_message_type(static_cast<message_type_e>(recv_buffer_[its_iteration_gap + VSOMEIP_MESSAGE_TYPE_POS])) ||
-                         !utility::is_valid_return_code(static_cast<return_code_e>(recv_buffer_[its_iteration_gap + VSOMEIP_RETURN_CODE_POS]))
+                    if (its_remaining > VSOMEIP_RETURN_CODE_POS &&
+                        (its_buffer[its_iteration_gap + VSOMEIP_PROTOCOL_VERSION_POS] != VSOMEIP_PROTOCOL_VERSION ||
+                         !utility::is_valid_message_type(static_cast<message_type_e>(its_buffer[its_iteration_gap + VSOMEIP_MESSAGE_TYPE_POS])) ||
+                         !utility::is_valid_return_code(static_cast<return_code_e>(its_buffer[its_iteration_gap + VSOMEIP_RETURN_CODE_POS]))
                         )) {
-                        if (recv_buffer_[its_iteration_gap + VSOMEIP_PROTOCOL_VERSION_POS] != VSOMEIP_PROTOCOL_VERSION) {
+                        if (its_buffer[its_iteration_gap + VSOMEIP_PROTOCOL_VERSION_POS] != VSOMEIP_PROTOCOL_VERSION) {
                             {
                                 std::lock_guard<std::mutex> its_lock(socket_mutex_);
                                 VSOMEIP_ERROR << "tse: Wrong protocol version: 0x"
                                         << std::hex << std::setw(2) << std::setfill('0')
-                                        << std::uint32_t(recv_buffer_[its_iteration_gap + VSOMEIP_PROTOCOL_VERSION_POS])
+                                        << std::uint32_t(its_buffer[its_iteration_gap + VSOMEIP_PROTOCOL_VERSION_POS])
                                         << " local: " << get_address_port_local()
                                         << " remote: " << get_address_port_remote()
                                         << ". Closing connection due to missing/broken data TCP stream.";
                             }
                             // ensure to send back a error message w/ wrong protocol version
-                            its_host->on_message(&recv_buffer_[its_iteration_gap],
+                            its_host->on_message(&its_buffer[its_iteration_gap],
                                     VSOMEIP_SOMEIP_HEADER_SIZE + 8, its_server.get(),
                                     boost::asio::ip::address(),
                                     VSOMEIP_ROUTING_CLIENT,
                                     std::make_pair(ANY_UID, ANY_GID),
                                     remote_address_, remote_port_);
                         } else if (!utility::is_valid_message_type(static_cast<message_type_e>(
-                                recv_buffer_[its_iteration_gap + VSOMEIP_MESSAGE_TYPE_POS]))) {
+                                its_buffer[its_iteration_gap + VSOMEIP_MESSAGE_TYPE_POS]))) {
                             std::lock_guard<std::mutex> its_lock(socket_mutex_);
                             VSOMEIP_ERROR << "tse: Invalid message type: 0x"
                                     << std::hex << std::setw(2) << std::setfill('0')
-                                    << std::uint32_t(recv_buffer_[its_iteration_gap + VSOMEIP_MESSAGE_TYPE_POS])
+                                    << std::uint32_t(its_buffer[its_iteration_gap + VSOMEIP_MESSAGE_TYPE_POS])
                                     << " local: " << get_address_port_local()
                                     << " remote: " << get_address_port_remote()
                                     << ". Closing connection due to missing/broken data TCP stream.";
                         } else if (!utility::is_valid_return_code(static_cast<return_code_e>(
-                                recv_buffer_[its_iteration_gap + VSOMEIP_RETURN_CODE_POS]))) {
+                                its_buffer[its_iteration_gap + VSOMEIP_RETURN_CODE_POS]))) {
                             std::lock_guard<std::mutex> its_lock(socket_mutex_);
                             VSOMEIP_ERROR << "tse: Invalid return code: 0x"
                                     << std::hex << std::setw(2) << std::setfill('0')
-                                    << std::uint32_t(recv_buffer_[its_iteration_gap + VSOMEIP_RETURN_CODE_POS])
+                                    << std::uint32_t(its_buffer[its_iteration_gap + VSOMEIP_RETURN_CODE_POS])
                                     << " local: " << get_address_port_local()
                                     << " remote: " << get_address_port_remote()
                                     << ". Closing connection due to missing/broken data TCP stream.";
@@ -661,9 +698,8 @@ void tcp_server_endpoint_impl::connection::receive_cbk(
                         return;
                     } else if (max_message_size_ != MESSAGE_SIZE_UNLIMITED
                             && current_message_size > max_message_size_) {
-                        recv_buffer_size_ = 0;
-                        recv_buffer_.resize(recv_buffer_size_initial_, 0x0);
-                        recv_buffer_.shrink_to_fit();
+                        its_remaining = 0;
+                        recv_buffer_.clear();
                         if (magic_cookies_enabled_) {
                             std::lock_guard<std::mutex> its_lock(socket_mutex_);
                             VSOMEIP_ERROR << "Received a TCP message which exceeds "
@@ -689,18 +725,17 @@ void tcp_server_endpoint_impl::connection::receive_cbk(
                             wait_until_sent(boost::asio::error::operation_aborted);
                             return;
                         }
-                    } else if (current_message_size > recv_buffer_size_) {
+                    } else if (current_message_size > its_remaining) {
                         missing_capacity_ = current_message_size
-                                - static_cast<std::uint32_t>(recv_buffer_size_);
-                    } else if (VSOMEIP_SOMEIP_HEADER_SIZE > recv_buffer_size_) {
+                                - static_cast<std::uint32_t>(its_remaining);
+                    } else if (VSOMEIP_SOMEIP_HEADER_SIZE > its_remaining) {
                         missing_capacity_ = VSOMEIP_SOMEIP_HEADER_SIZE
-                                - static_cast<std::uint32_t>(recv_buffer_size_);
-                    } else if (magic_cookies_enabled_ && recv_buffer_size_ > 0) {
+                                - static_cast<std::uint32_t>(its_remaining);
+                    } else if (magic_cookies_enabled_ && its_remaining > 0) {
                         // no need to check for magic cookie here again: has_full_message
                         // would have been set to true if there was one present in the data
-                        recv_buffer_size_ = 0;
-                        recv_buffer_.resize(recv_buffer_size_initial_, 0x0);
-                        recv_buffer_.shrink_to_fit();
+                        its_remaining = 0;
+                        recv_buffer_.clear();
                         missing_capacity_ = 0;
                         std::lock_guard<std::mutex> its_lock(socket_mutex_);
                         VSOMEIP_ERROR << "Didn't find magic cookie in broken"
@@ -712,7 +747,7 @@ void tcp_server_endpoint_impl::connection::receive_cbk(
                             std::lock_guard<std::mutex> its_lock(socket_mutex_);
                             VSOMEIP_ERROR << "tse::c<" << this
                                     << ">rcb: recv_buffer_size is: " << std::dec
-                                    << recv_buffer_size_ << " but couldn't read "
+                                    << its_remaining << " but couldn't read "
                                     "out message_size. recv_buffer_capacity: "
                                     << recv_buffer_.capacity()
                                     << " its_iteration_gap: " << its_iteration_gap
@@ -724,18 +759,8 @@ void tcp_server_endpoint_impl::connection::receive_cbk(
                         return;
                     }
                 }
-            } while (has_full_message && recv_buffer_size_);
-            if (its_iteration_gap) {
-                // Copy incomplete message to front for next receive_cbk iteration
-                for (size_t i = 0; i < recv_buffer_size_; ++i) {
-                    recv_buffer_[i] = recv_buffer_[i + its_iteration_gap];
-                }
-                // Still more capacity needed after shifting everything to front?
-                if (missing_capacity_ &&
-                        missing_capacity_ <= recv_buffer_.capacity() - recv_buffer_size_) {
-                    missing_capacity_ = 0;
-                }
-            }
+            } while (has_full_message && its_remaining);
+            recv_buffer_.consume(recv_buffer_.size() - its_remaining);
             receive();
         }
     }
@@ -752,18 +777,6 @@ void tcp_server_endpoint_impl::connection::receive_cbk(
     }
 }
 
-void tcp_server_endpoint_impl::connection::calculate_shrink_count() {
-    if (buffer_shrink_threshold_) {
-        if (recv_buffer_.capacity() != recv_buffer_size_initial_) {
-            if (recv_buffer_size_ < (recv_buffer_.capacity() >> 1)) {
-                shrink_count_++;
-            } else {
-                shrink_count_ = 0;
-            }
-        }
-    }
-}
-
 void tcp_server_endpoint_impl::connection::set_remote_info(
         const endpoint_type &_remote) {
     remote_ = _remote;
@@ -804,19 +817,25 @@ void tcp_server_endpoint_impl::connection::handle_recv_buffer_exception(
             << " remote: " << get_address_port_remote()
             << " shutting down connection. Start of buffer: ";
 
-    for (std::size_t i = 0; i < recv_buffer_size_ && i < 16; i++) {
+    const byte_t *its_buffer = recv_buffer_.data();
+    const std::size_t its_size = recv_buffer_.size();
+    for (std::size_t i = 0; i < its_size && i < 16; i++) {
         its_message << std::setw(2) << std::setfill('0') << std::hex
-            << (int) (recv_buffer_[i]) << " ";
+            << (int) (its_buffer[i]) << " ";
     }
 
     its_message << " Last 16 Bytes captured: ";
-    for (int i = 15; recv_buffer_size_ > 15 && i >= 0; i--) {
+    for (std::size_t i = (its_size > 16 ? its_size - 16 : its_size); i < its_size; i++) {
         its_message << std::setw(2) << std::setfill('0') << std::hex
-            <<  (int) (recv_buffer_[static_cast<size_t>(i)]) << " ";
+            <<  (int) (its_buffer[i]) << " ";
     }
     VSOMEIP_ERROR << its_message.str();
     recv_buffer_.clear();
     if (socket_.is_open()) {
+#ifdef VSOMEIP_ENABLE_IO_URING
+        if (io_uring_)
+            io_uring_->cancel(socket_.native_handle());
+#endif
         boost::system::error_code its_error;
         socket_.shutdown(socket_.shutdown_both, its_error);
         socket_.close(its_error);
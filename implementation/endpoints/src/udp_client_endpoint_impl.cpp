@@ -13,6 +13,7 @@
 #include "../include/tp.hpp"
 #include "../../routing/include/routing_host.hpp"
 #include "../include/udp_client_endpoint_impl.hpp"
+#include "../../utility/include/allocation_statistics.hpp"
 #include "../../utility/include/utility.hpp"
 
 namespace vsomeip_v3 {
@@ -176,6 +177,22 @@ void udp_client_endpoint_impl::send_queued() {
 #endif
     {
         std::lock_guard<std::mutex> its_lock(socket_mutex_);
+#ifdef VSOMEIP_ENABLE_IO_URING
+        if (io_uring_) {
+            io_uring_->async_send(socket_->native_handle(),
+                std::vector<boost::asio::const_buffer>(1,
+                        boost::asio::buffer(*its_buffer)),
+                std::bind(
+                    &udp_client_endpoint_base_impl::send_cbk,
+                    shared_from_this(),
+                    std::placeholders::_1,
+                    std::placeholders::_2,
+                    its_buffer
+                )
+            );
+            return;
+        }
+#endif
         socket_->async_send(
             boost::asio::buffer(*its_buffer),
             std::bind(
@@ -204,6 +221,26 @@ void udp_client_endpoint_impl::receive() {
         return;
     }
     message_buffer_ptr_t its_buffer = std::make_shared<message_buffer_t>(VSOMEIP_MAX_UDP_MESSAGE_SIZE);
+#ifdef VSOMEIP_ENABLE_IO_URING
+    if (io_uring_) {
+        // The socket is connected, thus the sender always is remote_
+        io_uring_->async_receive(socket_->native_handle(),
+            boost::asio::buffer(*its_buffer),
+            strand_.wrap(
+                std::bind(
+                    &udp_client_endpoint_impl::receive_cbk,
+                    std::dynamic_pointer_cast<
+                        udp_client_endpoint_impl
+                    >(shared_from_this()),
+                    std::placeholders::_1,
+                    std::placeholders::_2,
+                    its_buffer
+                )
+            )
+        );
+        return;
+    }
+#endif
     socket_->async_receive_from(
         boost::asio::buffer(*its_buffer),
         const_cast<endpoint_type&>(remote_),
@@ -251,6 +288,7 @@ std::uint16_t udp_client_endpoint_impl::get_remote_port() const {
 void udp_client_endpoint_impl::receive_cbk(
         boost::system::error_code const &_error, std::size_t _bytes,
         const message_buffer_ptr_t& _recv_buffer) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::ENDPOINT);
     if (_error == boost::asio::error::operation_aborted) {
         // endpoint was stopped
         return;
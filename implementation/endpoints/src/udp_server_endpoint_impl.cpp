@@ -17,6 +17,7 @@
 #include "../../routing/include/routing_host.hpp"
 #include "../include/udp_server_endpoint_impl.hpp"
 #include "../../configuration/include/configuration.hpp"
+#include "../../utility/include/allocation_statistics.hpp"
 #include "../../utility/include/byteorder.hpp"
 #include "../../utility/include/utility.hpp"
 #include "../../service_discovery/include/defines.hpp"
@@ -41,7 +42,12 @@ udp_server_endpoint_impl::udp_server_endpoint_impl(
       joined_group_(false),
       local_port_(_local.port()),
       tp_reassembler_(std::make_shared<tp::tp_reassembler>(_configuration->get_max_message_size_unreliable(), _io)),
-      tp_cleanup_timer_(_io) {
+      tp_cleanup_timer_(_io)
+#ifdef VSOMEIP_ENABLE_IO_URING
+      , io_uring_(boost::asio::has_service<io_uring_service>(_io) ?
+              &boost::asio::use_service<io_uring_service>(_io) : nullptr)
+#endif
+      {
     is_supporting_someip_tp_ = true;
 
     boost::system::error_code ec;
@@ -130,6 +136,10 @@ void udp_server_endpoint_impl::stop() {
         std::lock_guard<std::mutex> its_lock(unicast_mutex_);
 
         if (unicast_socket_.is_open()) {
+#ifdef VSOMEIP_ENABLE_IO_URING
+            if (io_uring_)
+                io_uring_->cancel(unicast_socket_.native_handle());
+#endif
             boost::system::error_code its_error;
             unicast_socket_.shutdown(socket_type::shutdown_both, its_error);
             unicast_socket_.close(its_error);
@@ -140,6 +150,10 @@ void udp_server_endpoint_impl::stop() {
         std::lock_guard<std::mutex> its_lock(multicast_mutex_);
 
         if (multicast_socket_ && multicast_socket_->is_open()) {
+#ifdef VSOMEIP_ENABLE_IO_URING
+            if (io_uring_)
+                io_uring_->cancel(multicast_socket_->native_handle());
+#endif
             boost::system::error_code its_error;
             multicast_socket_->shutdown(socket_type::shutdown_both, its_error);
             multicast_socket_->close(its_error);
@@ -158,6 +172,24 @@ void udp_server_endpoint_impl::receive_unicast() {
     std::lock_guard<std::mutex> its_lock(unicast_mutex_);
 
     if(unicast_socket_.is_open()) {
+#ifdef VSOMEIP_ENABLE_IO_URING
+        if (io_uring_) {
+            io_uring_->async_receive_from(unicast_socket_.native_handle(),
+                boost::asio::buffer(&unicast_recv_buffer_[0], max_message_size_),
+                std::bind(
+                    &udp_server_endpoint_impl::on_unicast_received_from,
+                    std::dynamic_pointer_cast<
+                        udp_server_endpoint_impl >(shared_from_this()),
+                    std::placeholders::_1,
+                    std::placeholders::_2,
+                    std::placeholders::_3,
+                    std::placeholders::_4,
+                    std::placeholders::_5
+                )
+            );
+            return;
+        }
+#endif
         unicast_socket_.async_receive_from(
                 boost::asio::buffer(&unicast_recv_buffer_[0], max_message_size_),
             unicast_remote_,
@@ -179,6 +211,25 @@ void udp_server_endpoint_impl::receive_unicast() {
 void udp_server_endpoint_impl::receive_multicast(uint8_t _multicast_id) {
 
     if (_multicast_id == multicast_id_ && multicast_socket_ && multicast_socket_->is_open()) {
+#ifdef VSOMEIP_ENABLE_IO_URING
+        if (io_uring_) {
+            io_uring_->async_receive_from(multicast_socket_->native_handle(),
+                boost::asio::buffer(&multicast_recv_buffer_[0], max_message_size_),
+                std::bind(
+                    &udp_server_endpoint_impl::on_multicast_received_from,
+                    std::dynamic_pointer_cast<
+                        udp_server_endpoint_impl >(shared_from_this()),
+                    std::placeholders::_1,
+                    std::placeholders::_2,
+                    std::placeholders::_3,
+                    std::placeholders::_4,
+                    std::placeholders::_5,
+                    _multicast_id
+                )
+            );
+            return;
+        }
+#endif
         multicast_socket_->async_receive_from(
                 boost::asio::buffer(&multicast_recv_buffer_[0], max_message_size_),
             multicast_remote_,
@@ -198,6 +249,7 @@ void udp_server_endpoint_impl::receive_multicast(uint8_t _multicast_id) {
 bool udp_server_endpoint_impl::send_to(
     const std::shared_ptr<endpoint_definition> _target,
     const byte_t *_data, uint32_t _size) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::ENDPOINT);
 
     std::lock_guard<std::mutex> its_lock(mutex_);
     endpoint_type its_target(_target->get_address(), _target->get_port());
@@ -244,6 +296,25 @@ void udp_server_endpoint_impl::send_queued(
 #endif
     std::lock_guard<std::mutex> its_lock(unicast_mutex_);
 
+#ifdef VSOMEIP_ENABLE_IO_URING
+    if (io_uring_) {
+        io_uring_->async_send_to(unicast_socket_.native_handle(),
+            std::vector<boost::asio::const_buffer>(1,
+                    boost::asio::buffer(*its_buffer)),
+            _queue_iterator->first.address(),
+            _queue_iterator->first.port(),
+            std::bind(
+                &udp_server_endpoint_base_impl::send_cbk,
+                shared_from_this(),
+                _queue_iterator,
+                std::vector<message_buffer_ptr_t>(1, its_buffer),
+                std::placeholders::_1,
+                std::placeholders::_2
+            )
+        );
+        return;
+    }
+#endif
     unicast_socket_.async_send_to(
         boost::asio::buffer(*its_buffer),
         _queue_iterator->first,
@@ -251,6 +322,7 @@ void udp_server_endpoint_impl::send_queued(
             &udp_server_endpoint_base_impl::send_cbk,
             shared_from_this(),
             _queue_iterator,
+            std::vector<message_buffer_ptr_t>(1, its_buffer),
             std::placeholders::_1,
             std::placeholders::_2
         )
@@ -457,6 +529,10 @@ void udp_server_endpoint_impl::leave_unlocked(const std::string &_address) {
 
                 boost::system::error_code ec;
                 multicast_socket_->cancel(ec);
+#ifdef VSOMEIP_ENABLE_IO_URING
+                if (io_uring_)
+                    io_uring_->cancel(multicast_socket_->native_handle());
+#endif
 
                 multicast_socket_.reset(nullptr);
                 multicast_local_.reset(nullptr);
@@ -533,11 +609,37 @@ void udp_server_endpoint_impl::on_multicast_received(
     }
 }
 
+#ifdef VSOMEIP_ENABLE_IO_URING
+void udp_server_endpoint_impl::on_unicast_received_from(
+        boost::system::error_code const &_error,
+        std::size_t _bytes,
+        boost::asio::ip::address const &_remote_address,
+        std::uint16_t _remote_port,
+        boost::asio::ip::address const &_destination) {
+    if (!_error)
+        unicast_remote_ = endpoint_type(_remote_address, _remote_port);
+    on_unicast_received(_error, _bytes, _destination);
+}
+
+void udp_server_endpoint_impl::on_multicast_received_from(
+        boost::system::error_code const &_error,
+        std::size_t _bytes,
+        boost::asio::ip::address const &_remote_address,
+        std::uint16_t _remote_port,
+        boost::asio::ip::address const &_destination,
+        uint8_t _multicast_id) {
+    if (!_error)
+        multicast_remote_ = endpoint_type(_remote_address, _remote_port);
+    on_multicast_received(_error, _bytes, _destination, _multicast_id);
+}
+#endif
+
 void udp_server_endpoint_impl::on_message_received(
         boost::system::error_code const &_error, std::size_t _bytes,
         boost::asio::ip::address const &_destination,
         endpoint_type const &_remote,
         message_buffer_t const &_buffer) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::ENDPOINT);
 #if 0
     std::stringstream msg;
     msg << "usei::rcb(" << _error.message() << "): ";
@@ -23,6 +23,9 @@ public:
     VSOMEIP_EXPORT bool serialize(serializer *_to) const;
     VSOMEIP_EXPORT bool deserialize(deserializer *_from);
 
+    // Writes the complete header (VSOMEIP_FULL_HEADER_SIZE bytes) to _data
+    VSOMEIP_EXPORT void write(byte_t *_data) const;
+
     // internal
     VSOMEIP_EXPORT message_base * get_owner() const;
     VSOMEIP_EXPORT void set_owner(message_base *_owner);
@@ -0,0 +1,100 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_MESSAGE_HEADER_VIEW_HPP_
+#define VSOMEIP_V3_MESSAGE_HEADER_VIEW_HPP_
+
+#include <vsomeip/defines.hpp>
+#include <vsomeip/enumeration_types.hpp>
+#include <vsomeip/primitive_types.hpp>
+
+#include "../../utility/include/byteorder.hpp"
+
+namespace vsomeip_v3 {
+
+// Read-only access to the header fields of a serialized SOME/IP message.
+// The view does neither copy nor own the data, which must stay valid while
+// the view is used. Fields must only be read if is_valid() returns true.
+class message_header_view {
+public:
+    message_header_view(const byte_t *_data, length_t _size)
+        : data_(_data), size_(_size) {
+    }
+
+    // The complete header is available and the length field does not
+    // exceed the available data.
+    bool is_valid() const {
+        return (size_ >= VSOMEIP_FULL_HEADER_SIZE
+                && get_length() >= VSOMEIP_FULL_HEADER_SIZE - VSOMEIP_SOMEIP_HEADER_SIZE
+                && get_length() <= size_ - VSOMEIP_SOMEIP_HEADER_SIZE);
+    }
+
+    service_t get_service() const {
+        return VSOMEIP_BYTES_TO_WORD(data_[VSOMEIP_SERVICE_POS_MIN],
+                data_[VSOMEIP_SERVICE_POS_MAX]);
+    }
+
+    method_t get_method() const {
+        return VSOMEIP_BYTES_TO_WORD(data_[VSOMEIP_METHOD_POS_MIN],
+                data_[VSOMEIP_METHOD_POS_MAX]);
+    }
+
+    length_t get_length() const {
+        return VSOMEIP_BYTES_TO_LONG(data_[VSOMEIP_LENGTH_POS_MIN],
+                data_[VSOMEIP_LENGTH_POS_MIN + 1],
+                data_[VSOMEIP_LENGTH_POS_MIN + 2],
+                data_[VSOMEIP_LENGTH_POS_MAX]);
+    }
+
+    client_t get_client() const {
+        return VSOMEIP_BYTES_TO_WORD(data_[VSOMEIP_CLIENT_POS_MIN],
+                data_[VSOMEIP_CLIENT_POS_MAX]);
+    }
+
+    session_t get_session() const {
+        return VSOMEIP_BYTES_TO_WORD(data_[VSOMEIP_SESSION_POS_MIN],
+                data_[VSOMEIP_SESSION_POS_MAX]);
+    }
+
+    protocol_version_t get_protocol_version() const {
+        return data_[VSOMEIP_PROTOCOL_VERSION_POS];
+    }
+
+    interface_version_t get_interface_version() const {
+        return data_[VSOMEIP_INTERFACE_VERSION_POS];
+    }
+
+    message_type_e get_message_type() const {
+        return static_cast<message_type_e>(data_[VSOMEIP_MESSAGE_TYPE_POS]);
+    }
+
+    return_code_e get_return_code() const {
+        return static_cast<return_code_e>(data_[VSOMEIP_RETURN_CODE_POS]);
+    }
+
+    const byte_t *get_payload() const {
+        return &data_[VSOMEIP_PAYLOAD_POS];
+    }
+
+    length_t get_payload_length() const {
+        return get_length() - (VSOMEIP_FULL_HEADER_SIZE - VSOMEIP_SOMEIP_HEADER_SIZE);
+    }
+
+    const byte_t *get_data() const {
+        return data_;
+    }
+
+    length_t get_size() const {
+        return size_;
+    }
+
+private:
+    const byte_t *data_;
+    length_t size_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_MESSAGE_HEADER_VIEW_HPP_
@@ -7,6 +7,8 @@
 #define VSOMEIP_V3_MESSAGE_IMPL_HPP
 
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include <vsomeip/export.hpp>
 #include <vsomeip/primitive_types.hpp>
@@ -24,6 +26,7 @@
 
 namespace vsomeip_v3 {
 
+class message_header_view;
 class payload;
 
 class message_impl
@@ -41,6 +44,10 @@ public:
 
     VSOMEIP_EXPORT bool serialize(serializer *_to) const;
     VSOMEIP_EXPORT bool deserialize(deserializer *_from);
+    // Takes the header fields from the view and keeps a copy of the
+    // payload bytes. The payload object is created on first access.
+    VSOMEIP_EXPORT bool deserialize(const message_header_view &_header);
+    VSOMEIP_EXPORT void write_header(byte_t *_data) const;
 
     VSOMEIP_EXPORT uint8_t get_check_result() const;
     VSOMEIP_EXPORT void set_check_result(uint8_t _check_result);
@@ -53,7 +60,12 @@ public:
     VSOMEIP_EXPORT void set_gid(gid_t _gid);
 
 protected: // members
-    std::shared_ptr< payload > payload_;
+    // The payload is created on demand by get_payload(). Until then,
+    // received payload data is kept in raw_payload_.
+    mutable std::mutex payload_mutex_;
+    mutable std::shared_ptr< payload > payload_;
+    mutable std::vector< byte_t > raw_payload_;
+    mutable bool is_payload_pending_;
     uint8_t check_result_;
     uid_t uid_;
     gid_t gid_;
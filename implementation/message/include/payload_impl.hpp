@@ -6,6 +6,8 @@
 #ifndef VSOMEIP_V3_PAYLOAD_IMPL_HPP
 #define VSOMEIP_V3_PAYLOAD_IMPL_HPP
 
+#include <memory>
+
 #include <vsomeip/export.hpp>
 #include <vsomeip/payload.hpp>
 
@@ -19,6 +21,7 @@ public:
     VSOMEIP_EXPORT payload_impl();
     VSOMEIP_EXPORT payload_impl(const byte_t *_data, uint32_t _size);
     VSOMEIP_EXPORT payload_impl(const std::vector< byte_t > &_data);
+    VSOMEIP_EXPORT payload_impl(const std::shared_ptr<byte_t> &_data, uint32_t _size);
     VSOMEIP_EXPORT payload_impl(const payload_impl& _payload);
     VSOMEIP_EXPORT virtual ~payload_impl();
 
@@ -37,8 +40,16 @@ public:
     VSOMEIP_EXPORT bool serialize(serializer *_to) const;
     VSOMEIP_EXPORT bool deserialize(deserializer *_from);
 
+    VSOMEIP_EXPORT bool is_shared() const;
+
 private:
+    void unshare();
+
     std::vector<byte_t> data_;
+
+    // Buffer referred to instead of data_ (see runtime::create_shared_payload)
+    std::shared_ptr<byte_t> shared_data_;
+    length_t shared_length_;
 };
 
 } // namespace vsomeip_v3
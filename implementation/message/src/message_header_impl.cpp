@@ -9,6 +9,7 @@
 #include "../include/message_header_impl.hpp"
 #include "../include/serializer.hpp"
 #include "../include/deserializer.hpp"
+#include "../../utility/include/byteorder.hpp"
 
 namespace vsomeip_v3 {
 
@@ -33,16 +34,32 @@ message_header_impl::message_header_impl(const message_header_impl &_header)
 }
 
 bool message_header_impl::serialize(serializer *_to) const {
-    return (0 != _to
-            && _to->serialize(service_)
-            && _to->serialize(method_)
-            && _to->serialize(owner_->get_length())
-            && _to->serialize(client_)
-            && _to->serialize(session_)
-            && _to->serialize(protocol_version_)
-            && _to->serialize(interface_version_)
-            && _to->serialize(static_cast<uint8_t>(type_))
-            && _to->serialize(static_cast<uint8_t>(code_)));
+    if (0 == _to) {
+        return false;
+    }
+    byte_t its_header[VSOMEIP_FULL_HEADER_SIZE];
+    write(its_header);
+    return _to->serialize(its_header, VSOMEIP_FULL_HEADER_SIZE);
+}
+
+void message_header_impl::write(byte_t *_data) const {
+    const length_t its_length(owner_->get_length());
+    _data[VSOMEIP_SERVICE_POS_MIN] = VSOMEIP_WORD_BYTE1(service_);
+    _data[VSOMEIP_SERVICE_POS_MAX] = VSOMEIP_WORD_BYTE0(service_);
+    _data[VSOMEIP_METHOD_POS_MIN] = VSOMEIP_WORD_BYTE1(method_);
+    _data[VSOMEIP_METHOD_POS_MAX] = VSOMEIP_WORD_BYTE0(method_);
+    _data[VSOMEIP_LENGTH_POS_MIN] = VSOMEIP_LONG_BYTE3(its_length);
+    _data[VSOMEIP_LENGTH_POS_MIN + 1] = VSOMEIP_LONG_BYTE2(its_length);
+    _data[VSOMEIP_LENGTH_POS_MIN + 2] = VSOMEIP_LONG_BYTE1(its_length);
+    _data[VSOMEIP_LENGTH_POS_MAX] = VSOMEIP_LONG_BYTE0(its_length);
+    _data[VSOMEIP_CLIENT_POS_MIN] = VSOMEIP_WORD_BYTE1(client_);
+    _data[VSOMEIP_CLIENT_POS_MAX] = VSOMEIP_WORD_BYTE0(client_);
+    _data[VSOMEIP_SESSION_POS_MIN] = VSOMEIP_WORD_BYTE1(session_);
+    _data[VSOMEIP_SESSION_POS_MAX] = VSOMEIP_WORD_BYTE0(session_);
+    _data[VSOMEIP_PROTOCOL_VERSION_POS] = protocol_version_;
+    _data[VSOMEIP_INTERFACE_VERSION_POS] = interface_version_;
+    _data[VSOMEIP_MESSAGE_TYPE_POS] = static_cast<byte_t>(type_);
+    _data[VSOMEIP_RETURN_CODE_POS] = static_cast<byte_t>(code_);
 }
 
 bool message_header_impl::deserialize(deserializer *_from) {
@@ -7,6 +7,7 @@
 #include <vsomeip/payload.hpp>
 #include <vsomeip/runtime.hpp>
 
+#include "../include/message_header_view.hpp"
 #include "../include/message_impl.hpp"
 #ifdef ANDROID
 #include "../../configuration/include/internal_android.hpp"
@@ -18,7 +19,7 @@
 namespace vsomeip_v3 {
 
 message_impl::message_impl()
-    : payload_(runtime::get()->create_payload()),
+    : is_payload_pending_(true),
       check_result_(0), uid_(ANY_UID), gid_(ANY_GID) {
 }
 
@@ -26,33 +27,78 @@ message_impl::~message_impl() {
 }
 
 length_t message_impl::get_length() const {
+    std::lock_guard<std::mutex> its_lock(payload_mutex_);
+    if (is_payload_pending_) {
+        return (VSOMEIP_SOMEIP_HEADER_SIZE
+                + static_cast<length_t>(raw_payload_.size()));
+    }
     return (VSOMEIP_SOMEIP_HEADER_SIZE
             + (payload_ ? payload_->get_length() : 0));
 }
 
 std::shared_ptr< payload > message_impl::get_payload() const {
+    std::lock_guard<std::mutex> its_lock(payload_mutex_);
+    if (is_payload_pending_) {
+        payload_ = runtime::get()->create_payload();
+        if (!raw_payload_.empty()) {
+            payload_->set_data(std::move(raw_payload_));
+            raw_payload_.clear();
+        }
+        is_payload_pending_ = false;
+    }
     return payload_;
 }
 
 void message_impl::set_payload(std::shared_ptr< payload > _payload) {
+    std::lock_guard<std::mutex> its_lock(payload_mutex_);
     payload_ = _payload;
+    raw_payload_.clear();
+    is_payload_pending_ = false;
 }
 
 bool message_impl::serialize(serializer *_to) const {
+    const std::shared_ptr<payload> its_payload(get_payload());
     return (header_.serialize(_to)
-            && (payload_ ? payload_->serialize(_to) : true));
+            && (its_payload ? its_payload->serialize(_to) : true));
+}
+
+void message_impl::write_header(byte_t *_data) const {
+    header_.write(_data);
 }
 
 bool message_impl::deserialize(deserializer *_from) {
-    payload_ = runtime::get()->create_payload();
+    std::shared_ptr<payload> its_payload = runtime::get()->create_payload();
     bool is_successful = header_.deserialize(_from);
     if (is_successful) {
-        payload_->set_capacity(header_.length_ - VSOMEIP_SOMEIP_HEADER_SIZE);
-        is_successful = payload_->deserialize(_from);
+        its_payload->set_capacity(header_.length_ - VSOMEIP_SOMEIP_HEADER_SIZE);
+        is_successful = its_payload->deserialize(_from);
     }
+    set_payload(its_payload);
     return is_successful;
 }
 
+bool message_impl::deserialize(const message_header_view &_header) {
+    if (!_header.is_valid())
+        return false;
+
+    header_.service_ = _header.get_service();
+    header_.method_ = _header.get_method();
+    header_.length_ = _header.get_length();
+    header_.client_ = _header.get_client();
+    header_.session_ = _header.get_session();
+    header_.protocol_version_ = _header.get_protocol_version();
+    header_.interface_version_ = _header.get_interface_version();
+    header_.type_ = _header.get_message_type();
+    header_.code_ = _header.get_return_code();
+
+    std::lock_guard<std::mutex> its_lock(payload_mutex_);
+    payload_.reset();
+    raw_payload_.assign(_header.get_payload(),
+            _header.get_payload() + _header.get_payload_length());
+    is_payload_pending_ = true;
+    return true;
+}
+
 uint8_t message_impl::get_check_result() const {
     return check_result_;
 }
@@ -3,6 +3,8 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
+
 #include "../include/deserializer.hpp"
 #include "../include/payload_impl.hpp"
 #include "../include/serializer.hpp"
@@ -10,19 +12,26 @@
 namespace vsomeip_v3 {
 
 payload_impl::payload_impl()
-    : data_() {
+    : data_(), shared_length_(0) {
 }
 
-payload_impl::payload_impl(const byte_t *_data, uint32_t _size) {
+payload_impl::payload_impl(const byte_t *_data, uint32_t _size)
+    : shared_length_(0) {
     data_.assign(_data, _data + _size);
 }
 
 payload_impl::payload_impl(const std::vector<byte_t> &_data)
-    : data_(_data) {
+    : data_(_data), shared_length_(0) {
+}
+
+payload_impl::payload_impl(const std::shared_ptr<byte_t> &_data, uint32_t _size)
+    : data_(), shared_data_(_data), shared_length_(_data ? _size : 0) {
 }
 
 payload_impl::payload_impl(const payload_impl& _payload)
-    : data_(_payload.data_) {
+    : data_(_payload.data_),
+      shared_data_(_payload.shared_data_),
+      shared_length_(_payload.shared_length_) {
 }
 
 payload_impl::~payload_impl() {
@@ -31,8 +40,12 @@ payload_impl::~payload_impl() {
 bool payload_impl::operator==(const payload &_other) {
     bool is_equal(true);
     try {
+        const payload_impl &its_this = *this;
         const payload_impl &other = dynamic_cast< const payload_impl & >(_other);
-        is_equal = (data_ == other.data_);
+        is_equal = (its_this.get_length() == other.get_length()
+                && std::equal(its_this.get_data(),
+                        its_this.get_data() + its_this.get_length(),
+                        other.get_data()));
     }
     catch (...) {
         is_equal = false;
@@ -41,39 +54,65 @@ bool payload_impl::operator==(const payload &_other) {
 }
 
 byte_t * payload_impl::get_data() {
+    // Shared buffers must not be modified, writing requires an own copy
+    unshare();
     return data_.data();
 }
 
 const byte_t * payload_impl::get_data() const {
-    return data_.data();
+    return (shared_data_ ? shared_data_.get() : data_.data());
 }
 
 length_t payload_impl::get_length() const {
-    return length_t(data_.size());
+    return (shared_data_ ? shared_length_ : length_t(data_.size()));
 }
 
 void payload_impl::set_capacity(length_t _capacity) {
+    unshare();
     data_.reserve(_capacity);
 }
 
 void payload_impl::set_data(const byte_t *_data, const length_t _length) {
+    shared_data_.reset();
+    shared_length_ = 0;
     data_.assign(_data, _data + _length);
 }
 
 void payload_impl::set_data(const std::vector< byte_t > &_data) {
+    shared_data_.reset();
+    shared_length_ = 0;
     data_ = _data;
 }
 
 void payload_impl::set_data(std::vector< byte_t > &&_data) {
+    shared_data_.reset();
+    shared_length_ = 0;
     data_ = std::move(_data);
 }
 
 bool payload_impl::serialize(serializer *_to) const {
+    if (shared_data_) {
+        return (0 != _to && _to->serialize(shared_data_.get(), shared_length_));
+    }
     return (0 != _to && _to->serialize(data_));
 }
 
 bool payload_impl::deserialize(deserializer *_from) {
+    shared_data_.reset();
+    shared_length_ = 0;
     return (0 != _from && _from->deserialize(data_));
 }
 
+bool payload_impl::is_shared() const {
+    return (shared_data_ != nullptr);
+}
+
+void payload_impl::unshare() {
+    if (shared_data_) {
+        data_.assign(shared_data_.get(), shared_data_.get() + shared_length_);
+        shared_data_.reset();
+        shared_length_ = 0;
+    }
+}
+
 } // namespace vsomeip_v3
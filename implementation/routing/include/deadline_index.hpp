@@ -0,0 +1,144 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_DEADLINE_INDEX_HPP_
+#define VSOMEIP_V3_DEADLINE_INDEX_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace vsomeip_v3 {
+
+// Orders keys by their deadlines. The keys are kept in a min-heap that is
+// updated lazily: Moving a deadline to a later point in time (a refreshed
+// TTL) only updates the deadline of the key. The heap entry is moved when
+// it becomes due. Thus, refreshing is O(1) and expiring is proportional to
+// the number of keys that become due.
+//
+// The index is not thread safe.
+template<typename Key, typename Hash = std::hash<Key> >
+class deadline_index {
+public:
+    typedef std::chrono::steady_clock::time_point time_point_t;
+
+    // Sets the deadline of _key.
+    void set(const Key &_key, const time_point_t &_deadline) {
+        auto found_key = keys_.find(_key);
+        if (found_key == keys_.end()) {
+            keys_.emplace(_key, entry { _deadline, _deadline });
+            push(_deadline, _key);
+        } else {
+            found_key->second.deadline_ = _deadline;
+            if (_deadline < found_key->second.queued_) {
+                found_key->second.queued_ = _deadline;
+                push(_deadline, _key);
+            }
+        }
+    }
+
+    // Sets the deadline of _key unless it already is due earlier.
+    void set_if_earlier(const Key &_key, const time_point_t &_deadline) {
+        auto found_key = keys_.find(_key);
+        if (found_key == keys_.end() || _deadline < found_key->second.deadline_)
+            set(_key, _deadline);
+    }
+
+    void erase(const Key &_key) {
+        // The heap entry is dropped when it becomes due, unless outdated
+        // entries make up most of the heap. Dropping them early releases
+        // the keys they hold.
+        if (keys_.erase(_key) && heap_.size() > 2 * keys_.size() + 16)
+            compact();
+    }
+
+    // Removes all keys whose deadline is not later than _now and appends
+    // them to _expired.
+    void expire(const time_point_t &_now, std::vector<Key> &_expired) {
+        while (!heap_.empty() && heap_.front().first <= _now) {
+            std::pair<time_point_t, Key> its_top(pop());
+            auto found_key = keys_.find(its_top.second);
+            if (found_key == keys_.end()
+                    || found_key->second.queued_ != its_top.first)
+                continue; // outdated heap entry
+
+            if (found_key->second.deadline_ <= _now) {
+                _expired.push_back(its_top.second);
+                keys_.erase(found_key);
+            } else {
+                found_key->second.queued_ = found_key->second.deadline_;
+                push(found_key->second.deadline_, its_top.second);
+            }
+        }
+    }
+
+    // Returns the point in time the next key might expire or _default if
+    // the index is empty.
+    time_point_t next(const time_point_t &_default) {
+        while (!heap_.empty()) {
+            auto found_key = keys_.find(heap_.front().second);
+            if (found_key != keys_.end()
+                    && found_key->second.queued_ == heap_.front().first)
+                return heap_.front().first;
+            pop();
+        }
+        return _default;
+    }
+
+    std::size_t size() const {
+        return keys_.size();
+    }
+
+    void clear() {
+        keys_.clear();
+        heap_.clear();
+    }
+
+private:
+    struct entry {
+        time_point_t deadline_;
+        // Deadline of the valid heap entry of the key
+        time_point_t queued_;
+    };
+
+    struct later {
+        bool operator()(const std::pair<time_point_t, Key> &_lhs,
+                const std::pair<time_point_t, Key> &_rhs) const {
+            return _lhs.first > _rhs.first;
+        }
+    };
+
+    void push(const time_point_t &_deadline, const Key &_key) {
+        heap_.emplace_back(_deadline, _key);
+        std::push_heap(heap_.begin(), heap_.end(), later());
+    }
+
+    void compact() {
+        heap_.erase(std::remove_if(heap_.begin(), heap_.end(),
+                [this](const std::pair<time_point_t, Key> &_entry) {
+                    auto found_key = keys_.find(_entry.second);
+                    return (found_key == keys_.end()
+                            || found_key->second.queued_ != _entry.first);
+                }), heap_.end());
+        std::make_heap(heap_.begin(), heap_.end(), later());
+    }
+
+    std::pair<time_point_t, Key> pop() {
+        std::pop_heap(heap_.begin(), heap_.end(), later());
+        std::pair<time_point_t, Key> its_top(std::move(heap_.back()));
+        heap_.pop_back();
+        return its_top;
+    }
+
+    std::unordered_map<Key, entry, Hash> keys_;
+    std::vector<std::pair<time_point_t, Key> > heap_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_DEADLINE_INDEX_HPP_
@@ -107,6 +107,13 @@ public:
     VSOMEIP_EXPORT std::set<client_t> get_subscribers(eventgroup_t _eventgroup);
     void clear_subscribers();
 
+    // Cheap check whether a notification would reach anybody. Remote
+    // subscriptions are tracked per eventgroup by the eventgroupinfo objects
+    // of the routing manager host.
+    bool has_subscribers() const;
+    void add_remote_subscribed_eventgroup();
+    void remove_remote_subscribed_eventgroup();
+
     void add_ref(client_t _client, bool _is_provided);
     void remove_ref(client_t _client, bool _is_provided);
     bool has_ref();
@@ -158,6 +165,9 @@ private:
     mutable std::mutex eventgroups_mutex_;
     std::map<eventgroup_t, std::set<client_t> > eventgroups_;
 
+    std::atomic<bool> has_local_subscribers_;
+    std::atomic<uint32_t> remote_subscribed_eventgroups_;
+
     std::atomic<bool> is_set_;
     std::atomic<bool> is_provided_;
 
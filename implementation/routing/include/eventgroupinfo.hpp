@@ -66,6 +66,8 @@ public:
     VSOMEIP_EXPORT void set_multicast(const boost::asio::ip::address &_address,
             uint16_t _port);
     VSOMEIP_EXPORT bool is_sending_multicast() const;
+    VSOMEIP_EXPORT std::shared_ptr<endpoint_definition>
+            get_multicast_target() const;
 
     VSOMEIP_EXPORT const std::set<std::shared_ptr<event> > get_events() const;
     VSOMEIP_EXPORT void add_event(const std::shared_ptr<event>& _event);
@@ -110,6 +112,7 @@ public:
 private:
     void update_id();
     uint32_t get_unreliable_target_count() const;
+    void update_remote_subscribed_unlocked();
 
     std::atomic<service_t> service_;
     std::atomic<instance_t> instance_;
@@ -120,9 +123,13 @@ private:
     mutable std::mutex address_mutex_;
     boost::asio::ip::address address_;
     uint16_t port_;
+    std::shared_ptr<endpoint_definition> multicast_target_;
 
     mutable std::mutex events_mutex_;
     std::set<std::shared_ptr<event> > events_;
+    // Whether the events were told about remote subscriptions. Written
+    // while holding subscriptions_mutex_ and events_mutex_.
+    bool is_remote_subscribed_;
 
     std::atomic<uint8_t> threshold_;
 
@@ -0,0 +1,124 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_LOCAL_COMMANDS_HPP_
+#define VSOMEIP_V3_LOCAL_COMMANDS_HPP_
+
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <vsomeip/enumeration_types.hpp>
+#include <vsomeip/primitive_types.hpp>
+
+#ifdef ANDROID
+#include "../../configuration/include/internal_android.hpp"
+#else
+#include "../../configuration/include/internal.hpp"
+#endif
+
+namespace vsomeip_v3 {
+
+// Payload of a REGISTER_EVENT command (also contained in REPLAY_STATE).
+// Layout:
+//   service | instance | notifier | type | is_provided | reliability |
+//   eventgroups (two byte each)
+struct register_event_command {
+    static const std::uint32_t fixed_size = VSOMEIP_REGISTER_EVENT_COMMAND_SIZE
+            - VSOMEIP_COMMAND_HEADER_SIZE;
+
+    service_t service_;
+    instance_t instance_;
+    event_t notifier_;
+    event_type_e type_;
+    bool is_provided_;
+    reliability_type_e reliability_;
+    std::set<eventgroup_t> eventgroups_;
+
+    // Returns false if _size does not cover the fixed part. A trailing
+    // byte that does not complete an eventgroup is ignored.
+    bool parse(const byte_t *_data, std::uint32_t _size) {
+        if (_size < fixed_size)
+            return false;
+
+        std::memcpy(&service_, &_data[0], sizeof(service_));
+        std::memcpy(&instance_, &_data[2], sizeof(instance_));
+        std::memcpy(&notifier_, &_data[4], sizeof(notifier_));
+        std::memcpy(&type_, &_data[6], sizeof(type_));
+        std::memcpy(&is_provided_, &_data[7], sizeof(is_provided_));
+        std::memcpy(&reliability_, &_data[8], sizeof(reliability_));
+        eventgroups_.clear();
+        for (std::uint32_t i = fixed_size; i + 1 < _size;
+                i += std::uint32_t(sizeof(eventgroup_t))) {
+            eventgroup_t its_eventgroup;
+            std::memcpy(&its_eventgroup, &_data[i], sizeof(its_eventgroup));
+            eventgroups_.insert(its_eventgroup);
+        }
+        return true;
+    }
+};
+
+// Sections of a REPLAY_STATE command payload. Layout:
+//   uint32 size of the offers | offers (as in OFFER_SERVICE)
+//   uint32 size of the event registrations |
+//       { uint32 size | event registration (as in REGISTER_EVENT) }
+//   requests (as in REQUEST_SERVICE)
+struct replay_state_command {
+    static const std::uint32_t offer_size = VSOMEIP_OFFER_SERVICE_COMMAND_SIZE
+            - VSOMEIP_COMMAND_HEADER_SIZE;
+
+    std::uint32_t offers_pos_;
+    std::uint32_t offers_size_;
+    // Position and size of each event registration
+    std::vector<std::pair<std::uint32_t, std::uint32_t> > events_;
+    std::uint32_t requests_pos_;
+    std::uint32_t requests_size_;
+
+    // Checks the section sizes against _size. Returns false if a section
+    // exceeds its enclosing data or the offers are not a multiple of
+    // offer_size. The requests are checked when being handled.
+    bool parse(const byte_t *_data, std::uint32_t _size) {
+        events_.clear();
+        if (_size < sizeof(offers_size_))
+            return false;
+        std::memcpy(&offers_size_, &_data[0], sizeof(offers_size_));
+        offers_pos_ = std::uint32_t(sizeof(offers_size_));
+        if (offers_size_ % offer_size > 0
+                || offers_size_ > _size - offers_pos_)
+            return false;
+
+        std::uint32_t its_events_size;
+        const std::uint32_t its_events_pos(offers_pos_ + offers_size_);
+        if (_size - its_events_pos < sizeof(its_events_size))
+            return false;
+        std::memcpy(&its_events_size, &_data[its_events_pos],
+                sizeof(its_events_size));
+        std::uint32_t i = its_events_pos + std::uint32_t(sizeof(its_events_size));
+        if (its_events_size > _size - i)
+            return false;
+
+        requests_pos_ = i + its_events_size;
+        requests_size_ = _size - requests_pos_;
+        while (i < requests_pos_) {
+            std::uint32_t its_entry_size;
+            if (requests_pos_ - i < sizeof(its_entry_size))
+                return false;
+            std::memcpy(&its_entry_size, &_data[i], sizeof(its_entry_size));
+            i += std::uint32_t(sizeof(its_entry_size));
+            if (its_entry_size < register_event_command::fixed_size
+                    || its_entry_size > requests_pos_ - i)
+                return false;
+            events_.push_back(std::make_pair(i, its_entry_size));
+            i += its_entry_size;
+        }
+        return true;
+    }
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_LOCAL_COMMANDS_HPP_
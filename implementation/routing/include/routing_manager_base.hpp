@@ -8,8 +8,6 @@
 
 #include <mutex>
 #include <unordered_set>
-#include <queue>
-#include <condition_variable>
 
 #include <vsomeip/constants.hpp>
 
@@ -33,6 +31,7 @@ class connector_impl;
 } // namespace trace
 #endif
 
+class message_impl;
 class serializer;
 
 class routing_manager_base : public routing_manager,
@@ -155,7 +154,7 @@ protected:
     std::shared_ptr<eventgroupinfo> find_eventgroup(service_t _service,
             instance_t _instance, eventgroup_t _eventgroup) const;
 
-    void remove_eventgroup_info(service_t _service, instance_t _instance,
+    virtual void remove_eventgroup_info(service_t _service, instance_t _instance,
             eventgroup_t _eventgroup);
 
     bool send_local_notification(client_t _client,
@@ -167,6 +166,11 @@ protected:
             const byte_t *_data, uint32_t _size, instance_t _instance,
             bool _reliable, uint8_t _command, uint8_t _status_check = 0) const;
 
+    bool send_local(
+            std::shared_ptr<endpoint> &_target, client_t _client,
+            const std::shared_ptr<message_impl> &_message,
+            uint8_t _command, uint8_t _status_check = 0) const;
+
     bool insert_subscription(service_t _service, instance_t _instance,
             eventgroup_t _eventgroup, event_t _event, client_t _client,
             std::set<event_t> *_already_subscribed_events);
@@ -220,6 +224,10 @@ protected:
 #endif
 
 private:
+    void fill_send_command_header(std::vector<byte_t> &_command_header,
+            client_t _client, uint32_t _size, instance_t _instance,
+            bool _reliable, uint8_t _command, uint8_t _status_check) const;
+
     virtual bool create_placeholder_event_and_subscribe(
             service_t _service, instance_t _instance, eventgroup_t _eventgroup,
             event_t _event, client_t _client) = 0;
@@ -231,13 +239,14 @@ protected:
 
     std::shared_ptr<configuration> configuration_;
 
-    std::queue<std::shared_ptr<serializer>> serializers_;
-    std::mutex serializer_mutex_;
-    std::condition_variable serializer_condition_;
-
-    std::queue<std::shared_ptr<deserializer>> deserializers_;
-    std::mutex deserializer_mutex_;
-    std::condition_variable deserializer_condition_;
+    // Used for new (de)serializers. Existing ones are cached per thread
+    // and buffer shrink threshold, as the applications of a process may
+    // use different thresholds.
+    const std::uint32_t buffer_shrink_threshold_;
+    static thread_local std::map<std::uint32_t,
+        std::vector<std::shared_ptr<serializer>>> cached_serializers_;
+    static thread_local std::map<std::uint32_t,
+        std::vector<std::shared_ptr<deserializer>>> cached_deserializers_;
 
     mutable std::mutex local_services_mutex_;
     typedef std::map<service_t, std::map<instance_t,
@@ -20,6 +20,7 @@
 #include <vsomeip/primitive_types.hpp>
 #include <vsomeip/handler.hpp>
 
+#include "deadline_index.hpp"
 #include "routing_manager_base.hpp"
 #include "routing_manager_stub_host.hpp"
 #include "types.hpp"
@@ -414,6 +415,14 @@ private:
             method_t _method, length_t _length);
     void statistics_log_timer_cbk(boost::system::error_code const & _error);
 
+    void schedule_subscription_expiration(
+            const std::shared_ptr<eventgroupinfo> &_eventgroup, ttl_t _ttl);
+    void unschedule_subscription_expiration(
+            const std::shared_ptr<eventgroupinfo> &_eventgroup);
+
+    void remove_eventgroup_info(service_t _service, instance_t _instance,
+            eventgroup_t _eventgroup);
+
 private:
     std::shared_ptr<routing_manager_stub> stub_;
     std::shared_ptr<sd::service_discovery> discovery_;
@@ -430,6 +439,18 @@ private:
 
     std::shared_ptr<serviceinfo> sd_info_;
 
+    // Serializes adding and removing routing info, as the SD worker threads
+    // may process offers and stop offers of the same service concurrently
+    std::mutex routing_info_mutex_;
+
+    // Expirations of remote offers, keyed by (service << 16 | instance).
+    // Guarded by services_remote_mutex_.
+    deadline_index<std::uint32_t> remote_offer_expirations_;
+
+    // Earliest expirations of the remote subscriptions per eventgroup
+    std::mutex remote_subscription_expirations_mutex_;
+    deadline_index<std::shared_ptr<eventgroupinfo> > remote_subscription_expirations_;
+
     std::mutex version_log_timer_mutex_;
     boost::asio::steady_timer version_log_timer_;
 
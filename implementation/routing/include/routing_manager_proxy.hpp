@@ -61,6 +61,8 @@ public:
             service_t _service, instance_t _instance,
             eventgroup_t _eventgroup, event_t _event);
 
+    bool send(client_t _client, std::shared_ptr<message> _message);
+
     bool send(client_t _client, const byte_t *_data, uint32_t _size,
             instance_t _instance, bool _reliable,
             client_t _bound_client = VSOMEIP_ROUTING_CLIENT,
@@ -153,6 +155,11 @@ private:
             major_version_t _major, minor_version_t _minor);
 
     void send_pending_commands();
+    bool send_replay_state();
+
+    void batch_command(const byte_t *_data, uint32_t _size);
+    void flush_batched_commands();
+    void flush_batched_commands_unlocked();
 
     void init_receiver();
 
@@ -181,6 +188,11 @@ private:
 
     void request_debounce_timeout_cbk(boost::system::error_code const &_error);
 
+#ifdef VSOMEIP_ENABLE_ALLOCATION_STATISTICS
+    void start_status_log_timer();
+    void status_log_timer_cbk(boost::system::error_code const &_error);
+#endif
+
     void send_request_services(std::set<service_data_t>& _requests);
 
     void send_unsubscribe_ack(service_t _service, instance_t _instance,
@@ -247,6 +259,8 @@ private:
     std::mutex remote_subscriber_count_mutex_;
 
     mutable std::mutex sender_mutex_;
+    // Control commands to be sent within the next batch (guarded by sender_mutex_)
+    std::vector<byte_t> batched_commands_;
 
     boost::asio::steady_timer register_application_timer_;
 
@@ -254,6 +268,11 @@ private:
     boost::asio::steady_timer request_debounce_timer_;
     bool request_debounce_timer_running_;
 
+#ifdef VSOMEIP_ENABLE_ALLOCATION_STATISTICS
+    std::mutex status_log_timer_mutex_;
+    boost::asio::steady_timer status_log_timer_;
+#endif
+
     const bool client_side_logging_;
     const std::set<std::tuple<service_t, instance_t> > client_side_logging_filter_;
 
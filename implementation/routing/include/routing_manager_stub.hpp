@@ -118,6 +118,17 @@ public:
 private:
     void broadcast(const std::vector<byte_t> &_command) const;
 
+    void handle_offer_service(client_t _client,
+            std::uint32_t _uid, std::uint32_t _gid, const byte_t *_data);
+    void handle_request_services(client_t _client,
+            std::uint32_t _uid, std::uint32_t _gid,
+            const byte_t *_data, std::uint32_t _size);
+    void handle_register_event(client_t _client,
+            const byte_t *_data, std::uint32_t _size);
+    void handle_replay_state(client_t _client,
+            std::uint32_t _uid, std::uint32_t _gid,
+            const byte_t *_data, std::uint32_t _size);
+
     void on_register_application(client_t _client);
     void on_deregister_application(client_t _client);
 
@@ -230,6 +241,11 @@ private:
     std::map<client_t, std::set<client_t>> connection_matrix_;
 
     std::map<client_t, std::vector<byte_t>> client_routing_info_;
+    // Routing info that is collected while a state replay is processed
+    // (guarded by routing_info_mutex_)
+    std::mutex replay_mutex_;
+    std::thread::id replay_thread_;
+    std::map<client_t, std::vector<byte_t>> replay_routing_info_;
     std::map<client_t, std::vector<byte_t>> offered_services_info_;
     std::map<client_t, std::vector<byte_t>> client_credentials_info_;
 
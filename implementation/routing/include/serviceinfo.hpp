@@ -40,9 +40,6 @@ public:
     VSOMEIP_EXPORT ttl_t get_ttl() const;
     VSOMEIP_EXPORT void set_ttl(ttl_t _ttl);
 
-    VSOMEIP_EXPORT std::chrono::milliseconds get_precise_ttl() const;
-    VSOMEIP_EXPORT void set_precise_ttl(std::chrono::milliseconds _precise_ttl);
-
     VSOMEIP_EXPORT std::shared_ptr<endpoint> get_endpoint(bool _reliable) const;
     VSOMEIP_EXPORT void set_endpoint(const std::shared_ptr<endpoint>& _endpoint,
             bool _reliable);
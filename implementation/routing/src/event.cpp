@@ -29,6 +29,8 @@ event::event(routing_manager *_routing, bool _is_shadow) :
         cycle_(std::chrono::milliseconds::zero()),
         change_resets_cycle_(false),
         is_updating_on_change_(true),
+        has_local_subscribers_(false),
+        remote_subscribed_eventgroups_(0),
         is_set_(false),
         is_provided_(false),
         is_shadow_(_is_shadow),
@@ -277,6 +279,11 @@ void event::update_cbk(boost::system::error_code const &_error) {
 
 void event::notify() {
     if (is_set_) {
+        // Nobody listens: the payload is cached (initial events), but
+        // neither a session is consumed nor the message is serialized.
+        if (!has_subscribers())
+            return;
+
         message_->set_session(routing_->get_session());
         routing_->send(VSOMEIP_ROUTING_CLIENT, message_);
     } else {
@@ -345,9 +352,16 @@ bool event::set_payload_helper(const std::shared_ptr<payload> &_payload, bool _f
 }
 
 void event::reset_payload(const std::shared_ptr<payload> &_payload) {
-    std::shared_ptr<payload> its_new_payload
-        = runtime::get()->create_payload(
-              _payload->get_data(), _payload->get_length());
+    // Shared payloads refer to immutable buffers. Keep a reference to
+    // them instead of copying the (possibly large) content.
+    std::shared_ptr<payload> its_new_payload;
+    const auto its_shared_payload = std::dynamic_pointer_cast<payload_impl>(_payload);
+    if (its_shared_payload && its_shared_payload->is_shared()) {
+        its_new_payload = std::make_shared<payload_impl>(*its_shared_payload);
+    } else {
+        its_new_payload = runtime::get()->create_payload(
+                _payload->get_data(), _payload->get_length());
+    }
     message_->set_payload(its_new_payload);
 
     if (!is_set_)
@@ -401,6 +415,8 @@ bool event::add_subscriber(eventgroup_t _eventgroup, client_t _client, bool _for
             || is_shadow_ // local events managed by rm_impl
             || is_cache_placeholder_) {
         ret = eventgroups_[_eventgroup].insert(_client).second;
+        if (ret)
+            has_local_subscribers_ = true;
     } else {
         VSOMEIP_WARNING << __func__ << ": Didnt' insert client "
                 << std::hex << std::setw(4) << std::setfill('0') << _client
@@ -413,8 +429,17 @@ bool event::add_subscriber(eventgroup_t _eventgroup, client_t _client, bool _for
 void event::remove_subscriber(eventgroup_t _eventgroup, client_t _client) {
     std::lock_guard<std::mutex> its_lock(eventgroups_mutex_);
     auto find_eventgroup = eventgroups_.find(_eventgroup);
-    if (find_eventgroup != eventgroups_.end())
-        find_eventgroup->second.erase(_client);
+    if (find_eventgroup != eventgroups_.end()
+            && find_eventgroup->second.erase(_client)) {
+        bool has_local_subscribers(false);
+        for (const auto &e : eventgroups_) {
+            if (!e.second.empty()) {
+                has_local_subscribers = true;
+                break;
+            }
+        }
+        has_local_subscribers_ = has_local_subscribers;
+    }
 }
 
 bool event::has_subscriber(eventgroup_t _eventgroup, client_t _client) {
@@ -443,6 +468,20 @@ void event::clear_subscribers() {
     std::lock_guard<std::mutex> its_lock(eventgroups_mutex_);
     for (auto &e : eventgroups_)
         e.second.clear();
+    has_local_subscribers_ = false;
+}
+
+bool event::has_subscribers() const {
+    return (has_local_subscribers_ || remote_subscribed_eventgroups_ > 0);
+}
+
+void event::add_remote_subscribed_eventgroup() {
+    remote_subscribed_eventgroups_++;
+}
+
+void event::remove_remote_subscribed_eventgroup() {
+    if (remote_subscribed_eventgroups_ > 0)
+        remote_subscribed_eventgroups_--;
 }
 
 bool event::has_ref(client_t _client, bool _is_provided) {
@@ -497,8 +536,10 @@ bool event::compare(const std::shared_ptr<payload> &_lhs,
     bool is_change = (_lhs->get_length() != _rhs->get_length());
     if (!is_change) {
         std::size_t its_pos = 0;
-        const byte_t *its_old_data = _lhs->get_data();
-        const byte_t *its_new_data = _rhs->get_data();
+        const payload &its_lhs = *_lhs;
+        const payload &its_rhs = *_rhs;
+        const byte_t *its_old_data = its_lhs.get_data();
+        const byte_t *its_new_data = its_rhs.get_data();
         while (!is_change && its_pos < _lhs->get_length()) {
             is_change = (*its_old_data++ != *its_new_data++);
             its_pos++;
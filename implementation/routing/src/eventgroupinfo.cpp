@@ -23,6 +23,7 @@ eventgroupinfo::eventgroupinfo()
       major_(DEFAULT_MAJOR),
       ttl_(DEFAULT_TTL),
       port_(ILLEGAL_PORT),
+      is_remote_subscribed_(false),
       threshold_(0),
       id_(PENDING_SUBSCRIPTION_ID),
       reliability_(reliability_type_e::RT_UNKNOWN),
@@ -39,6 +40,7 @@ eventgroupinfo::eventgroupinfo(
       major_(_major),
       ttl_(_ttl),
       port_(ILLEGAL_PORT),
+      is_remote_subscribed_(false),
       threshold_(0),
       id_(PENDING_SUBSCRIPTION_ID),
       reliability_(reliability_type_e::RT_UNKNOWN),
@@ -115,6 +117,18 @@ void eventgroupinfo::set_multicast(const boost::asio::ip::address &_address,
     std::lock_guard<std::mutex> its_lock(address_mutex_);
     address_ = _address;
     port_ = _port;
+    if (address_.is_multicast()) {
+        multicast_target_ = endpoint_definition::get(
+                address_, port_, false, service_, instance_);
+    } else {
+        multicast_target_.reset();
+    }
+}
+
+std::shared_ptr<endpoint_definition>
+eventgroupinfo::get_multicast_target() const {
+    std::lock_guard<std::mutex> its_lock(address_mutex_);
+    return multicast_target_;
 }
 
 const std::set<std::shared_ptr<event> > eventgroupinfo::get_events() const {
@@ -124,7 +138,8 @@ const std::set<std::shared_ptr<event> > eventgroupinfo::get_events() const {
 
 void eventgroupinfo::add_event(const std::shared_ptr<event>& _event) {
     std::lock_guard<std::mutex> its_lock(events_mutex_);
-    events_.insert(_event);
+    if (events_.insert(_event).second && is_remote_subscribed_)
+        _event->add_remote_subscribed_eventgroup();
 
     if (!reliability_auto_mode_ &&
             _event->get_reliability() == reliability_type_e::RT_UNKNOWN) {
@@ -157,7 +172,8 @@ void eventgroupinfo::add_event(const std::shared_ptr<event>& _event) {
 
 void eventgroupinfo::remove_event(const std::shared_ptr<event>& _event) {
     std::lock_guard<std::mutex> its_lock(events_mutex_);
-    events_.erase(_event);
+    if (events_.erase(_event) && is_remote_subscribed_)
+        _event->remove_remote_subscribed_eventgroup();
 }
 
 reliability_type_e eventgroupinfo::get_reliability() const {
@@ -236,6 +252,7 @@ eventgroupinfo::update_remote_subscription(
                     update_id();
                     _subscription->set_id(id_);
                     subscriptions_[id_] = _subscription;
+                    update_remote_subscribed_unlocked();
                 } else {
                     if (!_subscription->is_pending()) {
                         if (!_subscription->force_initial_events()) {
@@ -271,6 +288,7 @@ eventgroupinfo::add_remote_subscription(
 
     _subscription->set_id(id_);
     subscriptions_[id_] = _subscription;
+    update_remote_subscribed_unlocked();
 
     return id_;
 }
@@ -292,12 +310,29 @@ eventgroupinfo::remove_remote_subscription(
         const remote_subscription_id_t _id) {
     std::lock_guard<std::mutex> its_lock(subscriptions_mutex_);
     subscriptions_.erase(_id);
+    update_remote_subscribed_unlocked();
 }
 
 void
 eventgroupinfo::clear_remote_subscriptions() {
     std::lock_guard<std::mutex> its_lock(subscriptions_mutex_);
     subscriptions_.clear();
+    update_remote_subscribed_unlocked();
+}
+
+void
+eventgroupinfo::update_remote_subscribed_unlocked() {
+    std::lock_guard<std::mutex> its_lock(events_mutex_);
+    const bool is_remote_subscribed(!subscriptions_.empty());
+    if (is_remote_subscribed != is_remote_subscribed_) {
+        is_remote_subscribed_ = is_remote_subscribed;
+        for (const auto &its_event : events_) {
+            if (is_remote_subscribed_)
+                its_event->add_remote_subscribed_eventgroup();
+            else
+                its_event->remove_remote_subscribed_eventgroup();
+        }
+    }
 }
 
 std::set<std::shared_ptr<endpoint_definition> >
@@ -11,35 +11,34 @@
 #include "../include/routing_manager_base.hpp"
 #include "../../endpoints/include/local_client_endpoint_impl.hpp"
 #include "../../endpoints/include/local_server_endpoint_impl.hpp"
+#include "../../message/include/message_impl.hpp"
 #include "../../security/include/security.hpp"
 #ifdef USE_DLT
 #include "../../tracing/include/connector_impl.hpp"
 #endif
+#include "../../utility/include/allocation_statistics.hpp"
 #include "../../utility/include/byteorder.hpp"
 #include "../../utility/include/utility.hpp"
 
 namespace vsomeip_v3 {
 
+// (De)serializers are cached per thread. This way, any number of sending
+// and receiving threads can use them without waiting for each other.
+thread_local std::map<std::uint32_t, std::vector<std::shared_ptr<serializer>>>
+        routing_manager_base::cached_serializers_;
+thread_local std::map<std::uint32_t, std::vector<std::shared_ptr<deserializer>>>
+        routing_manager_base::cached_deserializers_;
+
 routing_manager_base::routing_manager_base(routing_manager_host *_host) :
         host_(_host),
         io_(host_->get_io()),
         client_(host_->get_client()),
-        configuration_(host_->get_configuration())
+        configuration_(host_->get_configuration()),
+        buffer_shrink_threshold_(configuration_->get_buffer_shrink_threshold())
 #ifdef USE_DLT
         , tc_(trace::connector_impl::get())
 #endif
 {
-    const std::size_t its_max = configuration_->get_io_thread_count(host_->get_name());
-    const uint32_t its_buffer_shrink_threshold =
-            configuration_->get_buffer_shrink_threshold();
-
-    for (std::size_t i = 0; i < its_max; ++i) {
-        serializers_.push(
-            std::make_shared<serializer>(its_buffer_shrink_threshold));
-        deserializers_.push(
-            std::make_shared<deserializer>(its_buffer_shrink_threshold));
-    }
-
     own_uid_ = ANY_UID;
     own_gid_ = ANY_GID;
 #ifndef _WIN32
@@ -370,8 +369,10 @@ void routing_manager_base::register_event(client_t _client,
                         }
 
                         if (!is_changed) {
-                            const byte_t *its_old = _old->get_data();
-                            const byte_t *its_new = _new->get_data();
+                            const byte_t *its_old
+                                = static_cast<const payload &>(*_old).get_data();
+                            const byte_t *its_new
+                                = static_cast<const payload &>(*_new).get_data();
                             for (length_t i = 0; i < its_min_length; i++) {
                                 auto j = its_debounce->ignore_.find(i);
                                 if (j == its_debounce->ignore_.end()) {
@@ -841,6 +842,7 @@ void routing_manager_base::notify_one_current_value(
 
 bool routing_manager_base::send(client_t _client,
         std::shared_ptr<message> _message) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::ROUTING, _message->get_message_type());
     bool is_sent(false);
     if (utility::is_request(_message->get_message_type())) {
         _message->set_client(_client);
@@ -1187,27 +1189,57 @@ bool routing_manager_base::send_local(
         std::shared_ptr<endpoint>& _target, client_t _client,
         const byte_t *_data, uint32_t _size, instance_t _instance,
         bool _reliable, uint8_t _command, uint8_t _status_check) const {
+    std::vector<byte_t> its_command_header(VSOMEIP_SEND_COMMAND_SIZE);
+    fill_send_command_header(its_command_header, _client, _size, _instance,
+            _reliable, _command, _status_check);
+
+    return _target->send(its_command_header, _data, _size);
+}
+
+bool routing_manager_base::send_local(
+        std::shared_ptr<endpoint>& _target, client_t _client,
+        const std::shared_ptr<message_impl> &_message,
+        uint8_t _command, uint8_t _status_check) const {
+    // The SOME/IP header is written behind the command header. This way the
+    // payload is copied only once, into the buffer of the target endpoint.
+    const std::shared_ptr<const payload> its_payload(_message->get_payload());
+    const uint32_t its_payload_size(its_payload ? its_payload->get_length() : 0);
+
+    std::vector<byte_t> its_command_header(
+            VSOMEIP_SEND_COMMAND_SIZE + VSOMEIP_FULL_HEADER_SIZE);
+    fill_send_command_header(its_command_header, _client,
+            VSOMEIP_FULL_HEADER_SIZE + its_payload_size,
+            _message->get_instance(), _message->is_reliable(),
+            _command, _status_check);
+    _message->write_header(&its_command_header[VSOMEIP_SEND_COMMAND_PAYLOAD_POS]);
+
+    return _target->send(its_command_header,
+            (its_payload_size > 0 ? its_payload->get_data() : nullptr),
+            its_payload_size);
+}
+
+void routing_manager_base::fill_send_command_header(
+        std::vector<byte_t> &_command_header, client_t _client,
+        uint32_t _size, instance_t _instance, bool _reliable,
+        uint8_t _command, uint8_t _status_check) const {
     const std::size_t its_complete_size = VSOMEIP_SEND_COMMAND_SIZE
             - VSOMEIP_COMMAND_HEADER_SIZE + _size;
     const client_t sender = get_client();
 
-    std::vector<byte_t> its_command_header(VSOMEIP_SEND_COMMAND_SIZE);
-    its_command_header[VSOMEIP_COMMAND_TYPE_POS] = _command;
-    std::memcpy(&its_command_header[VSOMEIP_COMMAND_CLIENT_POS],
+    _command_header[VSOMEIP_COMMAND_TYPE_POS] = _command;
+    std::memcpy(&_command_header[VSOMEIP_COMMAND_CLIENT_POS],
             &sender, sizeof(client_t));
-    std::memcpy(&its_command_header[VSOMEIP_COMMAND_SIZE_POS_MIN],
+    std::memcpy(&_command_header[VSOMEIP_COMMAND_SIZE_POS_MIN],
             &its_complete_size, sizeof(_size));
-    std::memcpy(&its_command_header[VSOMEIP_SEND_COMMAND_INSTANCE_POS_MIN],
+    std::memcpy(&_command_header[VSOMEIP_SEND_COMMAND_INSTANCE_POS_MIN],
             &_instance, sizeof(instance_t));
-    std::memcpy(&its_command_header[VSOMEIP_SEND_COMMAND_RELIABLE_POS],
+    std::memcpy(&_command_header[VSOMEIP_SEND_COMMAND_RELIABLE_POS],
             &_reliable, sizeof(bool));
-    std::memcpy(&its_command_header[VSOMEIP_SEND_COMMAND_CHECK_STATUS_POS],
+    std::memcpy(&_command_header[VSOMEIP_SEND_COMMAND_CHECK_STATUS_POS],
             &_status_check, sizeof(uint8_t));
     // Add target client, only relevant for selective notifications
-    std::memcpy(&its_command_header[VSOMEIP_SEND_COMMAND_DST_CLIENT_POS_MIN],
+    std::memcpy(&_command_header[VSOMEIP_SEND_COMMAND_DST_CLIENT_POS_MIN],
             &_client, sizeof(client_t));
-
-    return _target->send(its_command_header, _data, _size);
 }
 
 bool routing_manager_base::insert_subscription(
@@ -1273,57 +1305,45 @@ bool routing_manager_base::insert_subscription(
 }
 
 std::shared_ptr<serializer> routing_manager_base::get_serializer() {
-
-    std::unique_lock<std::mutex> its_lock(serializer_mutex_);
-    while (serializers_.empty()) {
-        VSOMEIP_INFO << __func__ << ": Client "
-                << std::hex << std::setw(4) << std::setfill('0')
-                << get_client()
-                << " has no available serializer. Waiting...";
-        serializer_condition_.wait(its_lock);
-        VSOMEIP_INFO << __func__ << ": Client "
-                        << std::hex << std::setw(4) << std::setfill('0')
-                        << get_client()
-                        << " now checking for available serializer.";
+    std::shared_ptr<serializer> its_serializer;
+    auto &its_cached = cached_serializers_[buffer_shrink_threshold_];
+    if (!its_cached.empty()) {
+        its_serializer = its_cached.back();
+        its_cached.pop_back();
+    } else {
+        its_serializer = std::make_shared<serializer>(buffer_shrink_threshold_);
     }
-
-    auto its_serializer = serializers_.front();
-    serializers_.pop();
-
     return (its_serializer);
 }
 
 void routing_manager_base::put_serializer(
         const std::shared_ptr<serializer> &_serializer) {
-
-    std::lock_guard<std::mutex> its_lock(serializer_mutex_);
-    serializers_.push(_serializer);
-    serializer_condition_.notify_one();
+    // Keeps memory bounded if (de)serializers are nested or put back
+    // on another thread. The buffers themselves shrink on reset.
+    auto &its_cached = cached_serializers_[buffer_shrink_threshold_];
+    if (its_cached.size() < VSOMEIP_MAX_CACHED_SERIALIZERS) {
+        its_cached.push_back(_serializer);
+    }
 }
 
 std::shared_ptr<deserializer> routing_manager_base::get_deserializer() {
-
-    std::unique_lock<std::mutex> its_lock(deserializer_mutex_);
-    while (deserializers_.empty()) {
-        VSOMEIP_INFO << std::hex << "client " << get_client() <<
-                "routing_manager_base::get_deserializer ~> all in use!";
-        deserializer_condition_.wait(its_lock);
-        VSOMEIP_INFO << std::hex << "client " << get_client() <<
-                        "routing_manager_base::get_deserializer ~> wait finished!";
+    std::shared_ptr<deserializer> its_deserializer;
+    auto &its_cached = cached_deserializers_[buffer_shrink_threshold_];
+    if (!its_cached.empty()) {
+        its_deserializer = its_cached.back();
+        its_cached.pop_back();
+    } else {
+        its_deserializer = std::make_shared<deserializer>(buffer_shrink_threshold_);
     }
-
-    auto its_deserializer = deserializers_.front();
-    deserializers_.pop();
-
     return (its_deserializer);
 }
 
 void routing_manager_base::put_deserializer(
         const std::shared_ptr<deserializer> &_deserializer) {
-
-    std::lock_guard<std::mutex> its_lock(deserializer_mutex_);
-    deserializers_.push(_deserializer);
-    deserializer_condition_.notify_one();
+    auto &its_cached = cached_deserializers_[buffer_shrink_threshold_];
+    if (its_cached.size() < VSOMEIP_MAX_CACHED_SERIALIZERS) {
+        its_cached.push_back(_deserializer);
+    }
 }
 
 void routing_manager_base::send_pending_subscriptions(service_t _service,
@@ -40,12 +40,14 @@
 #include "../../endpoints/include/udp_server_endpoint_impl.hpp"
 #include "../../endpoints/include/virtual_server_endpoint_impl.hpp"
 #include "../../message/include/deserializer.hpp"
+#include "../../message/include/message_header_view.hpp"
 #include "../../message/include/message_impl.hpp"
 #include "../../message/include/serializer.hpp"
 #include "../../service_discovery/include/constants.hpp"
 #include "../../service_discovery/include/defines.hpp"
 #include "../../service_discovery/include/runtime.hpp"
 #include "../../service_discovery/include/service_discovery.hpp"
+#include "../../utility/include/allocation_statistics.hpp"
 #include "../../utility/include/byteorder.hpp"
 #include "../../utility/include/utility.hpp"
 #include "../../plugin/include/plugin_manager_impl.hpp"
@@ -743,6 +745,7 @@ bool routing_manager_impl::send(client_t _client, const byte_t *_data,
         client_t _bound_client,
         credentials_t _credentials,
         uint8_t _status_check, bool _sent_from_remote) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::ROUTING, _data, _size);
     bool is_sent(false);
     if (_size > VSOMEIP_MESSAGE_TYPE_POS) {
         std::shared_ptr<endpoint> its_target;
@@ -804,8 +807,6 @@ bool routing_manager_impl::send(client_t _client, const byte_t *_data,
                 // TODO: Find out how to handle session id here
                 is_sent = deliver_message(_data, _size, _instance, _reliable, VSOMEIP_ROUTING_CLIENT, _credentials, _status_check);
             } else {
-                e2e_buffer its_buffer;
-
                 if (e2e_provider_) {
                     if ( !is_service_discovery) {
                         service_t its_service = VSOMEIP_BYTES_TO_WORD(
@@ -817,15 +818,10 @@ bool routing_manager_impl::send(client_t _client, const byte_t *_data,
                             // Find out where the protected area starts
                             size_t its_base = e2e_provider_->get_protection_base({its_service, its_method});
 
-                            // Build a corresponding buffer
-                            its_buffer.assign(_data + its_base, _data + _size);
-
-                            e2e_provider_->protect({ its_service, its_method }, its_buffer, _instance);
-
-                            // Prepend header
-                            its_buffer.insert(its_buffer.begin(), _data, _data + its_base);
-
-                            _data = its_buffer.data();
+                            // Protect the area within the message buffer
+                            e2e_provider_->protect({ its_service, its_method },
+                                    mutable_buffer_view(const_cast<byte_t*>(_data) + its_base,
+                                            _size - its_base), _instance);
                        }
 #endif
                     }
@@ -895,12 +891,9 @@ bool routing_manager_impl::send(client_t _client, const byte_t *_data,
                                             if (its_eventgroup->is_sending_multicast()) {
                                                 if (its_reliability == reliability_type_e::RT_UNRELIABLE
                                                         || its_reliability == reliability_type_e::RT_BOTH) {
-                                                    boost::asio::ip::address its_address;
-                                                    uint16_t its_port;
-                                                    if (its_eventgroup->get_multicast(its_address, its_port)) {
-                                                        std::shared_ptr<endpoint_definition> its_multicast_target;
-                                                        its_multicast_target = endpoint_definition::get(its_address,
-                                                                its_port, false, its_service, _instance);
+                                                    const auto its_multicast_target
+                                                        = its_eventgroup->get_multicast_target();
+                                                    if (its_multicast_target) {
                                                         its_targets.insert(its_multicast_target);
                                                     }
                                                 }
@@ -1006,7 +999,6 @@ bool routing_manager_impl::send_to(
     if (its_serializer->serialize(_message.get())) {
         const byte_t *its_data = its_serializer->get_data();
         length_t its_size = its_serializer->get_size();
-        e2e_buffer its_buffer;
         if (e2e_provider_) {
             service_t its_service = VSOMEIP_BYTES_TO_WORD(
                     its_data[VSOMEIP_SERVICE_POS_MIN],
@@ -1017,10 +1009,9 @@ bool routing_manager_impl::send_to(
 #ifndef ANDROID
             if (e2e_provider_->is_protected({its_service, its_method})) {
                 auto its_base = e2e_provider_->get_protection_base({its_service, its_method});
-                its_buffer.assign(its_data + its_base, its_data + its_size);
-                e2e_provider_->protect({its_service, its_method}, its_buffer, _message->get_instance());
-                its_buffer.insert(its_buffer.begin(), its_data, its_data + its_base);
-                its_data = its_buffer.data();
+                e2e_provider_->protect({its_service, its_method},
+                        mutable_buffer_view(const_cast<byte_t*>(its_data) + its_base,
+                                its_size - its_base), _message->get_instance());
            }
 #endif
         }
@@ -1317,6 +1308,7 @@ void routing_manager_impl::on_message(const byte_t *_data, length_t _size,
         client_t _bound_client, credentials_t _credentials,
         const boost::asio::ip::address &_remote_address,
         std::uint16_t _remote_port) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::ROUTING, _data, _size);
 #if 0
     std::stringstream msg;
     msg << "rmi::on_message: ";
@@ -1332,12 +1324,11 @@ void routing_manager_impl::on_message(const byte_t *_data, length_t _size,
 #ifdef USE_DLT
     bool is_forwarded(true);
 #endif
+    const message_header_view its_header(_data, _size);
     if (_size >= VSOMEIP_SOMEIP_HEADER_SIZE) {
-        its_service = VSOMEIP_BYTES_TO_WORD(_data[VSOMEIP_SERVICE_POS_MIN],
-                _data[VSOMEIP_SERVICE_POS_MAX]);
+        its_service = its_header.get_service();
         if (its_service == VSOMEIP_SD_SERVICE) {
-            its_method = VSOMEIP_BYTES_TO_WORD(_data[VSOMEIP_METHOD_POS_MIN],
-                            _data[VSOMEIP_METHOD_POS_MAX]);
+            its_method = its_header.get_method();
             if (discovery_ && its_method == sd::method) {
                 if (configuration_->get_sd_port() == _remote_port) {
                     if (!_remote_address.is_unspecified()) {
@@ -1357,15 +1348,9 @@ void routing_manager_impl::on_message(const byte_t *_data, length_t _size,
                 its_instance = ep_mgr_impl_->find_instance(its_service, _receiver);
             }
             if (its_instance == 0xFFFF) {
-                its_method = VSOMEIP_BYTES_TO_WORD(
-                        _data[VSOMEIP_METHOD_POS_MIN],
-                        _data[VSOMEIP_METHOD_POS_MAX]);
-                const client_t its_client = VSOMEIP_BYTES_TO_WORD(
-                        _data[VSOMEIP_CLIENT_POS_MIN],
-                        _data[VSOMEIP_CLIENT_POS_MAX]);
-                const session_t its_session = VSOMEIP_BYTES_TO_WORD(
-                        _data[VSOMEIP_SESSION_POS_MIN],
-                        _data[VSOMEIP_SESSION_POS_MAX]);
+                its_method = its_header.get_method();
+                const client_t its_client = its_header.get_client();
+                const session_t its_session = its_header.get_session();
                 boost::system::error_code ec;
                 VSOMEIP_ERROR << "Received message on invalid port: ["
                         << std::hex << std::setw(4) << std::setfill('0') << its_service << "."
@@ -1398,12 +1383,8 @@ void routing_manager_impl::on_message(const byte_t *_data, length_t _size,
             // Security checks if enabled!
             if (security::get()->is_enabled()) {
                 if (utility::is_request(_data[VSOMEIP_MESSAGE_TYPE_POS])) {
-                    client_t requester = VSOMEIP_BYTES_TO_WORD(
-                            _data[VSOMEIP_CLIENT_POS_MIN],
-                            _data[VSOMEIP_CLIENT_POS_MAX]);
-                    its_method = VSOMEIP_BYTES_TO_WORD(
-                               _data[VSOMEIP_METHOD_POS_MIN],
-                               _data[VSOMEIP_METHOD_POS_MAX]);
+                    client_t requester = its_header.get_client();
+                    its_method = its_header.get_method();
                     if (!configuration_->is_offered_remote(its_service, its_instance)) {
                         VSOMEIP_WARNING << std::hex << "Security: Received a remote request "
                                 << "for service/instance " << its_service << "/" << its_instance
@@ -1428,15 +1409,13 @@ void routing_manager_impl::on_message(const byte_t *_data, length_t _size,
                 }
             }
             if (e2e_provider_) {
-                its_method = VSOMEIP_BYTES_TO_WORD(
-                           _data[VSOMEIP_METHOD_POS_MIN],
-                           _data[VSOMEIP_METHOD_POS_MAX]);
+                its_method = its_header.get_method();
 #ifndef ANDROID
                 if (e2e_provider_->is_checked({its_service, its_method})) {
                     auto its_base = e2e_provider_->get_protection_base({its_service, its_method});
-                    e2e_buffer its_buffer(_data + its_base, _data + _size);
                     e2e_provider_->check({its_service, its_method},
-                            its_buffer, its_instance, its_check_status);
+                            buffer_view(_data + its_base, _size - its_base),
+                            its_instance, its_check_status);
 
                     if (its_check_status != e2e::profile_interface::generic_check_status::E2E_OK) {
                         VSOMEIP_INFO << "E2E protection: CRC check failed for service: "
@@ -1493,15 +1472,14 @@ bool routing_manager_impl::on_message(
     client_t its_client;
     bool is_forwarded(true);
 
-    if (utility::is_request(_data[VSOMEIP_MESSAGE_TYPE_POS])) {
+    const message_header_view its_header(_data, _size);
+    if (utility::is_request(its_header.get_message_type())) {
         its_client = find_local_client(_service, _instance);
     } else {
-        its_client = VSOMEIP_BYTES_TO_WORD(
-                _data[VSOMEIP_CLIENT_POS_MIN],
-                _data[VSOMEIP_CLIENT_POS_MAX]);
+        its_client = its_header.get_client();
     }
 
-    if (utility::is_notification(_data[VSOMEIP_MESSAGE_TYPE_POS])) {
+    if (utility::is_notification(its_header.get_message_type())) {
         is_forwarded = deliver_notification(_service, _instance, _data, _size,
                 _reliable, _bound_client, _credentials, _check_status, _is_from_remote);
     } else if (its_client == host_->get_client()) {
@@ -1726,6 +1704,7 @@ void routing_manager_impl::on_stop_offer_service(client_t _client, service_t _se
             if (find_instance != find_service->second.end()) {
                 for (auto e : find_instance->second) {
                     e.second->clear_remote_subscriptions();
+                    unschedule_subscription_expiration(e.second);
                 }
             }
         }
@@ -1741,11 +1720,11 @@ bool routing_manager_impl::deliver_message(const byte_t *_data, length_t _size,
     std::uint32_t its_sender_uid = std::get<0>(_credentials);
     std::uint32_t its_sender_gid = std::get<1>(_credentials);
 
-    auto its_deserializer = get_deserializer();
-    its_deserializer->set_data(_data, _size);
-    std::shared_ptr<message_impl> its_message(its_deserializer->deserialize_message());
-    its_deserializer->reset();
-    put_deserializer(its_deserializer);
+    auto its_message = std::make_shared<message_impl>();
+    if (!its_message->deserialize(message_header_view(_data, _size))) {
+        VSOMEIP_ERROR << "SOME/IP message deserialization failed!";
+        its_message.reset();
+    }
 
     if (its_message) {
         its_message->set_instance(_instance);
@@ -2158,6 +2137,8 @@ void routing_manager_impl::add_routing_info(
         const boost::asio::ip::address &_unreliable_address,
         uint16_t _unreliable_port) {
 
+    std::lock_guard<std::mutex> its_routing_info_lock(routing_info_mutex_);
+
     // Create/Update service info
     std::shared_ptr<serviceinfo> its_info(find_service(_service, _instance));
     if (!its_info) {
@@ -2194,6 +2175,17 @@ void routing_manager_impl::add_routing_info(
         its_info->set_ttl(_ttl);
     }
 
+    if (!its_info->is_local()) {
+        std::lock_guard<std::mutex> its_lock(services_remote_mutex_);
+        const std::uint32_t its_key
+            = (static_cast<std::uint32_t>(_service) << 16) | _instance;
+        if (_ttl < DEFAULT_TTL)
+            remote_offer_expirations_.set(its_key,
+                    std::chrono::steady_clock::now() + std::chrono::seconds(_ttl));
+        else
+            remote_offer_expirations_.erase(its_key);
+    }
+
     // Check whether remote services are unchanged
     bool is_reliable_known(false);
     bool is_unreliable_known(false);
@@ -2389,6 +2381,8 @@ void routing_manager_impl::add_routing_info(
 void routing_manager_impl::del_routing_info(service_t _service, instance_t _instance,
         bool _has_reliable, bool _has_unreliable) {
 
+    std::lock_guard<std::mutex> its_routing_info_lock(routing_info_mutex_);
+
     std::shared_ptr<serviceinfo> its_info(find_service(_service, _instance));
     if(!its_info)
         return;
@@ -2488,18 +2482,19 @@ void routing_manager_impl::update_routing_info(std::chrono::milliseconds _elapse
 
     {
         std::lock_guard<std::mutex> its_lock(services_remote_mutex_);
-        for (const auto &s : services_remote_) {
-            for (const auto &i : s.second) {
-                ttl_t its_ttl = i.second->get_ttl();
-                if (its_ttl < DEFAULT_TTL) { // do not touch "forever"
-                    std::chrono::milliseconds precise_ttl = i.second->get_precise_ttl();
-                    if (precise_ttl.count() < _elapsed.count() || precise_ttl.count() == 0) {
-                        i.second->set_ttl(0);
-                        its_expired_offers[s.first].push_back(i.first);
-                    } else {
-                        std::chrono::milliseconds its_new_ttl(precise_ttl - _elapsed);
-                        i.second->set_precise_ttl(its_new_ttl);
-                    }
+        std::vector<std::uint32_t> its_expired;
+        remote_offer_expirations_.expire(std::chrono::steady_clock::now(),
+                its_expired);
+        for (const auto its_key : its_expired) {
+            const service_t its_service = static_cast<service_t>(its_key >> 16);
+            const instance_t its_instance = static_cast<instance_t>(its_key & 0xFFFF);
+            auto found_service = services_remote_.find(its_service);
+            if (found_service != services_remote_.end()) {
+                auto found_instance = found_service->second.find(its_instance);
+                if (found_instance != found_service->second.end()
+                        && found_instance->second->get_ttl() < DEFAULT_TTL) { // do not touch "forever"
+                    found_instance->second->set_ttl(0);
+                    its_expired_offers[its_service].push_back(its_instance);
                 }
             }
         }
@@ -2746,6 +2741,7 @@ void routing_manager_impl::on_remote_subscribe(
     auto its_result = its_eventgroupinfo->update_remote_subscription(
             _subscription, its_expiration, its_added, its_id, true);
     if (its_result) {
+        schedule_subscription_expiration(its_eventgroupinfo, its_ttl);
         if (!_subscription->is_pending()) { // resubscription without change
             _callback(_subscription);
         } else if (!its_added.empty()) { // new clients for a selective subscription
@@ -2851,11 +2847,15 @@ void routing_manager_impl::on_subscribe_ack(client_t _client,
         if (its_subscription) {
             its_subscription->set_client_state(_client,
                     remote_subscription_state_e::SUBSCRIPTION_ACKED);
+            schedule_subscription_expiration(its_eventgroup,
+                    its_subscription->get_ttl());
 
             auto its_parent = its_subscription->get_parent();
             if (its_parent) {
                 its_parent->set_client_state(_client,
                         remote_subscription_state_e::SUBSCRIPTION_ACKED);
+                schedule_subscription_expiration(its_eventgroup,
+                        its_parent->get_ttl());
                 if (!its_subscription->is_pending()) {
                     its_eventgroup->remove_remote_subscription(_id);
                 }
@@ -2940,11 +2940,15 @@ void routing_manager_impl::on_subscribe_nack(client_t _client,
         if (its_subscription) {
             its_subscription->set_client_state(_client,
                     remote_subscription_state_e::SUBSCRIPTION_NACKED);
+            schedule_subscription_expiration(its_eventgroup,
+                    its_subscription->get_ttl());
 
             auto its_parent = its_subscription->get_parent();
             if (its_parent) {
                 its_parent->set_client_state(_client,
                         remote_subscription_state_e::SUBSCRIPTION_NACKED);
+                schedule_subscription_expiration(its_eventgroup,
+                        its_parent->get_ttl());
                 if (!its_subscription->is_pending()) {
                     its_eventgroup->remove_remote_subscription(_id);
                 }
@@ -3108,6 +3112,30 @@ void routing_manager_impl::clear_remote_subscriber(
     }
 }
 
+void
+routing_manager_impl::schedule_subscription_expiration(
+        const std::shared_ptr<eventgroupinfo> &_eventgroup, ttl_t _ttl) {
+    std::lock_guard<std::mutex> its_lock(remote_subscription_expirations_mutex_);
+    remote_subscription_expirations_.set_if_earlier(_eventgroup,
+            std::chrono::steady_clock::now() + std::chrono::seconds(_ttl));
+}
+
+void
+routing_manager_impl::unschedule_subscription_expiration(
+        const std::shared_ptr<eventgroupinfo> &_eventgroup) {
+    std::lock_guard<std::mutex> its_lock(remote_subscription_expirations_mutex_);
+    remote_subscription_expirations_.erase(_eventgroup);
+}
+
+void routing_manager_impl::remove_eventgroup_info(service_t _service,
+        instance_t _instance, eventgroup_t _eventgroup) {
+    auto its_eventgroup = find_eventgroup(_service, _instance, _eventgroup);
+    routing_manager_base::remove_eventgroup_info(
+            _service, _instance, _eventgroup);
+    if (its_eventgroup)
+        unschedule_subscription_expiration(its_eventgroup);
+}
+
 std::chrono::steady_clock::time_point
 routing_manager_impl::expire_subscriptions(bool _force) {
     std::map<std::shared_ptr<remote_subscription>,
@@ -3117,7 +3145,11 @@ routing_manager_impl::expire_subscriptions(bool _force) {
         = std::chrono::steady_clock::now();
     std::chrono::steady_clock::time_point its_next_expiration
         = std::chrono::steady_clock::now() + std::chrono::hours(24);
-    {
+    if (_force) {
+        {
+            std::lock_guard<std::mutex> its_lock(remote_subscription_expirations_mutex_);
+            remote_subscription_expirations_.clear();
+        }
         std::lock_guard<std::mutex> its_lock(eventgroups_mutex_);
 
         for (auto &its_service : eventgroups_) {
@@ -3127,23 +3159,40 @@ routing_manager_impl::expire_subscriptions(bool _force) {
                         = its_eventgroup.second->get_remote_subscriptions();
                     for (auto &s : its_subscriptions) {
                         for (auto its_client : s->get_clients()) {
-                            if (_force) {
-                                its_expired_subscriptions[s].insert(its_client);
-                            } else {
-                                auto its_expiration = s->get_expiration(its_client);
-                                if (its_expiration != std::chrono::steady_clock::time_point()) {
-                                    if (its_expiration < now) {
-                                        its_expired_subscriptions[s].insert(its_client);
-                                    } else if (its_expiration < its_next_expiration) {
-                                        its_next_expiration = its_expiration;
-                                    }
-                                }
-                            }
+                            its_expired_subscriptions[s].insert(its_client);
                         }
                     }
                 }
             }
         }
+    } else {
+        // Only the eventgroups whose earliest expiration is due are checked.
+        // Refreshed subscriptions are rescheduled when their outdated
+        // deadline is reached.
+        std::lock_guard<std::mutex> its_lock(remote_subscription_expirations_mutex_);
+        std::vector<std::shared_ptr<eventgroupinfo> > its_due;
+        remote_subscription_expirations_.expire(now, its_due);
+        for (const auto &its_eventgroup : its_due) {
+            std::chrono::steady_clock::time_point its_earliest
+                = std::chrono::steady_clock::time_point::max();
+            for (auto &s : its_eventgroup->get_remote_subscriptions()) {
+                for (auto its_client : s->get_clients()) {
+                    auto its_expiration = s->get_expiration(its_client);
+                    if (its_expiration != std::chrono::steady_clock::time_point()) {
+                        if (its_expiration < now) {
+                            its_expired_subscriptions[s].insert(its_client);
+                        } else if (its_expiration < its_earliest) {
+                            its_earliest = its_expiration;
+                        }
+                    }
+                }
+            }
+            if (its_earliest != std::chrono::steady_clock::time_point::max())
+                remote_subscription_expirations_.set_if_earlier(
+                        its_eventgroup, its_earliest);
+        }
+        its_next_expiration
+            = remote_subscription_expirations_.next(its_next_expiration);
     }
 
     for (auto &s : its_expired_subscriptions) {
@@ -4039,6 +4088,9 @@ void routing_manager_impl::status_log_timer_cbk(
     }
 
     ep_mgr_impl_->print_status();
+#ifdef VSOMEIP_ENABLE_ALLOCATION_STATISTICS
+    allocation_statistics::print();
+#endif
     {
         std::lock_guard<std::mutex> its_lock(status_log_timer_mutex_);
         boost::system::error_code ec;
@@ -4065,6 +4117,7 @@ routing_manager_impl::on_unsubscribe_ack(client_t _client,
             remote_subscribers_[_service][_instance].erase(_client);
 
             if (its_info->get_remote_subscriptions().size() == 0) {
+                unschedule_subscription_expiration(its_info);
                 for (const auto &its_event : its_info->get_events()) {
                     bool has_remote_subscriber(false);
                     for (const auto &its_eventgroup : its_event->get_eventgroups()) {
@@ -24,9 +24,11 @@
 #include "../../endpoints/include/local_client_endpoint_impl.hpp"
 #include "../../endpoints/include/local_server_endpoint_impl.hpp"
 #include "../../message/include/deserializer.hpp"
+#include "../../message/include/message_header_view.hpp"
 #include "../../message/include/message_impl.hpp"
 #include "../../message/include/serializer.hpp"
 #include "../../service_discovery/include/runtime.hpp"
+#include "../../utility/include/allocation_statistics.hpp"
 #include "../../utility/include/byteorder.hpp"
 #include "../../utility/include/utility.hpp"
 #ifdef USE_DLT
@@ -47,6 +49,9 @@ routing_manager_proxy::routing_manager_proxy(routing_manager_host *_host,
         register_application_timer_(io_),
         request_debounce_timer_ (io_),
         request_debounce_timer_running_(false),
+#ifdef VSOMEIP_ENABLE_ALLOCATION_STATISTICS
+        status_log_timer_(io_),
+#endif
         client_side_logging_(_client_side_logging),
         client_side_logging_filter_(_client_side_logging_filter)
 {
@@ -75,6 +80,12 @@ void routing_manager_proxy::start() {
             sender_->start();
         }
     }
+#ifdef VSOMEIP_ENABLE_ALLOCATION_STATISTICS
+    // Proxies have no status log, report the allocations on their own
+    if (configuration_->log_status()) {
+        start_status_log_timer();
+    }
+#endif
 }
 
 void routing_manager_proxy::stop() {
@@ -111,6 +122,14 @@ void routing_manager_proxy::stop() {
         request_debounce_timer_.cancel();
     }
 
+#ifdef VSOMEIP_ENABLE_ALLOCATION_STATISTICS
+    {
+        std::lock_guard<std::mutex> its_lock(status_log_timer_mutex_);
+        boost::system::error_code ec;
+        status_log_timer_.cancel(ec);
+    }
+#endif
+
     if (receiver_) {
         receiver_->stop();
     }
@@ -191,6 +210,7 @@ void routing_manager_proxy::send_offer_service(client_t _client,
     {
         std::lock_guard<std::mutex> its_lock(sender_mutex_);
         if (sender_) {
+            flush_batched_commands_unlocked();
             sender_->send(its_command, sizeof(its_command));
         }
     }
@@ -237,6 +257,7 @@ void routing_manager_proxy::stop_offer_service(client_t _client,
             {
                 std::lock_guard<std::mutex> its_lock(sender_mutex_);
                 if (sender_) {
+                    flush_batched_commands_unlocked();
                     sender_->send(its_command, sizeof(its_command));
                 }
             }
@@ -424,7 +445,7 @@ void routing_manager_proxy::unregister_event(client_t _client,
             {
                 std::lock_guard<std::mutex> its_lock(sender_mutex_);
                 if (sender_) {
-                    sender_->send(its_command, sizeof(its_command));
+                    batch_command(its_command, sizeof(its_command));
                 }
             }
         }
@@ -526,7 +547,7 @@ void routing_manager_proxy::send_subscribe(client_t _client, service_t _service,
     } else {
         std::lock_guard<std::mutex> its_lock(sender_mutex_);
         if (sender_) {
-            sender_->send(its_command, sizeof(its_command));
+            batch_command(its_command, sizeof(its_command));
         }
     }
 }
@@ -568,6 +589,7 @@ void routing_manager_proxy::send_subscribe_nack(client_t _subscriber,
     {
         std::lock_guard<std::mutex> its_lock(sender_mutex_);
         if (sender_) {
+            flush_batched_commands_unlocked();
             sender_->send(its_command, sizeof(its_command));
         }
     }
@@ -610,6 +632,7 @@ void routing_manager_proxy::send_subscribe_ack(client_t _subscriber,
     {
         std::lock_guard<std::mutex> its_lock(sender_mutex_);
         if (sender_) {
+            flush_batched_commands_unlocked();
             sender_->send(its_command, sizeof(its_command));
         }
     }
@@ -651,13 +674,75 @@ void routing_manager_proxy::unsubscribe(client_t _client, uid_t _uid, gid_t _gid
             } else {
                 std::lock_guard<std::mutex> its_lock(sender_mutex_);
                 if (sender_) {
-                    sender_->send(its_command, sizeof(its_command));
+                    batch_command(its_command, sizeof(its_command));
                 }
             }
         }
     }
 }
 
+bool routing_manager_proxy::send(client_t _client,
+        std::shared_ptr<message> _message) {
+    // Messages to a single target are written into the buffer of the target
+    // endpoint without serializing them first. Notifications to all local
+    // subscribers and logged or traced messages take the serializer path.
+    const std::shared_ptr<message_impl> its_message
+        = std::dynamic_pointer_cast<message_impl>(_message);
+    const bool is_notification
+        = utility::is_notification(_message->get_message_type());
+    if (!its_message || client_side_logging_
+            || (is_notification && _client == VSOMEIP_ROUTING_CLIENT)
+#ifdef USE_DLT
+            || tc_->is_enabled()
+#endif
+            ) {
+        return routing_manager_base::send(_client, _message);
+    }
+
+    {
+        std::lock_guard<std::mutex> its_lock(state_mutex_);
+        if (state_ != inner_state_type_e::ST_REGISTERED) {
+            return false;
+        }
+    }
+
+    std::shared_ptr<endpoint> its_target;
+    uint8_t its_command(VSOMEIP_SEND);
+    client_t its_client(get_client());
+    if (utility::is_request(_message->get_message_type())) {
+        _message->set_client(_client);
+        const client_t its_service_client = find_local_client(
+                _message->get_service(), _message->get_instance());
+        if (its_service_client != VSOMEIP_ROUTING_CLIENT
+                && is_client_known(its_service_client)) {
+            its_target = ep_mgr_->find_or_create_local(its_service_client);
+        }
+    } else if (!is_notification) {
+        const client_t its_requester = _message->get_client();
+        if (its_requester != VSOMEIP_ROUTING_CLIENT
+                && is_client_known(its_requester)) {
+            its_target = ep_mgr_->find_or_create_local(its_requester);
+        }
+    } else {
+        its_target = ep_mgr_->find_local(_client);
+        if (!its_target) {
+            its_command = VSOMEIP_NOTIFY_ONE;
+            its_client = _client;
+        }
+    }
+
+    if (!its_target) {
+        std::lock_guard<std::mutex> its_lock(sender_mutex_);
+        if (!sender_) {
+            return false;
+        }
+        flush_batched_commands_unlocked();
+        its_target = sender_;
+    }
+
+    return send_local(its_target, its_client, its_message, its_command);
+}
+
 bool routing_manager_proxy::send(client_t _client, const byte_t *_data,
         length_t _size, instance_t _instance,
         bool _reliable,
@@ -665,6 +750,7 @@ bool routing_manager_proxy::send(client_t _client, const byte_t *_data,
         credentials_t _credentials,
         uint8_t _status_check,
         bool _sent_from_remote) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::ROUTING, _data, _size);
     (void)_client;
     (void)_bound_client;
     (void)_credentials;
@@ -764,6 +850,7 @@ bool routing_manager_proxy::send(client_t _client, const byte_t *_data,
         if (!its_target) {
             std::lock_guard<std::mutex> its_lock(sender_mutex_);
             if (sender_) {
+                flush_batched_commands_unlocked();
                 its_target = sender_;
 #ifdef USE_DLT
                 message_to_stub = true;
@@ -845,6 +932,9 @@ void routing_manager_proxy::on_disconnect(const std::shared_ptr<endpoint>& _endp
         {
             std::lock_guard<std::mutex> its_lock(sender_mutex_);
             is_connected_ = false;
+            // Commands of the lost registration must not reach the
+            // restarted routing manager
+            batched_commands_.clear();
         }
 
         VSOMEIP_INFO << "routing_manager_proxy::on_disconnect: Client 0x" << std::hex
@@ -860,6 +950,7 @@ void routing_manager_proxy::on_message(const byte_t *_data, length_t _size,
         credentials_t _credentials,
         const boost::asio::ip::address &_remote_address,
         std::uint16_t _remote_port) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::ROUTING);
     (void)_receiver;
     (void)_destination;
     (void)_remote_address;
@@ -949,12 +1040,12 @@ void routing_manager_proxy::on_message(const byte_t *_data, length_t _size,
                 break;
             }
 
-            auto a_deserializer = get_deserializer();
-            a_deserializer->set_data(&_data[VSOMEIP_SEND_COMMAND_PAYLOAD_POS],
-                    its_message_size);
-            std::shared_ptr<message_impl> its_message(a_deserializer->deserialize_message());
-            a_deserializer->reset();
-            put_deserializer(a_deserializer);
+            auto its_message = std::make_shared<message_impl>();
+            if (!its_message->deserialize(message_header_view(
+                    &_data[VSOMEIP_SEND_COMMAND_PAYLOAD_POS], its_message_size))) {
+                VSOMEIP_ERROR << "SOME/IP message deserialization failed!";
+                its_message.reset();
+            }
 
             if (its_message) {
                 its_message->set_instance(its_instance);
@@ -1901,6 +1992,7 @@ void routing_manager_proxy::assign_client() {
                 return;
             state_ = inner_state_type_e::ST_ASSIGNING;
 
+            flush_batched_commands_unlocked();
             sender_->send(&its_command[0], static_cast<uint32_t>(its_command.size()));
 
             boost::system::error_code ec;
@@ -1926,6 +2018,7 @@ void routing_manager_proxy::register_application() {
         std::lock_guard<std::mutex> its_lock(sender_mutex_);
         if (sender_) {
             state_ = inner_state_type_e::ST_REGISTERING;
+            flush_batched_commands_unlocked();
             sender_->send(its_command, sizeof(its_command));
 
             register_application_timer_.cancel();
@@ -1948,6 +2041,7 @@ void routing_manager_proxy::deregister_application() {
     {
         std::lock_guard<std::mutex> its_lock(sender_mutex_);
         if (sender_) {
+            flush_batched_commands_unlocked();
             sender_->send(&its_command[0], uint32_t(its_command.size()));
         }
     }
@@ -2005,7 +2099,7 @@ void routing_manager_proxy::send_request_services(std::set<service_data_t>& _req
     {
         std::lock_guard<std::mutex> its_lock(sender_mutex_);
         if (sender_) {
-            sender_->send(&its_command[0],
+            batch_command(&its_command[0],
                     static_cast<std::uint32_t>(its_size + VSOMEIP_COMMAND_HEADER_SIZE));
         }
     }
@@ -2031,7 +2125,7 @@ void routing_manager_proxy::send_release_service(client_t _client, service_t _se
     {
         std::lock_guard<std::mutex> its_lock(sender_mutex_);
         if (sender_) {
-            sender_->send(its_command, sizeof(its_command));
+            batch_command(its_command, sizeof(its_command));
         }
     }
 }
@@ -2082,7 +2176,7 @@ void routing_manager_proxy::send_register_event(client_t _client,
     {
         std::lock_guard<std::mutex> its_lock(sender_mutex_);
         if (sender_) {
-            sender_->send(its_command, static_cast<std::uint32_t>(its_eventgroups_size));
+            batch_command(its_command, static_cast<std::uint32_t>(its_eventgroups_size));
         }
     }
 
@@ -2192,6 +2286,9 @@ void routing_manager_proxy::on_stop_offer_service(service_t _service,
 }
 
 void routing_manager_proxy::send_pending_commands() {
+    if (send_replay_state())
+        return;
+
     for (auto &po : pending_offers_)
         send_offer_service(client_,
                 po.service_, po.instance_,
@@ -2207,6 +2304,152 @@ void routing_manager_proxy::send_pending_commands() {
     send_request_services(requests_);
 }
 
+// Sends the offers, event registrations and requests of the application
+// within a single REPLAY_STATE command. Thus, the routing manager processes
+// the state of the application in one pass, which speeds up re-registering
+// after a restart of the routing manager. Subscriptions are not part of the
+// replay as they are sent when the services become available.
+// Layout of the payload:
+//   uint32 size of the offers | offers (as in OFFER_SERVICE)
+//   uint32 size of the event registrations |
+//       { uint32 size | event registration (as in REGISTER_EVENT) }
+//   requests (as in REQUEST_SERVICE)
+bool routing_manager_proxy::send_replay_state() {
+    const std::size_t its_offer_size(VSOMEIP_OFFER_SERVICE_COMMAND_SIZE
+            - VSOMEIP_COMMAND_HEADER_SIZE);
+    const std::size_t its_request_size(VSOMEIP_REQUEST_SERVICE_COMMAND_SIZE
+            - VSOMEIP_COMMAND_HEADER_SIZE);
+    const std::size_t its_event_size(VSOMEIP_REGISTER_EVENT_COMMAND_SIZE
+            - VSOMEIP_COMMAND_HEADER_SIZE);
+
+    std::size_t its_events_size(0);
+    for (const auto &per : pending_event_registrations_)
+        its_events_size += sizeof(uint32_t) + its_event_size
+            + per.eventgroups_.size() * sizeof(eventgroup_t);
+
+    const std::size_t its_size(2 * sizeof(uint32_t)
+            + pending_offers_.size() * its_offer_size
+            + its_events_size
+            + requests_.size() * its_request_size);
+    const std::uint32_t its_max_size(configuration_->get_max_message_size_local());
+    if (its_size + VSOMEIP_COMMAND_HEADER_SIZE > its_max_size
+            && VSOMEIP_MAX_LOCAL_MESSAGE_SIZE != 0) {
+        // Fall back to single commands
+        return false;
+    }
+
+    std::vector<byte_t> its_command(its_size + VSOMEIP_COMMAND_HEADER_SIZE);
+    its_command[VSOMEIP_COMMAND_TYPE_POS] = VSOMEIP_REPLAY_STATE;
+    std::memcpy(&its_command[VSOMEIP_COMMAND_CLIENT_POS], &client_,
+            sizeof(client_));
+    const uint32_t its_command_size(static_cast<uint32_t>(its_size));
+    std::memcpy(&its_command[VSOMEIP_COMMAND_SIZE_POS_MIN], &its_command_size,
+            sizeof(its_command_size));
+
+    std::size_t i = VSOMEIP_COMMAND_PAYLOAD_POS;
+    uint32_t its_section_size
+        = static_cast<uint32_t>(pending_offers_.size() * its_offer_size);
+    std::memcpy(&its_command[i], &its_section_size, sizeof(its_section_size));
+    i += sizeof(its_section_size);
+    for (const auto &po : pending_offers_) {
+        std::memcpy(&its_command[i], &po.service_, sizeof(po.service_));
+        std::memcpy(&its_command[i + 2], &po.instance_, sizeof(po.instance_));
+        its_command[i + 4] = po.major_;
+        std::memcpy(&its_command[i + 5], &po.minor_, sizeof(po.minor_));
+        i += its_offer_size;
+    }
+
+    its_section_size = static_cast<uint32_t>(its_events_size);
+    std::memcpy(&its_command[i], &its_section_size, sizeof(its_section_size));
+    i += sizeof(its_section_size);
+    for (const auto &per : pending_event_registrations_) {
+        const uint32_t its_entry_size = static_cast<uint32_t>(its_event_size
+                + per.eventgroups_.size() * sizeof(eventgroup_t));
+        std::memcpy(&its_command[i], &its_entry_size, sizeof(its_entry_size));
+        i += sizeof(its_entry_size);
+        std::memcpy(&its_command[i], &per.service_, sizeof(per.service_));
+        std::memcpy(&its_command[i + 2], &per.instance_, sizeof(per.instance_));
+        std::memcpy(&its_command[i + 4], &per.notifier_, sizeof(per.notifier_));
+        its_command[i + 6] = static_cast<byte_t>(per.type_);
+        its_command[i + 7] = static_cast<byte_t>(per.is_provided_);
+        its_command[i + 8] = static_cast<byte_t>(per.reliability_);
+        i += its_event_size;
+        for (auto eg : per.eventgroups_) {
+            std::memcpy(&its_command[i], &eg, sizeof(eventgroup_t));
+            i += sizeof(eventgroup_t);
+        }
+    }
+
+    for (const auto &its_service : requests_) {
+        std::memcpy(&its_command[i], &its_service.service_,
+                sizeof(its_service.service_));
+        std::memcpy(&its_command[i + 2], &its_service.instance_,
+                sizeof(its_service.instance_));
+        its_command[i + 4] = its_service.major_;
+        std::memcpy(&its_command[i + 5], &its_service.minor_,
+                sizeof(its_service.minor_));
+        i += its_request_size;
+    }
+
+    {
+        std::lock_guard<std::mutex> its_lock(sender_mutex_);
+        if (sender_) {
+            flush_batched_commands_unlocked();
+            sender_->send(&its_command[0],
+                    static_cast<std::uint32_t>(its_command.size()));
+        }
+    }
+    return true;
+}
+
+// Collects control commands to the routing manager. The collected commands
+// are sent within a single BATCH command when the io thread runs the next
+// time. Commands that are sent directly flush the batch before to keep the
+// order of the commands. Must be called with sender_mutex_ being locked.
+void routing_manager_proxy::batch_command(const byte_t *_data, uint32_t _size) {
+    const std::size_t its_max_size(configuration_->get_max_message_size_local());
+    if (VSOMEIP_MAX_LOCAL_MESSAGE_SIZE != 0
+            && batched_commands_.size() + _size + VSOMEIP_COMMAND_HEADER_SIZE
+                > its_max_size) {
+        flush_batched_commands_unlocked();
+    }
+
+    if (batched_commands_.empty()) {
+        io_.post(std::bind(&routing_manager_proxy::flush_batched_commands,
+                std::dynamic_pointer_cast<routing_manager_proxy>(shared_from_this())));
+    }
+    batched_commands_.insert(batched_commands_.end(), _data, _data + _size);
+}
+
+void routing_manager_proxy::flush_batched_commands() {
+    std::lock_guard<std::mutex> its_lock(sender_mutex_);
+    flush_batched_commands_unlocked();
+}
+
+void routing_manager_proxy::flush_batched_commands_unlocked() {
+    if (batched_commands_.empty() || !sender_)
+        return;
+
+    uint32_t its_size;
+    std::memcpy(&its_size, &batched_commands_[VSOMEIP_COMMAND_SIZE_POS_MIN],
+            sizeof(its_size));
+    if (its_size + VSOMEIP_COMMAND_HEADER_SIZE == batched_commands_.size()) {
+        // A single command does not need the batch
+        sender_->send(&batched_commands_[0],
+                static_cast<uint32_t>(batched_commands_.size()));
+    } else {
+        std::vector<byte_t> its_header(VSOMEIP_COMMAND_HEADER_SIZE);
+        its_header[VSOMEIP_COMMAND_TYPE_POS] = VSOMEIP_BATCH;
+        std::memcpy(&its_header[VSOMEIP_COMMAND_CLIENT_POS], &client_,
+                sizeof(client_));
+        its_size = static_cast<uint32_t>(batched_commands_.size());
+        std::memcpy(&its_header[VSOMEIP_COMMAND_SIZE_POS_MIN], &its_size,
+                sizeof(its_size));
+        sender_->send(its_header, &batched_commands_[0], its_size);
+    }
+    batched_commands_.clear();
+}
+
 void routing_manager_proxy::init_receiver() {
 #ifndef _WIN32
     auto its_security = security_impl::get();
@@ -2357,6 +2600,7 @@ void routing_manager_proxy::send_registered_ack() {
     {
         std::lock_guard<std::mutex> its_lock(sender_mutex_);
         if (sender_) {
+            flush_batched_commands_unlocked();
             sender_->send(its_command, VSOMEIP_COMMAND_HEADER_SIZE);
         }
     }
@@ -2429,6 +2673,29 @@ void routing_manager_proxy::request_debounce_timeout_cbk(
     }
 }
 
+#ifdef VSOMEIP_ENABLE_ALLOCATION_STATISTICS
+void routing_manager_proxy::start_status_log_timer() {
+    std::lock_guard<std::mutex> its_lock(status_log_timer_mutex_);
+    boost::system::error_code ec;
+    status_log_timer_.expires_from_now(std::chrono::seconds(
+            configuration_->get_log_status_interval()), ec);
+    status_log_timer_.async_wait(
+            std::bind(&routing_manager_proxy::status_log_timer_cbk,
+                    std::dynamic_pointer_cast<routing_manager_proxy>(shared_from_this()),
+                    std::placeholders::_1));
+}
+
+void routing_manager_proxy::status_log_timer_cbk(
+        boost::system::error_code const &_error) {
+    if (_error) {
+        return;
+    }
+
+    allocation_statistics::print();
+    start_status_log_timer();
+}
+#endif
+
 void routing_manager_proxy::register_client_error_handler(client_t _client,
         const std::shared_ptr<endpoint> &_endpoint) {
     _endpoint->register_error_handler(
@@ -2474,6 +2741,7 @@ void routing_manager_proxy::send_get_offered_services_info(client_t _client, off
 
     std::lock_guard<std::mutex> its_lock(sender_mutex_);
     if (sender_) {
+        flush_batched_commands_unlocked();
         sender_->send(its_command, sizeof(its_command));
     }
 }
@@ -2503,6 +2771,7 @@ void routing_manager_proxy::send_unsubscribe_ack(
     {
         std::lock_guard<std::mutex> its_lock(sender_mutex_);
         if (sender_) {
+            flush_batched_commands_unlocked();
             sender_->send(its_command, sizeof(its_command));
         }
     }
@@ -2535,6 +2804,7 @@ void routing_manager_proxy::send_resend_provided_event_response(pending_remote_o
     {
         std::lock_guard<std::mutex> its_lock(sender_mutex_);
         if (sender_) {
+            flush_batched_commands_unlocked();
             sender_->send(its_command, sizeof(its_command));
         }
     }
@@ -2556,6 +2826,7 @@ void routing_manager_proxy::send_update_security_policy_response(pending_securit
     {
         std::lock_guard<std::mutex> its_lock(sender_mutex_);
         if (sender_) {
+            flush_batched_commands_unlocked();
             sender_->send(its_command, sizeof(its_command));
         }
     }
@@ -2577,6 +2848,7 @@ void routing_manager_proxy::send_remove_security_policy_response(pending_securit
     {
         std::lock_guard<std::mutex> its_lock(sender_mutex_);
         if (sender_) {
+            flush_batched_commands_unlocked();
             sender_->send(its_command, sizeof(its_command));
         }
     }
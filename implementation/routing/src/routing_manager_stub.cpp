@@ -16,6 +16,7 @@
 #include <vsomeip/error.hpp>
 #include <vsomeip/internal/logger.hpp>
 
+#include "../include/local_commands.hpp"
 #include "../include/routing_manager_stub.hpp"
 #include "../include/routing_manager_stub_host.hpp"
 #include "../include/remote_subscription.hpp"
@@ -24,6 +25,7 @@
 
 #include "../../endpoints/include/local_server_endpoint_impl.hpp"
 #include "../../endpoints/include/endpoint_manager_impl.hpp"
+#include "../../utility/include/allocation_statistics.hpp"
 #include "../../utility/include/byteorder.hpp"
 #include "../../utility/include/utility.hpp"
 #include "../implementation/message/include/payload_impl.hpp"
@@ -161,6 +163,7 @@ void routing_manager_stub::on_message(const byte_t *_data, length_t _size,
         credentials_t _credentials,
         const boost::asio::ip::address &_remote_address,
         std::uint16_t _remote_port) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::ROUTING);
     (void)_receiver;
     (void)_destination;
     (void)_remote_address;
@@ -185,7 +188,6 @@ void routing_manager_stub::on_message(const byte_t *_data, length_t _size,
         method_t its_method;
         eventgroup_t its_eventgroup;
         event_t its_notifier;
-        event_type_e its_event_type;
         bool is_provided(false);
         major_version_t its_major;
         minor_version_t its_minor;
@@ -252,26 +254,8 @@ void routing_manager_stub::on_message(const byte_t *_data, length_t _size,
                     break;
                 }
 
-                std::memcpy(&its_service, &_data[VSOMEIP_COMMAND_PAYLOAD_POS],
-                        sizeof(its_service));
-                std::memcpy(&its_instance,
-                        &_data[VSOMEIP_COMMAND_PAYLOAD_POS + 2],
-                        sizeof(its_instance));
-                std::memcpy(&its_major, &_data[VSOMEIP_COMMAND_PAYLOAD_POS + 4],
-                        sizeof(its_major));
-                std::memcpy(&its_minor, &_data[VSOMEIP_COMMAND_PAYLOAD_POS + 5],
-                        sizeof(its_minor));
-
-                if (security::get()->is_offer_allowed(its_sender_uid, its_sender_gid,
-                        its_client, its_service, its_instance)) {
-                    host_->offer_service(its_client, its_service, its_instance,
-                            its_major, its_minor);
-                } else {
-                    VSOMEIP_WARNING << "vSomeIP Security: Client 0x" << std::hex << its_client
-                            << " : routing_manager_stub::on_message: isn't allowed to offer "
-                            << "the following service/instance " << its_service << "/" << its_instance
-                            << " ~> Skip offer!";
-                }
+                handle_offer_service(its_client, its_sender_uid, its_sender_gid,
+                        &_data[VSOMEIP_COMMAND_PAYLOAD_POS]);
                 break;
 
             case VSOMEIP_STOP_OFFER_SERVICE:
@@ -535,52 +519,9 @@ void routing_manager_stub::on_message(const byte_t *_data, length_t _size,
                 break;
             }
             case VSOMEIP_REQUEST_SERVICE:
-                {
-                    uint32_t entry_size = (sizeof(service_t) + sizeof(instance_t)
-                            + sizeof(major_version_t) + sizeof(minor_version_t));
-                    if (its_size % entry_size > 0) {
-                        VSOMEIP_WARNING << "Received a REQUEST_SERVICE command with invalid size -> skip!";
-                        break;
-                    }
-                    uint32_t request_count(its_size / entry_size);
-                    std::set<service_data_t> requests;
-                    for (uint32_t i = 0; i < request_count; ++i) {
-                        service_t its_service;
-                        instance_t its_instance;
-                        major_version_t its_major;
-                        minor_version_t its_minor;
-                        std::memcpy(&its_service, &_data[VSOMEIP_COMMAND_PAYLOAD_POS + (i * entry_size)],
-                                sizeof(its_service));
-                        std::memcpy(&its_instance,
-                                &_data[VSOMEIP_COMMAND_PAYLOAD_POS + 2 + (i * entry_size)],
-                                sizeof(its_instance));
-                        std::memcpy(&its_major, &_data[VSOMEIP_COMMAND_PAYLOAD_POS + 4 + (i * entry_size)],
-                                sizeof(its_major));
-                        std::memcpy(&its_minor, &_data[VSOMEIP_COMMAND_PAYLOAD_POS + 5 + (i * entry_size)],
-                                sizeof(its_minor));
-                        if (security::get()->is_client_allowed(its_sender_uid, its_sender_gid,
-                                its_client, its_service, its_instance, 0x00, true)) {
-                            host_->request_service(its_client, its_service, its_instance,
-                                    its_major, its_minor );
-                            service_data_t request = {
-                                    its_service, its_instance,
-                                    its_major, its_minor
-                            };
-                            requests.insert(request);
-                        } else {
-                            VSOMEIP_WARNING << "vSomeIP Security: Client 0x" << std::hex
-                                    << its_client << " : routing_manager_stub::on_message: "
-                                    << "requests service/instance "
-                                    << its_service << "/" << its_instance
-                                    << " which violates the security policy ~> Skip request!";
-                        }
-                    }
-                    if (security::get()->is_enabled()) {
-                        handle_credentials(its_client, requests);
-                    }
-                    handle_requests(its_client, requests);
-                    break;
-                }
+                handle_request_services(its_client, its_sender_uid, its_sender_gid,
+                        &_data[VSOMEIP_COMMAND_PAYLOAD_POS], its_size);
+                break;
 
                 case VSOMEIP_RELEASE_SERVICE:
                     if (_size != VSOMEIP_RELEASE_SERVICE_COMMAND_SIZE) {
@@ -596,58 +537,45 @@ void routing_manager_stub::on_message(const byte_t *_data, length_t _size,
                     host_->release_service(its_client, its_service, its_instance);
                     break;
 
-                case VSOMEIP_REGISTER_EVENT: {
+                case VSOMEIP_REGISTER_EVENT:
                     if (_size < VSOMEIP_REGISTER_EVENT_COMMAND_SIZE) {
                         VSOMEIP_WARNING << "Received a REGISTER_EVENT command with wrong size ~> skip!";
                         break;
                     }
+                    handle_register_event(its_client,
+                            &_data[VSOMEIP_COMMAND_PAYLOAD_POS], its_size);
+                    break;
 
-                    std::set<eventgroup_t> its_eventgroups;
-                    reliability_type_e its_reliability = reliability_type_e::RT_UNKNOWN;
-
-                    std::memcpy(&its_service,
-                            &_data[VSOMEIP_COMMAND_PAYLOAD_POS],
-                            sizeof(its_service));
-                    std::memcpy(&its_instance,
-                            &_data[VSOMEIP_COMMAND_PAYLOAD_POS + 2],
-                            sizeof(its_instance));
-                    std::memcpy(&its_notifier,
-                            &_data[VSOMEIP_COMMAND_PAYLOAD_POS + 4],
-                            sizeof(its_notifier));
-                    std::memcpy(&its_event_type,
-                            &_data[VSOMEIP_COMMAND_PAYLOAD_POS + 6],
-                            sizeof(its_event_type));
-                    std::memcpy(&is_provided,
-                            &_data[VSOMEIP_COMMAND_PAYLOAD_POS + 7],
-                            sizeof(is_provided));
-                    std::memcpy(&its_reliability,
-                            &_data[VSOMEIP_COMMAND_PAYLOAD_POS + 8],
-                            sizeof(its_reliability));
-                    if (is_provided
-                            && !configuration_->is_offered_remote(its_service,
-                                    its_instance)) {
-                        break;
-                    }
-                    for (std::size_t i = 9; i+1 < its_size; i++) {
-                        std::memcpy(&its_eventgroup,
-                                &_data[VSOMEIP_COMMAND_PAYLOAD_POS + i],
-                                sizeof(its_eventgroup));
-                        its_eventgroups.insert(its_eventgroup);
+                case VSOMEIP_BATCH: {
+                    // Dispatch the contained commands in order
+                    std::uint32_t its_pos(VSOMEIP_COMMAND_PAYLOAD_POS);
+                    const std::uint32_t its_end(VSOMEIP_COMMAND_PAYLOAD_POS + its_size);
+                    while (its_end - its_pos > VSOMEIP_COMMAND_SIZE_POS_MAX) {
+                        std::uint32_t its_command_size;
+                        std::memcpy(&its_command_size,
+                                &_data[its_pos + VSOMEIP_COMMAND_SIZE_POS_MIN],
+                                sizeof(its_command_size));
+                        if (_data[its_pos + VSOMEIP_COMMAND_TYPE_POS] == VSOMEIP_BATCH
+                                || its_command_size > its_end - its_pos
+                                    - VSOMEIP_COMMAND_HEADER_SIZE) {
+                            VSOMEIP_WARNING << "Received a BATCH command containing "
+                                    << "an invalid command ~> skip!";
+                            break;
+                        }
+                        its_command_size += VSOMEIP_COMMAND_HEADER_SIZE;
+                        on_message(&_data[its_pos], its_command_size, _receiver,
+                                _destination, _bound_client, _credentials,
+                                _remote_address, _remote_port);
+                        its_pos += its_command_size;
                     }
-                    host_->register_shadow_event(its_client,
-                            its_service, its_instance,
-                            its_notifier, its_eventgroups, its_event_type,
-                            its_reliability,
-                            is_provided);
-                    VSOMEIP_INFO << "REGISTER EVENT("
-                        << std::hex << std::setw(4) << std::setfill('0') << its_client << "): ["
-                        << std::hex << std::setw(4) << std::setfill('0') << its_service << "."
-                        << std::hex << std::setw(4) << std::setfill('0') << its_instance << "."
-                        << std::hex << std::setw(4) << std::setfill('0') << its_notifier
-                        << ":is_provider=" << is_provided << ":reliability="
-                        << (std::uint32_t)(its_reliability) << "]";
                     break;
                 }
+
+                case VSOMEIP_REPLAY_STATE:
+                    handle_replay_state(its_client, its_sender_uid, its_sender_gid,
+                            &_data[VSOMEIP_COMMAND_PAYLOAD_POS], its_size);
+                    break;
+
                 case VSOMEIP_UNREGISTER_EVENT:
                     if (_size != VSOMEIP_UNREGISTER_EVENT_COMMAND_SIZE) {
                         VSOMEIP_WARNING << "Received a UNREGISTER_EVENT command with wrong size ~> skip!";
@@ -782,6 +710,151 @@ void routing_manager_stub::on_message(const byte_t *_data, length_t _size,
     }
 }
 
+void routing_manager_stub::handle_offer_service(client_t _client,
+        std::uint32_t _uid, std::uint32_t _gid, const byte_t *_data) {
+    service_t its_service;
+    instance_t its_instance;
+    major_version_t its_major;
+    minor_version_t its_minor;
+
+    std::memcpy(&its_service, &_data[0], sizeof(its_service));
+    std::memcpy(&its_instance, &_data[2], sizeof(its_instance));
+    std::memcpy(&its_major, &_data[4], sizeof(its_major));
+    std::memcpy(&its_minor, &_data[5], sizeof(its_minor));
+
+    if (security::get()->is_offer_allowed(_uid, _gid,
+            _client, its_service, its_instance)) {
+        host_->offer_service(_client, its_service, its_instance,
+                its_major, its_minor);
+    } else {
+        VSOMEIP_WARNING << "vSomeIP Security: Client 0x" << std::hex << _client
+                << " : routing_manager_stub::on_message: isn't allowed to offer "
+                << "the following service/instance " << its_service << "/" << its_instance
+                << " ~> Skip offer!";
+    }
+}
+
+void routing_manager_stub::handle_request_services(client_t _client,
+        std::uint32_t _uid, std::uint32_t _gid,
+        const byte_t *_data, std::uint32_t _size) {
+    uint32_t entry_size = (sizeof(service_t) + sizeof(instance_t)
+            + sizeof(major_version_t) + sizeof(minor_version_t));
+    if (_size % entry_size > 0) {
+        VSOMEIP_WARNING << "Received a REQUEST_SERVICE command with invalid size -> skip!";
+        return;
+    }
+    uint32_t request_count(_size / entry_size);
+    std::set<service_data_t> requests;
+    for (uint32_t i = 0; i < request_count; ++i) {
+        service_t its_service;
+        instance_t its_instance;
+        major_version_t its_major;
+        minor_version_t its_minor;
+        std::memcpy(&its_service, &_data[i * entry_size],
+                sizeof(its_service));
+        std::memcpy(&its_instance, &_data[2 + (i * entry_size)],
+                sizeof(its_instance));
+        std::memcpy(&its_major, &_data[4 + (i * entry_size)],
+                sizeof(its_major));
+        std::memcpy(&its_minor, &_data[5 + (i * entry_size)],
+                sizeof(its_minor));
+        if (security::get()->is_client_allowed(_uid, _gid,
+                _client, its_service, its_instance, 0x00, true)) {
+            host_->request_service(_client, its_service, its_instance,
+                    its_major, its_minor );
+            service_data_t request = {
+                    its_service, its_instance,
+                    its_major, its_minor
+            };
+            requests.insert(request);
+        } else {
+            VSOMEIP_WARNING << "vSomeIP Security: Client 0x" << std::hex
+                    << _client << " : routing_manager_stub::on_message: "
+                    << "requests service/instance "
+                    << its_service << "/" << its_instance
+                    << " which violates the security policy ~> Skip request!";
+        }
+    }
+    if (security::get()->is_enabled()) {
+        handle_credentials(_client, requests);
+    }
+    handle_requests(_client, requests);
+}
+
+void routing_manager_stub::handle_register_event(client_t _client,
+        const byte_t *_data, std::uint32_t _size) {
+    register_event_command its_command;
+    if (!its_command.parse(_data, _size)) {
+        VSOMEIP_WARNING << "Received a REGISTER_EVENT command with wrong size ~> skip!";
+        return;
+    }
+    if (its_command.is_provided_
+            && !configuration_->is_offered_remote(its_command.service_,
+                    its_command.instance_)) {
+        return;
+    }
+    host_->register_shadow_event(_client,
+            its_command.service_, its_command.instance_,
+            its_command.notifier_, its_command.eventgroups_,
+            its_command.type_, its_command.reliability_,
+            its_command.is_provided_);
+    VSOMEIP_INFO << "REGISTER EVENT("
+        << std::hex << std::setw(4) << std::setfill('0') << _client << "): ["
+        << std::hex << std::setw(4) << std::setfill('0') << its_command.service_ << "."
+        << std::hex << std::setw(4) << std::setfill('0') << its_command.instance_ << "."
+        << std::hex << std::setw(4) << std::setfill('0') << its_command.notifier_
+        << ":is_provider=" << its_command.is_provided_ << ":reliability="
+        << (std::uint32_t)(its_command.reliability_) << "]";
+}
+
+void routing_manager_stub::handle_replay_state(client_t _client,
+        std::uint32_t _uid, std::uint32_t _gid,
+        const byte_t *_data, std::uint32_t _size) {
+    // Check the layout before anything is processed
+    replay_state_command its_command;
+    if (!its_command.parse(_data, _size)) {
+        VSOMEIP_WARNING << "Received a REPLAY_STATE command with wrong size ~> skip!";
+        return;
+    }
+
+    VSOMEIP_INFO << "REPLAY STATE("
+        << std::hex << std::setw(4) << std::setfill('0') << _client << "): "
+        << std::dec << its_command.offers_size_ / replay_state_command::offer_size
+        << " offers, "
+        << its_command.events_.size() << " events, "
+        << its_command.requests_size_
+            / (VSOMEIP_REQUEST_SERVICE_COMMAND_SIZE - VSOMEIP_COMMAND_HEADER_SIZE)
+        << " requests";
+
+    // Only a single replay at a time. The routing info that is created
+    // while the state is replayed, is collected and sent afterwards. Thus,
+    // each client receives one routing info message for the whole replay.
+    std::lock_guard<std::mutex> its_replay_lock(replay_mutex_);
+    {
+        std::lock_guard<std::mutex> its_guard(routing_info_mutex_);
+        replay_thread_ = std::this_thread::get_id();
+    }
+
+    for (std::uint32_t i = 0; i < its_command.offers_size_;
+            i += replay_state_command::offer_size)
+        handle_offer_service(_client, _uid, _gid,
+                &_data[its_command.offers_pos_ + i]);
+    for (const auto &e : its_command.events_)
+        handle_register_event(_client, &_data[e.first], e.second);
+    handle_request_services(_client, _uid, _gid,
+            &_data[its_command.requests_pos_], its_command.requests_size_);
+
+    std::lock_guard<std::mutex> its_guard(routing_info_mutex_);
+    replay_thread_ = std::thread::id();
+    for (auto &its_info : replay_routing_info_) {
+        if (its_info.second.size() > VSOMEIP_COMMAND_PAYLOAD_POS) {
+            client_routing_info_[its_info.first] = std::move(its_info.second);
+            send_client_routing_info(its_info.first);
+        }
+    }
+    replay_routing_info_.clear();
+}
+
 void routing_manager_stub::on_register_application(client_t _client) {
     auto endpoint = host_->find_local(_client);
     if (endpoint) {
@@ -978,6 +1051,13 @@ void routing_manager_stub::create_client_routing_info(const client_t _target) {
         its_command.push_back(size_placeholder);
     }
 
+    if (replay_thread_ == std::this_thread::get_id()) {
+        // Keep what was collected during the replay
+        if (replay_routing_info_.find(_target) == replay_routing_info_.end())
+            replay_routing_info_[_target] = its_command;
+        return;
+    }
+
     client_routing_info_[_target] = its_command;
 }
 
@@ -1084,6 +1164,10 @@ void routing_manager_stub::create_offered_services_info(const client_t _target)
 
 
 void routing_manager_stub::send_client_routing_info(const client_t _target) {
+    if (replay_thread_ == std::this_thread::get_id()) {
+        // Sent when the replay is finished
+        return;
+    }
     if (client_routing_info_.find(_target) == client_routing_info_.end()) {
         return;
     }
@@ -1163,13 +1247,16 @@ void routing_manager_stub::insert_client_routing_info(client_t _target,
         major_version_t _major,
         minor_version_t _minor) {
 
-    if (client_routing_info_.find(_target) == client_routing_info_.end()) {
+    auto &its_routing_info = (replay_thread_ == std::this_thread::get_id() ?
+            replay_routing_info_ : client_routing_info_);
+    auto found_target = its_routing_info.find(_target);
+    if (found_target == its_routing_info.end()) {
         return;
     }
 
     connection_matrix_[_target].insert(_client);
 
-    auto its_command = client_routing_info_[_target];
+    auto &its_command = found_target->second;
 
     // Routing Info State Change
     for (uint32_t i = 0; i < sizeof(routing_info_entry_e); ++i) {
@@ -1224,8 +1311,6 @@ void routing_manager_stub::insert_client_routing_info(client_t _target,
     // File client size
     its_entry_size = its_command.size() - its_entry_size - uint32_t(sizeof(uint32_t));
     std::memcpy(&its_command[its_size_pos], &its_entry_size, sizeof(uint32_t));
-
-    client_routing_info_[_target] = its_command;
 }
 
 void routing_manager_stub::insert_offered_services_info(client_t _target,
@@ -78,16 +78,6 @@ void serviceinfo::set_ttl(ttl_t _ttl) {
   ttl_ = std::chrono::duration_cast<std::chrono::milliseconds> (ttl);
 }
 
-std::chrono::milliseconds serviceinfo::get_precise_ttl() const {
-  std::lock_guard<std::mutex> its_lock(ttl_mutex_);
-  return ttl_;
-}
-
-void serviceinfo::set_precise_ttl(std::chrono::milliseconds _precise_ttl) {
-  std::lock_guard<std::mutex> its_lock(ttl_mutex_);
-  ttl_ = _precise_ttl;
-}
-
 std::shared_ptr<endpoint> serviceinfo::get_endpoint(bool _reliable) const {
   std::lock_guard<std::mutex> its_lock(endpoint_mutex_);
   return (_reliable ? reliable_ : unreliable_);
@@ -279,6 +279,11 @@ private:
     bool has_active_dispatcher();
     bool is_active_dispatcher(const std::thread::id &_id);
     void remove_elapsed_dispatchers();
+    bool can_invoke_inline(service_t _service, instance_t _instance);
+
+    void run_io();
+    void create_io_threads(std::size_t _count, int _nice_level);
+    bool start_caller_driven();
 
     void shutdown();
 
@@ -389,6 +394,26 @@ private:
     std::size_t max_dispatchers_;
     std::size_t max_dispatch_time_;
 
+    // Low latency: the io threads poll for the busy poll time (us) before
+    // they block and message handlers may be called on the io threads
+    std::chrono::microseconds busy_poll_time_;
+    bool has_inline_handlers_;
+    // Number of inline handler calls in progress (guarded by handlers_mutex_)
+    std::size_t running_inline_handlers_;
+    // Number of handlers taken from the queue that did not yet return
+    // (guarded by handlers_mutex_)
+    std::size_t dispatched_handlers_;
+
+    // Caller driven processing: the handlers are called by the thread that
+    // calls process. If the application uses a single internal thread, the
+    // caller drives the io service too.
+    std::atomic<bool> is_caller_driven_;
+    bool polls_io_;
+    std::size_t max_queued_handlers_;
+    // Number of messages dropped since the queue was full (guarded by
+    // handlers_mutex_)
+    std::size_t dropped_messages_;
+
     std::condition_variable stop_cv_;
     std::mutex start_stop_mutex_;
     bool stopped_;
@@ -42,6 +42,9 @@ public:
 
     void remove_application( const std::string &_name);
 
+    std::shared_ptr<payload> create_shared_payload(
+            const std::shared_ptr<byte_t> &_data, uint32_t _size) const;
+
 private:
     static std::map<std::string, std::string> properties_;
 
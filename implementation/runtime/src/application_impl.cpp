@@ -31,10 +31,12 @@
 #include "../../message/include/serializer.hpp"
 #include "../../routing/include/routing_manager_impl.hpp"
 #include "../../routing/include/routing_manager_proxy.hpp"
+#include "../../utility/include/allocation_statistics.hpp"
 #include "../../utility/include/utility.hpp"
 #include "../../tracing/include/connector_impl.hpp"
 #include "../../plugin/include/plugin_manager_impl.hpp"
 #include "../../endpoints/include/endpoint.hpp"
+#include "../../endpoints/include/io_uring_service.hpp"
 #include "../../security/include/security.hpp"
 
 namespace vsomeip_v3 {
@@ -62,6 +64,14 @@ application_impl::application_impl(const std::string &_name)
           is_dispatching_(false),
           max_dispatchers_(VSOMEIP_MAX_DISPATCHERS),
           max_dispatch_time_(VSOMEIP_MAX_DISPATCH_TIME),
+          busy_poll_time_(VSOMEIP_BUSY_POLL_TIME),
+          has_inline_handlers_(false),
+          running_inline_handlers_(0),
+          dispatched_handlers_(0),
+          is_caller_driven_(false),
+          polls_io_(false),
+          max_queued_handlers_(VSOMEIP_MAX_QUEUED_HANDLERS),
+          dropped_messages_(0),
           stopped_(false),
           block_stopping_(false),
           is_routing_manager_host_(false),
@@ -234,6 +244,16 @@ bool application_impl::init() {
         max_dispatchers_ = its_configuration->get_max_dispatchers(name_) + 1;
         max_dispatch_time_ = its_configuration->get_max_dispatch_time(name_);
 
+        busy_poll_time_ = std::chrono::microseconds(
+                its_configuration->get_busy_poll_time(name_));
+        has_inline_handlers_ = its_configuration->has_inline_handlers(name_);
+        if (busy_poll_time_.count() > 0 || has_inline_handlers_)
+            VSOMEIP_INFO << "application: " << name_
+                << " busy polls for " << std::dec << busy_poll_time_.count()
+                << "us, inline handlers: "
+                << std::boolalpha << has_inline_handlers_;
+        max_queued_handlers_ = its_configuration->get_max_queued_handlers(name_);
+
 #ifdef VSOMEIP_HAS_SESSION_HANDLING_CONFIG
         has_session_handling_ = its_configuration->has_session_handling(name_);
         if (!has_session_handling_)
@@ -241,6 +261,22 @@ bool application_impl::init() {
                 << " has session handling switched off!";
 #endif // VSOMEIP_HAS_SESSION_HANDLING_CONFIG
 
+#ifdef VSOMEIP_ENABLE_IO_URING
+        if (its_configuration->is_io_uring_enabled(name_)
+                && !boost::asio::has_service<io_uring_service>(io_)) {
+            std::unique_ptr<io_uring_service> its_io_uring(
+                    new io_uring_service(io_));
+            if (its_io_uring->init(VSOMEIP_IO_URING_ENTRIES)) {
+                boost::asio::add_service(io_, its_io_uring.release());
+                VSOMEIP_INFO << "application: " << name_
+                    << " uses io_uring for socket operations.";
+            } else {
+                VSOMEIP_WARNING << "application: " << name_
+                    << " io_uring is not available, falling back to asio.";
+            }
+        }
+#endif // VSOMEIP_ENABLE_IO_URING
+
         std::string its_routing_host = its_configuration->get_routing_host();
         if (its_routing_host != "") {
             is_routing_manager_host_ = (its_routing_host == name_);
@@ -388,6 +424,10 @@ void application_impl::start() {
         ;
 
         start_caller_id_ = std::this_thread::get_id();
+        {
+            std::lock_guard<std::mutex> its_handler_lock(handlers_mutex_);
+            dispatched_handlers_ = 0;
+        }
         {
             std::lock_guard<std::mutex> its_lock(dispatcher_mutex_);
             is_dispatching_ = true;
@@ -404,38 +444,7 @@ void application_impl::start() {
         if (routing_)
             routing_->start();
 
-        for (size_t i = 0; i < io_thread_count - 1; i++) {
-            std::shared_ptr<std::thread> its_thread
-                = std::make_shared<std::thread>([this, i, io_thread_nice_level] {
-                    VSOMEIP_INFO << "io thread id from application: "
-                            << std::hex << std::setw(4) << std::setfill('0')
-                            << client_ << " (" << name_ << ") is: " << std::hex
-                            << std::this_thread::get_id()
-                    #ifndef _WIN32
-                            << " TID: " << std::dec << static_cast<int>(syscall(SYS_gettid))
-                    #endif
-                            ;
-                    #ifndef _WIN32
-                        {
-                            std::stringstream s;
-                            s << std::hex << std::setw(4) << std::setfill('0')
-                                << client_ << "_io" << std::setw(2)
-                                << std::setfill('0') << i+1;
-                            pthread_setname_np(pthread_self(),s.str().c_str());
-                        }
-                        if ((VSOMEIP_IO_THREAD_NICE_LEVEL != io_thread_nice_level) && (io_thread_nice_level != nice(io_thread_nice_level))) {
-                            VSOMEIP_WARNING << "nice(" << io_thread_nice_level << ") failed " << errno << " for " << std::this_thread::get_id();
-                        }
-                    #endif
-                    try {
-                      io_.run();
-                    } catch (const std::exception &e) {
-                        VSOMEIP_ERROR << "application_impl::start() "
-                                "catched exception: " << e.what();
-                    }
-                  });
-            io_threads_.insert(its_thread);
-        }
+        create_io_threads(io_thread_count - 1, io_thread_nice_level);
     }
 
     auto its_plugins = configuration_->get_plugins(name_);
@@ -468,7 +477,7 @@ void application_impl::start() {
     }
 #endif
     try {
-        io_.run();
+        run_io();
 
         if (stop_thread_.joinable()) {
             stop_thread_.join();
@@ -508,6 +517,7 @@ void application_impl::stop() {
                 << std::hex << std::setw(4) << std::setfill('0') << client_ << ").";
 
     bool block = true;
+    bool is_io_thread = false;
     {
         std::lock_guard<std::mutex> its_lock_start_stop(start_stop_mutex_);
         if (stopped_ || stopped_called_) {
@@ -519,9 +529,10 @@ void application_impl::stop() {
         for (const auto& thread : io_threads_) {
             if (thread->get_id() == std::this_thread::get_id()) {
                 block = false;
+                is_io_thread = true;
             }
         }
-        if (start_caller_id_ == stop_caller_id_) {
+        if (start_caller_id_ == stop_caller_id_ || is_caller_driven_) {
             block = false;
         }
     }
@@ -544,6 +555,21 @@ void application_impl::stop() {
         stop_cv_.notify_one();
     }
 
+    // Without a thread calling start, the caller drives the io service
+    // until the routing is stopped and waits for the shutdown to complete.
+    if (is_caller_driven_ && !is_io_thread) {
+        try {
+            if (polls_io_)
+                run_io();
+
+            if (stop_thread_.joinable())
+                stop_thread_.join();
+        } catch (const std::exception &e) {
+            VSOMEIP_ERROR << "application_impl::stop() catched exception: "
+                    << e.what();
+        }
+    }
+
     if (block) {
         std::unique_lock<std::mutex> block_stop_lock(block_stop_mutex_);
         while (!block_stopping_) {
@@ -554,8 +580,86 @@ void application_impl::stop() {
 }
 
 void application_impl::process(int _number) {
-    (void)_number;
-    VSOMEIP_ERROR << "application::process is not (yet) implemented.";
+    if (!is_caller_driven_ && !start_caller_driven())
+        return;
+
+    if (polls_io_)
+        io_.poll();
+
+    int its_processed(0);
+    std::unique_lock<std::mutex> its_lock(handlers_mutex_);
+    while (is_dispatching_
+            && (_number == VSOMEIP_ALL || its_processed < _number)) {
+        std::shared_ptr<sync_handler> its_handler = get_next_handler();
+        if (!its_handler)
+            break;
+
+        its_lock.unlock();
+        try {
+            its_handler->handler_();
+        } catch (const std::exception &e) {
+            VSOMEIP_ERROR << "application_impl::process caught exception: "
+                    << e.what();
+        }
+        its_processed++;
+        its_lock.lock();
+        dispatched_handlers_--;
+
+        reschedule_availability_handler(its_handler);
+    }
+}
+
+bool application_impl::start_caller_driven() {
+    if (!is_initialized_) {
+        VSOMEIP_ERROR << "Trying to process an unintialized application.";
+        return false;
+    }
+
+    const size_t io_thread_count = configuration_->get_io_thread_count(name_);
+    const int io_thread_nice_level = configuration_->get_io_thread_nice_level(name_);
+    {
+        std::lock_guard<std::mutex> its_lock(start_stop_mutex_);
+        if (stop_thread_.joinable() || stopped_called_) {
+            VSOMEIP_ERROR << "Trying to process an already started application.";
+            return false;
+        }
+        stopped_ = false;
+        VSOMEIP_INFO << "Starting vsomeip application \"" << name_ << "\" ("
+                << std::hex << std::setw(4) << std::setfill('0') << client_
+                << ") caller driven using "  << std::dec << io_thread_count - 1
+                << " threads";
+
+        start_caller_id_ = std::this_thread::get_id();
+        polls_io_ = (io_thread_count == 1);
+        {
+            std::lock_guard<std::mutex> its_handler_lock(handlers_mutex_);
+            dispatched_handlers_ = 0;
+            is_dispatching_ = true;
+        }
+        is_caller_driven_ = true;
+
+        stop_thread_= std::thread(&application_impl::shutdown, shared_from_this());
+
+        if (routing_)
+            routing_->start();
+
+        create_io_threads(io_thread_count - 1, io_thread_nice_level);
+    }
+
+    auto its_plugins = configuration_->get_plugins(name_);
+    auto its_app_plugin_info = its_plugins.find(plugin_type_e::APPLICATION_PLUGIN);
+    if (its_app_plugin_info != its_plugins.end()) {
+        for (const auto& its_library : its_app_plugin_info->second) {
+            auto its_application_plugin = plugin_manager::get()->get_plugin(
+                    plugin_type_e::APPLICATION_PLUGIN, its_library);
+            if (its_application_plugin) {
+                std::dynamic_pointer_cast<application_plugin>(its_application_plugin)->
+                        on_application_state_change(name_, application_plugin_state_e::STATE_STARTED);
+            }
+        }
+    }
+
+    return true;
 }
 
 security_mode_e application_impl::get_security_mode() const {
@@ -819,6 +923,7 @@ bool application_impl::are_available_unlocked(available_t &_available,
 }
 
 void application_impl::send(std::shared_ptr<message> _message) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::DISPATCH, _message->get_message_type());
     bool is_request = utility::is_request(_message);
     if (client_side_logging_
         && (client_side_logging_filter_.empty()
@@ -1474,6 +1579,7 @@ void application_impl::on_availability(service_t _service, instance_t _instance,
 }
 
 void application_impl::on_message(std::shared_ptr<message> &&_message) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::DISPATCH, _message->get_message_type());
     const service_t its_service = _message->get_service();
     const instance_t its_instance = _message->get_instance();
     const method_t its_method = _message->get_method();
@@ -1489,9 +1595,9 @@ void application_impl::on_message(std::shared_ptr<message> &&_message) {
         }
     }
 
+    std::set<message_handler> its_handlers;
     {
         std::lock_guard<std::mutex> its_lock(members_mutex_);
-        std::set<message_handler> its_handlers;
         auto found_service = members_.find(its_service);
         if (found_service != members_.end()) {
             auto found_instance = found_service->second.find(its_instance);
@@ -1543,23 +1649,70 @@ void application_impl::on_message(std::shared_ptr<message> &&_message) {
             }
         }
 
-        if (its_handlers.size()) {
-            std::lock_guard<std::mutex> its_lock(handlers_mutex_);
+    }
+
+    if (its_handlers.size()) {
+        std::unique_lock<std::mutex> its_lock(handlers_mutex_);
+        if (has_inline_handlers_
+                && can_invoke_inline(its_service, its_instance)) {
+            // Nothing to keep the order with, skip the dispatcher. Until
+            // the handlers returned, other messages are queued and the
+            // dispatchers wait.
+            running_inline_handlers_++;
+            its_lock.unlock();
             for (const auto &its_handler : its_handlers) {
-                auto handler = its_handler.handler_;
-                std::shared_ptr<sync_handler> its_sync_handler =
-                        std::make_shared<sync_handler>([handler, _message]() {
-                            handler(_message);
-                        });
-                its_sync_handler->handler_type_ = handler_type_e::MESSAGE;
-                its_sync_handler->service_id_ = _message->get_service();
-                its_sync_handler->instance_id_ = _message->get_instance();
-                its_sync_handler->method_id_ = _message->get_method();
-                its_sync_handler->session_id_ = _message->get_session();
-                handlers_.push_back(its_sync_handler);
+                try {
+                    its_handler.handler_(_message);
+                } catch (const std::exception &e) {
+                    VSOMEIP_ERROR << "application_impl::on_message caught exception: "
+                            << e.what();
+                }
             }
-            dispatcher_condition_.notify_one();
+            its_lock.lock();
+            running_inline_handlers_--;
+            if (!handlers_.empty())
+                dispatcher_condition_.notify_all();
+            return;
         }
+
+        if (is_caller_driven_) {
+            // Report the first dropped message and the number of dropped
+            // messages once the queue accepts messages again
+            if (handlers_.size() >= max_queued_handlers_) {
+                if (dropped_messages_++ == 0) {
+                    VSOMEIP_WARNING << "application_impl::on_message: "
+                            << std::dec << handlers_.size()
+                            << " handlers are queued, dropping messages, first ["
+                            << std::hex << std::setfill('0')
+                            << std::setw(4) << its_service << "."
+                            << std::setw(4) << its_instance << "."
+                            << std::setw(4) << its_method
+                            << "] of application " << name_;
+                }
+                return;
+            }
+            if (dropped_messages_ > 0) {
+                VSOMEIP_WARNING << "application_impl::on_message: dropped "
+                        << std::dec << dropped_messages_
+                        << " messages of application " << name_;
+                dropped_messages_ = 0;
+            }
+        }
+
+        for (const auto &its_handler : its_handlers) {
+            auto handler = its_handler.handler_;
+            std::shared_ptr<sync_handler> its_sync_handler =
+                    std::make_shared<sync_handler>([handler, _message]() {
+                        handler(_message);
+                    });
+            its_sync_handler->handler_type_ = handler_type_e::MESSAGE;
+            its_sync_handler->service_id_ = _message->get_service();
+            its_sync_handler->instance_id_ = _message->get_instance();
+            its_sync_handler->method_id_ = _message->get_method();
+            its_sync_handler->session_id_ = _message->get_session();
+            handlers_.push_back(its_sync_handler);
+        }
+        dispatcher_condition_.notify_one();
     }
 }
 
@@ -1587,11 +1740,15 @@ void application_impl::main_dispatch() {
             ;
     std::unique_lock<std::mutex> its_lock(handlers_mutex_);
     while (is_dispatching_) {
-        if (handlers_.empty() || !is_active_dispatcher(its_id)) {
+        if (handlers_.empty() || running_inline_handlers_ > 0
+                || !is_active_dispatcher(its_id)) {
             // Cancel other waiting dispatcher
             dispatcher_condition_.notify_all();
-            // Wait for new handlers to execute
-            while (is_dispatching_ && (handlers_.empty() || !is_active_dispatcher(its_id))) {
+            // Wait for new handlers to execute and for inline handlers to
+            // return
+            while (is_dispatching_ && (handlers_.empty()
+                    || running_inline_handlers_ > 0
+                    || !is_active_dispatcher(its_id))) {
                 dispatcher_condition_.wait(its_lock);
             }
         } else {
@@ -1605,6 +1762,7 @@ void application_impl::main_dispatch() {
                     return;
 
                 its_lock.lock();
+                dispatched_handlers_--;
 
                 reschedule_availability_handler(its_handler);
                 remove_elapsed_dispatchers();
@@ -1640,7 +1798,8 @@ void application_impl::dispatch() {
             ;
     std::unique_lock<std::mutex> its_lock(handlers_mutex_);
     while (is_active_dispatcher(its_id)) {
-        if (is_dispatching_ && handlers_.empty()) {
+        if (is_dispatching_
+                && (handlers_.empty() || running_inline_handlers_ > 0)) {
              dispatcher_condition_.wait(its_lock);
              // Maybe woken up from main dispatcher
              if (handlers_.empty() && !is_active_dispatcher(its_id)) {
@@ -1662,6 +1821,7 @@ void application_impl::dispatch() {
                     return;
 
                 its_lock.lock();
+                dispatched_handlers_--;
 
                 reschedule_availability_handler(its_handler);
                 remove_elapsed_dispatchers();
@@ -1677,6 +1837,8 @@ void application_impl::dispatch() {
 
 std::shared_ptr<application_impl::sync_handler> application_impl::get_next_handler() {
     std::shared_ptr<sync_handler> its_next_handler;
+    if (running_inline_handlers_ > 0)
+        return its_next_handler;
     while (!handlers_.empty() && !its_next_handler) {
         its_next_handler = handlers_.front();
         handlers_.pop_front();
@@ -1712,6 +1874,11 @@ std::shared_ptr<application_impl::sync_handler> application_impl::get_next_handl
         }
     }
 
+    // Counted until the caller returns from the handler. Until then, no
+    // message handler must be called inline as it could overtake it.
+    if (its_next_handler)
+        dispatched_handlers_++;
+
     return its_next_handler;
 }
 
@@ -1881,6 +2048,81 @@ void application_impl::remove_elapsed_dispatchers() {
     }
 }
 
+bool application_impl::can_invoke_inline(service_t _service,
+        instance_t _instance) {
+    // Must be called with the handlers mutex being locked. Caller driven
+    // applications may only be called by the thread that calls process.
+    if (!is_dispatching_ || (is_caller_driven_ && !polls_io_)
+            || running_inline_handlers_ > 0 || dispatched_handlers_ > 0
+            || !handlers_.empty()
+            || availability_handlers_.find(std::make_pair(_service, _instance))
+                != availability_handlers_.end())
+        return false;
+
+    return true;
+}
+
+void application_impl::create_io_threads(std::size_t _count,
+        int _nice_level) {
+    // Must be called with the start/stop mutex being locked.
+    for (size_t i = 0; i < _count; i++) {
+        std::shared_ptr<std::thread> its_thread
+            = std::make_shared<std::thread>([this, i, _nice_level] {
+                VSOMEIP_INFO << "io thread id from application: "
+                        << std::hex << std::setw(4) << std::setfill('0')
+                        << client_ << " (" << name_ << ") is: " << std::hex
+                        << std::this_thread::get_id()
+                #ifndef _WIN32
+                        << " TID: " << std::dec << static_cast<int>(syscall(SYS_gettid))
+                #endif
+                        ;
+                #ifndef _WIN32
+                    {
+                        std::stringstream s;
+                        s << std::hex << std::setw(4) << std::setfill('0')
+                            << client_ << "_io" << std::setw(2)
+                            << std::setfill('0') << i+1;
+                        pthread_setname_np(pthread_self(),s.str().c_str());
+                    }
+                    if ((VSOMEIP_IO_THREAD_NICE_LEVEL != _nice_level) && (_nice_level != nice(_nice_level))) {
+                        VSOMEIP_WARNING << "nice(" << _nice_level << ") failed " << errno << " for " << std::this_thread::get_id();
+                    }
+                #endif
+                try {
+                  run_io();
+                } catch (const std::exception &e) {
+                    VSOMEIP_ERROR << "application_impl::start() "
+                            "catched exception: " << e.what();
+                }
+              });
+        io_threads_.insert(its_thread);
+    }
+}
+
+void application_impl::run_io() {
+    if (busy_poll_time_.count() == 0) {
+        io_.run();
+        return;
+    }
+
+    // Poll without blocking until nothing happened for the busy poll time.
+    // Then block until the next handler is ready and start polling again.
+    // Idle polls yield, thus the peer is not starved on a shared core.
+    auto its_last_work = std::chrono::steady_clock::now();
+    while (!io_.stopped()) {
+        if (io_.poll() > 0) {
+            its_last_work = std::chrono::steady_clock::now();
+        } else if (std::chrono::steady_clock::now() - its_last_work
+                >= busy_poll_time_) {
+            if (io_.run_one() == 0)
+                break;
+            its_last_work = std::chrono::steady_clock::now();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
 void application_impl::clear_all_handler() {
     unregister_state_handler();
     {
@@ -128,4 +128,9 @@ void runtime_impl::remove_application(
     }
 }
 
+std::shared_ptr<payload> runtime_impl::create_shared_payload(
+        const std::shared_ptr<byte_t> &_data, uint32_t _size) const {
+    return (std::make_shared<payload_impl>(_data, _size));
+}
+
 } // namespace vsomeip_v3
@@ -47,6 +47,7 @@
 #define VSOMEIP_SD_DEFAULT_REQUEST_RESPONSE_DELAY   2000
 #define VSOMEIP_SD_DEFAULT_OFFER_DEBOUNCE_TIME      500
 #define VSOMEIP_SD_DEFAULT_FIND_DEBOUNCE_TIME       500
+#define VSOMEIP_SD_DEFAULT_PROCESSING_THREADS       0
 
 
 #endif // VSOMEIP_SD_DEFINES_HPP
@@ -12,9 +12,13 @@
 #include <set>
 #include <forward_list>
 #include <atomic>
+#include <thread>
 #include <tuple>
+#include <vector>
 
+#include <boost/asio/io_service.hpp>
 #include <boost/asio/steady_timer.hpp>
+#include <boost/thread/shared_mutex.hpp>
 
 #include "../../configuration/include/configuration.hpp"
 #include "../../endpoints/include/endpoint_definition.hpp"
@@ -106,6 +110,14 @@ public:
     void register_reboot_notification_handler(
             reboot_notification_handler_t _handler);
 private:
+    void process_message(const std::shared_ptr<deserializer> &_deserializer,
+            const byte_t *_data, length_t _length,
+            const boost::asio::ip::address &_sender,
+            const boost::asio::ip::address &_destination);
+
+    void start_workers();
+    void stop_workers();
+
     std::pair<session_t, bool> get_session(const boost::asio::ip::address &_address);
     void increment_session(const boost::asio::ip::address &_address);
 
@@ -372,6 +384,25 @@ private:
 
     std::shared_ptr<serializer> serializer_;
     std::shared_ptr<deserializer> deserializer_;
+    // Serializes the processing of messages if there are no workers
+    std::mutex deserializer_mutex_;
+
+    // Workers process the messages of different remote addresses in
+    // parallel. All messages of a remote address are processed by the
+    // same worker, thus they are processed in the order of reception.
+    struct worker {
+        explicit worker(std::uint32_t _buffer_shrink_threshold)
+            : deserializer_(std::make_shared<deserializer>(
+                    _buffer_shrink_threshold)) {
+        }
+
+        boost::asio::io_service io_;
+        std::shared_ptr<boost::asio::io_service::work> work_;
+        std::shared_ptr<deserializer> deserializer_;
+        std::thread thread_;
+    };
+    std::mutex workers_mutex_;
+    std::vector<std::unique_ptr<worker> > workers_;
 
     requests_t requested_;
     std::mutex requested_mutex_;
@@ -385,6 +416,10 @@ private:
     std::mutex subscribed_mutex_;
 
     std::mutex serialize_mutex_;
+    // SD targets by remote address, dropped if the peer reboots (guarded by
+    // serialize_mutex_)
+    std::map<boost::asio::ip::address,
+        std::shared_ptr<endpoint_definition> > sd_targets_;
 
     // Sessions
     std::map<boost::asio::ip::address, std::pair<session_t, bool> > sessions_sent_;
@@ -442,7 +477,8 @@ private:
     std::string sd_multicast_;
     boost::asio::ip::address sd_multicast_address_;
 
-    boost::asio::ip::address current_remote_address_;
+    // Sender of the message that is processed by the current thread
+    static thread_local boost::asio::ip::address current_remote_address_;
 
     std::atomic<bool> is_diagnosis_;
 
@@ -467,11 +503,15 @@ private:
             std::map<std::pair<bool, std::uint16_t>,
                 std::set<std::pair<service_t, instance_t>>>> remote_offers_by_ip_;
 
+    // The messages may be processed by several worker threads, but the
+    // handlers are never called concurrently
+    std::mutex sd_handlers_mutex_;
     reboot_notification_handler_t reboot_notification_handler_;
     sd_acceptance_handler_t sd_acceptance_handler_;
 
     std::mutex offer_mutex_;
-    std::mutex check_ttl_mutex_;
+    // Shared by the message processing, exclusively locked by the TTL check
+    boost::shared_mutex check_ttl_mutex_;
 };
 
 }  // namespace sd
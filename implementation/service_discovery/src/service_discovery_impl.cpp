@@ -5,10 +5,16 @@
 
 #include <vsomeip/constants.hpp>
 
+#include <iomanip>
 #include <random>
 #include <forward_list>
+#include <sstream>
 #include <thread>
 
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
 #include <vsomeip/internal/logger.hpp>
 
 #include "../include/constants.hpp"
@@ -38,11 +44,14 @@
 #include "../../routing/include/event.hpp"
 #include "../../routing/include/eventgroupinfo.hpp"
 #include "../../routing/include/serviceinfo.hpp"
+#include "../../utility/include/allocation_statistics.hpp"
 #include "../../utility/include/byteorder.hpp"
 
 namespace vsomeip_v3 {
 namespace sd {
 
+thread_local boost::asio::ip::address service_discovery_impl::current_remote_address_;
+
 service_discovery_impl::service_discovery_impl(
         service_discovery_host *_host,
         const std::shared_ptr<configuration>& _configuration)
@@ -135,6 +144,13 @@ service_discovery_impl::init() {
     ttl_factor_subscriptions_ = configuration_->get_ttl_factor_subscribes();
     last_msg_received_timer_timeout_ = cyclic_offer_delay_
             + (cyclic_offer_delay_ / 10);
+
+    const std::uint32_t its_processing_threads
+        = configuration_->get_sd_processing_threads();
+    for (std::uint32_t i = 0; i < its_processing_threads; i++) {
+        workers_.emplace_back(new worker(
+                configuration_->get_buffer_shrink_threshold()));
+    }
 }
 
 void
@@ -154,6 +170,7 @@ service_discovery_impl::start() {
     {
         std::lock_guard<std::mutex> its_lock(serialize_mutex_);
         sessions_sent_.clear();
+        sd_targets_.clear();
     }
 
     if (is_suspended_) {
@@ -176,6 +193,7 @@ service_discovery_impl::start() {
         }
     }
     is_suspended_ = false;
+    start_workers();
     start_main_phase_timer();
     start_offer_debounce_timer(true);
     start_find_debounce_timer(true);
@@ -187,6 +205,55 @@ service_discovery_impl::stop() {
     is_suspended_ = true;
     stop_ttl_timer();
     stop_last_msg_received_timer();
+    stop_workers();
+}
+
+void
+service_discovery_impl::start_workers() {
+    std::lock_guard<std::mutex> its_lock(workers_mutex_);
+    for (std::size_t i = 0; i < workers_.size(); i++) {
+        auto &its_worker = workers_[i];
+        if (its_worker->thread_.joinable())
+            continue;
+
+        its_worker->io_.reset();
+        its_worker->work_ = std::make_shared<boost::asio::io_service::work>(
+                its_worker->io_);
+        boost::asio::io_service *its_io = &its_worker->io_;
+        its_worker->thread_ = std::thread([its_io, i] {
+#ifndef _WIN32
+            {
+                std::stringstream s;
+                s << "sd_worker" << std::dec << std::setw(2)
+                        << std::setfill('0') << i;
+                pthread_setname_np(pthread_self(), s.str().c_str());
+            }
+#endif
+            try {
+                its_io->run();
+            } catch (const std::exception &e) {
+                VSOMEIP_ERROR << "service_discovery_impl::start_workers "
+                        "catched exception: " << e.what();
+            }
+        });
+    }
+}
+
+void
+service_discovery_impl::stop_workers() {
+    std::lock_guard<std::mutex> its_lock(workers_mutex_);
+    for (auto &its_worker : workers_) {
+        if (!its_worker->thread_.joinable())
+            continue;
+
+        // Let the worker drain its queue. As SD is suspended, the queued
+        // messages are dropped.
+        its_worker->work_.reset();
+        if (its_worker->thread_.get_id() != std::this_thread::get_id())
+            its_worker->thread_.join();
+        else
+            its_worker->thread_.detach();
+    }
 }
 
 void
@@ -968,6 +1035,7 @@ service_discovery_impl::insert_subscription_ack(
 
 bool
 service_discovery_impl::send(bool _is_announcing) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::SD);
     std::shared_ptr < runtime > its_runtime = runtime_.lock();
     if (its_runtime) {
         std::vector<std::shared_ptr<message_impl> > its_messages;
@@ -994,6 +1062,7 @@ service_discovery_impl::on_message(
         const byte_t *_data, length_t _length,
         const boost::asio::ip::address &_sender,
         const boost::asio::ip::address &_destination) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::SD, _data, _length);
 #if 0
     std::stringstream msg;
     msg << "sdi::on_message: ";
@@ -1001,8 +1070,48 @@ service_discovery_impl::on_message(
     msg << std::hex << std::setw(2) << std::setfill('0') << (int)_data[i] << " ";
     VSOMEIP_INFO << msg.str();
 #endif
-    std::lock_guard<std::mutex> its_lock(check_ttl_mutex_);
-    std::lock_guard<std::mutex> its_session_lock(sessions_received_mutex_);
+    if (is_suspended_) {
+        return;
+    }
+
+    if (!workers_.empty()) {
+        std::size_t its_hash(0);
+        if (_sender.is_v4()) {
+            its_hash = static_cast<std::size_t>(_sender.to_v4().to_ulong());
+        } else {
+            for (const auto its_byte : _sender.to_v6().to_bytes())
+                its_hash = its_hash * 31 + its_byte;
+        }
+        const std::unique_ptr<worker> &its_worker
+            = workers_[its_hash % workers_.size()];
+
+        // The receive buffer is reused as soon as this method returns
+        auto its_data = std::make_shared<std::vector<byte_t> >(
+                _data, _data + _length);
+        auto its_deserializer = its_worker->deserializer_;
+        auto its_me = shared_from_this();
+        its_worker->io_.post([its_me, its_deserializer, its_data,
+                              _sender, _destination]() {
+            its_me->process_message(its_deserializer, its_data->data(),
+                    static_cast<length_t>(its_data->size()),
+                    _sender, _destination);
+        });
+    } else {
+        std::lock_guard<std::mutex> its_lock(deserializer_mutex_);
+        process_message(deserializer_, _data, _length, _sender, _destination);
+    }
+}
+
+void
+service_discovery_impl::process_message(
+        const std::shared_ptr<deserializer> &_deserializer,
+        const byte_t *_data, length_t _length,
+        const boost::asio::ip::address &_sender,
+        const boost::asio::ip::address &_destination) {
+    // Also runs on the SD worker threads, thus the scope is needed here
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::SD, _data, _length);
+    // Messages from different senders may be processed in parallel
+    boost::shared_lock<boost::shared_mutex> its_lock(check_ttl_mutex_);
 
     if(is_suspended_) {
         return;
@@ -1024,22 +1133,32 @@ service_discovery_impl::on_message(
     }
 
     current_remote_address_ = _sender;
-    deserializer_->set_data(_data, _length);
+    _deserializer->set_data(_data, _length);
     std::shared_ptr<message_impl> its_message(
-            deserializer_->deserialize_sd_message());
-    deserializer_->reset();
+            _deserializer->deserialize_sd_message());
+    _deserializer->reset();
     if (its_message) {
         // ignore all messages which are sent with invalid header fields
         if(!check_static_header_fields(its_message)) {
             return;
         }
         // Expire all subscriptions / services in case of reboot
-        if (is_reboot(_sender, _destination,
-                its_message->get_reboot_flag(), its_message->get_session())) {
+        bool is_rebooted(false);
+        {
+            std::lock_guard<std::mutex> its_session_lock(sessions_received_mutex_);
+            is_rebooted = is_reboot(_sender, _destination,
+                    its_message->get_reboot_flag(), its_message->get_session());
+        }
+        if (is_rebooted) {
             VSOMEIP_INFO << "Reboot detected: IP=" << _sender.to_string();
             remove_remote_offer_type_by_ip(_sender);
+            {
+                std::lock_guard<std::mutex> its_lock(serialize_mutex_);
+                sd_targets_.erase(_sender);
+            }
             host_->expire_subscriptions(_sender);
             host_->expire_services(_sender);
+            std::lock_guard<std::mutex> its_lock(sd_handlers_mutex_);
             if (reboot_notification_handler_) {
                 ip_address_t ip;
                 if (_sender.is_v4()) {
@@ -1078,6 +1197,7 @@ service_discovery_impl::on_message(
         for (auto iter = its_entries.begin(); iter != its_end; iter++) {
             if (!sd_acceptance_queried) {
                 sd_acceptance_queried = true;
+                std::lock_guard<std::mutex> its_lock(sd_handlers_mutex_);
                 if (sd_acceptance_handler_) {
                     accept_state.sd_acceptance_required_
                         = configuration_->is_protected_device(_sender);
@@ -2457,6 +2577,7 @@ bool service_discovery_impl::is_tcp_connected(service_t _service,
 bool
 service_discovery_impl::send(
         const std::vector<std::shared_ptr<message_impl> > &_messages) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::SD);
     bool its_result(true);
     std::lock_guard<std::mutex> its_lock(serialize_mutex_);
     for (const auto &m : _messages) {
@@ -2478,6 +2599,7 @@ bool
 service_discovery_impl::serialize_and_send(
         const std::vector<std::shared_ptr<message_impl> > &_messages,
         const boost::asio::ip::address &_address) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::SD);
     bool its_result(true);
     if (!_address.is_unspecified()) {
         std::lock_guard<std::mutex> its_lock(serialize_mutex_);
@@ -2488,8 +2610,13 @@ service_discovery_impl::serialize_and_send(
                 m->set_reboot_flag(its_session.second);
 
                 if (serializer_->serialize(m.get())) {
-                    if (host_->send_via_sd(endpoint_definition::get(_address, port_,
-                            reliable_, m->get_service(), m->get_instance()),
+                    std::shared_ptr<endpoint_definition> &its_target
+                        = sd_targets_[_address];
+                    if (!its_target) {
+                        its_target = endpoint_definition::get(_address, port_,
+                                reliable_, m->get_service(), m->get_instance());
+                    }
+                    if (host_->send_via_sd(its_target,
                             serializer_->get_data(), serializer_->get_size(),
                             port_)) {
                         increment_session(_address);
@@ -2529,7 +2656,7 @@ void
 service_discovery_impl::check_ttl(const boost::system::error_code &_error) {
     if (!_error) {
         {
-            std::lock_guard<std::mutex> its_lock(check_ttl_mutex_);
+            std::lock_guard<boost::shared_mutex> its_lock(check_ttl_mutex_);
             host_->update_routing_info(ttl_timer_runtime_);
         }
         start_ttl_timer();
@@ -2701,6 +2828,7 @@ service_discovery_impl::start_find_debounce_timer(bool _first_start) {
 void
 service_discovery_impl::on_find_debounce_timer_expired(
         const boost::system::error_code &_error) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::SD);
     if(_error) { // timer was canceled
         return;
     }
@@ -2763,6 +2891,7 @@ service_discovery_impl::on_find_debounce_timer_expired(
 void
 service_discovery_impl::on_offer_debounce_timer_expired(
         const boost::system::error_code &_error) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::SD);
     if(_error) { // timer was canceled
         return;
     }
@@ -2852,6 +2981,7 @@ service_discovery_impl::on_repetition_phase_timer_expired(
         const boost::system::error_code &_error,
         const std::shared_ptr<boost::asio::steady_timer>& _timer,
         std::uint8_t _repetition, std::uint32_t _last_delay) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::SD);
     if (_error) {
         return;
     }
@@ -3074,6 +3204,7 @@ service_discovery_impl::start_main_phase_timer() {
 void
 service_discovery_impl::on_main_phase_timer_expired(
         const boost::system::error_code &_error) {
+    VSOMEIP_ALLOCATION_SCOPE(allocation_subsystem_e::SD);
     if (_error) {
         return;
     }
@@ -3683,12 +3814,14 @@ service_discovery_impl::add_entry_data_to_remote_subscription_ack_msg(
 void
 service_discovery_impl::register_sd_acceptance_handler(
         sd_acceptance_handler_t _handler) {
+    std::lock_guard<std::mutex> its_lock(sd_handlers_mutex_);
     sd_acceptance_handler_ = _handler;
 }
 
 void
 service_discovery_impl::register_reboot_notification_handler(
             reboot_notification_handler_t _handler) {
+    std::lock_guard<std::mutex> its_lock(sd_handlers_mutex_);
     reboot_notification_handler_ = _handler;
 }
 
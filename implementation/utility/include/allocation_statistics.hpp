@@ -0,0 +1,66 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_ALLOCATION_STATISTICS_HPP_
+#define VSOMEIP_V3_ALLOCATION_STATISTICS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <vsomeip/enumeration_types.hpp>
+#include <vsomeip/primitive_types.hpp>
+
+namespace vsomeip_v3 {
+
+// Subsystems the heap allocations are accounted to.
+enum class allocation_subsystem_e : std::uint8_t {
+    OTHER = 0x0,
+    ENDPOINT = 0x1,
+    ROUTING = 0x2,
+    SD = 0x3,
+    DISPATCH = 0x4
+};
+
+// Counts the heap allocations (number and bytes) of the process per subsystem
+// and per message type. The replaced global allocation functions account each
+// allocation to the innermost scope of the allocating thread. Allocations
+// outside any scope are accounted to OTHER and to no message type.
+//
+// Only available if vsomeip was compiled with ENABLE_ALLOCATION_STATISTICS.
+// The counters are reported by the status log timer of the routing manager.
+class allocation_statistics {
+public:
+    class scope {
+    public:
+        // Keeps the message type of the enclosing scope
+        explicit scope(allocation_subsystem_e _subsystem);
+        scope(allocation_subsystem_e _subsystem, message_type_e _type);
+        // Takes the message type from the serialized message
+        scope(allocation_subsystem_e _subsystem,
+                const byte_t *_data, std::size_t _size);
+        ~scope();
+
+        scope(const scope &) = delete;
+        scope &operator=(const scope &) = delete;
+
+    private:
+        std::uint8_t previous_subsystem_;
+        std::uint8_t previous_type_;
+    };
+
+    static void record(std::size_t _size);
+    static void print();
+};
+
+} // namespace vsomeip_v3
+
+#ifdef VSOMEIP_ENABLE_ALLOCATION_STATISTICS
+#define VSOMEIP_ALLOCATION_SCOPE(...) \
+    vsomeip_v3::allocation_statistics::scope its_allocation_scope(__VA_ARGS__)
+#else
+#define VSOMEIP_ALLOCATION_SCOPE(...)
+#endif
+
+#endif // VSOMEIP_V3_ALLOCATION_STATISTICS_HPP_
@@ -0,0 +1,131 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_CLIENT_ID_POOL_HPP_
+#define VSOMEIP_V3_CLIENT_ID_POOL_HPP_
+
+#include <array>
+#include <cstdint>
+
+#ifdef _WIN32
+#include <intrin.h>
+#endif
+
+#include <vsomeip/constants.hpp>
+#include <vsomeip/primitive_types.hpp>
+
+#ifdef ANDROID
+#include "../../configuration/include/internal_android.hpp"
+#else
+#include "../../configuration/include/internal.hpp"
+#endif
+
+namespace vsomeip_v3 {
+
+// Keeps track of the client identifiers that can be assigned dynamically.
+// Each client identifier is a bit of a bitmap and a summary bitmap marks the
+// words that contain a free identifier. Thus, acquiring and releasing is
+// O(1) and finding the next free identifier checks at most one bitmap word
+// and the (16 words) summary.
+//
+// The pool is not thread safe.
+class client_id_pool {
+public:
+    client_id_pool() {
+        clear();
+    }
+
+    void clear() {
+        assignable_.fill(0);
+        free_.fill(0);
+        summary_.fill(0);
+    }
+
+    // Marks _client to be assignable and free.
+    void add(client_t _client) {
+        assignable_[_client >> 6] |= bit(_client);
+        release(_client);
+    }
+
+    void acquire(client_t _client) {
+        free_[_client >> 6] &= ~bit(_client);
+        if (!free_[_client >> 6])
+            summary_[_client >> 12] &= ~bit(client_t(_client >> 6));
+    }
+
+    // Marks _client to be free again if it is assignable.
+    void release(client_t _client) {
+        if (assignable_[_client >> 6] & bit(_client)) {
+            free_[_client >> 6] |= bit(_client);
+            summary_[_client >> 12] |= bit(client_t(_client >> 6));
+        }
+    }
+
+    // Returns the first free client identifier following _client. Searching
+    // continues at the beginning after the biggest identifier was checked
+    // and ends before _client itself.
+    client_t find(client_t _client) const {
+        std::uint32_t its_client = find_from(std::uint32_t(_client) + 1);
+        if (its_client == NOT_FOUND) {
+            its_client = find_from(0);
+            if (its_client == _client)
+                its_client = NOT_FOUND;
+        }
+        return (its_client == NOT_FOUND ?
+                VSOMEIP_CLIENT_UNSET : client_t(its_client));
+    }
+
+private:
+    static const std::uint32_t NOT_FOUND = 0xFFFFFFFF;
+    static const std::size_t WORDS = (1 << 16) / 64;
+
+    static std::uint64_t bit(client_t _client) {
+        return std::uint64_t(1) << (_client & 63);
+    }
+
+    static std::uint32_t first_bit(std::uint64_t _word) {
+#ifdef _WIN32
+        unsigned long its_index;
+        _BitScanForward64(&its_index, _word);
+        return std::uint32_t(its_index);
+#else
+        return std::uint32_t(__builtin_ctzll(_word));
+#endif
+    }
+
+    // Returns the first free client identifier that is not smaller than _client.
+    std::uint32_t find_from(std::uint32_t _client) const {
+        std::uint32_t its_word = (_client >> 6);
+        if (its_word >= WORDS)
+            return NOT_FOUND;
+
+        const std::uint64_t its_bits
+            = free_[its_word] & (~std::uint64_t(0) << (_client & 63));
+        if (its_bits)
+            return (its_word << 6) + first_bit(its_bits);
+
+        // Continue with the next word that contains a free identifier
+        if (++its_word >= WORDS)
+            return NOT_FOUND;
+        std::uint32_t its_summary_word = (its_word >> 6);
+        std::uint64_t its_summary_bits
+            = summary_[its_summary_word] & (~std::uint64_t(0) << (its_word & 63));
+        while (!its_summary_bits) {
+            if (++its_summary_word >= summary_.size())
+                return NOT_FOUND;
+            its_summary_bits = summary_[its_summary_word];
+        }
+        its_word = (its_summary_word << 6) + first_bit(its_summary_bits);
+        return (its_word << 6) + first_bit(free_[its_word]);
+    }
+
+    std::array<std::uint64_t, WORDS> assignable_;
+    std::array<std::uint64_t, WORDS> free_;
+    std::array<std::uint64_t, WORDS / 64> summary_;
+};
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_CLIENT_ID_POOL_HPP_
@@ -23,6 +23,7 @@
 
 namespace vsomeip_v3 {
 
+class client_id_pool;
 class configuration;
 
 class utility {
@@ -140,6 +141,7 @@ private:
     static std::mutex mutex__;
     static client_t next_client__;
     static std::map<client_t, std::string> used_clients__;
+    static client_id_pool free_clients__;
 #ifdef _WIN32
     static HANDLE lock_handle__;
 #else
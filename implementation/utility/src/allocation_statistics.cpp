@@ -0,0 +1,184 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifdef VSOMEIP_ENABLE_ALLOCATION_STATISTICS
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <sstream>
+
+#include <vsomeip/defines.hpp>
+#include <vsomeip/internal/logger.hpp>
+
+#include "../include/allocation_statistics.hpp"
+#include "../../endpoints/include/tp.hpp"
+
+namespace vsomeip_v3 {
+
+namespace {
+
+const std::size_t SUBSYSTEMS = 5;
+const char *SUBSYSTEM_NAMES[SUBSYSTEMS] = {
+    "other", "endpoint", "routing", "sd", "dispatch"
+};
+
+// The first entry counts the allocations that are not related to a message
+const std::size_t TYPES = 7;
+const char *TYPE_NAMES[TYPES] = {
+    "none", "request", "request_no_return", "notification",
+    "response", "error", "unknown"
+};
+const std::uint8_t TYPE_NONE = 0;
+const std::uint8_t TYPE_UNKNOWN = 6;
+
+// Zero initialized before any dynamic initialization takes place. Thus, the
+// counters can be used by allocations of static initializers.
+std::atomic<std::uint64_t> allocations__[SUBSYSTEMS][TYPES];
+std::atomic<std::uint64_t> allocated_bytes__[SUBSYSTEMS][TYPES];
+
+thread_local std::uint8_t current_subsystem__(0);
+thread_local std::uint8_t current_type__(TYPE_NONE);
+
+std::uint8_t get_type_index(message_type_e _type) {
+    switch (tp::tp::tp_flag_unset(static_cast<std::uint8_t>(_type))) {
+        case message_type_e::MT_REQUEST:
+            return 1;
+        case message_type_e::MT_REQUEST_NO_RETURN:
+            return 2;
+        case message_type_e::MT_NOTIFICATION:
+            return 3;
+        case message_type_e::MT_RESPONSE:
+            return 4;
+        case message_type_e::MT_ERROR:
+            return 5;
+        default:
+            return TYPE_UNKNOWN;
+    }
+}
+
+} // namespace
+
+allocation_statistics::scope::scope(allocation_subsystem_e _subsystem)
+    : previous_subsystem_(current_subsystem__),
+      previous_type_(current_type__) {
+    current_subsystem__ = static_cast<std::uint8_t>(_subsystem);
+}
+
+allocation_statistics::scope::scope(allocation_subsystem_e _subsystem,
+        message_type_e _type)
+    : previous_subsystem_(current_subsystem__),
+      previous_type_(current_type__) {
+    current_subsystem__ = static_cast<std::uint8_t>(_subsystem);
+    current_type__ = get_type_index(_type);
+}
+
+allocation_statistics::scope::scope(allocation_subsystem_e _subsystem,
+        const byte_t *_data, std::size_t _size)
+    : previous_subsystem_(current_subsystem__),
+      previous_type_(current_type__) {
+    current_subsystem__ = static_cast<std::uint8_t>(_subsystem);
+    current_type__ = (_size > VSOMEIP_MESSAGE_TYPE_POS ?
+            get_type_index(static_cast<message_type_e>(_data[VSOMEIP_MESSAGE_TYPE_POS]))
+            : TYPE_UNKNOWN);
+}
+
+allocation_statistics::scope::~scope() {
+    current_subsystem__ = previous_subsystem_;
+    current_type__ = previous_type_;
+}
+
+void allocation_statistics::record(std::size_t _size) {
+    allocations__[current_subsystem__][current_type__].fetch_add(1,
+            std::memory_order_relaxed);
+    allocated_bytes__[current_subsystem__][current_type__].fetch_add(_size,
+            std::memory_order_relaxed);
+}
+
+void allocation_statistics::print() {
+    std::uint64_t its_subsystem_allocations[SUBSYSTEMS] = { 0 };
+    std::uint64_t its_subsystem_bytes[SUBSYSTEMS] = { 0 };
+    std::uint64_t its_type_allocations[TYPES] = { 0 };
+    std::uint64_t its_type_bytes[TYPES] = { 0 };
+    for (std::size_t s = 0; s < SUBSYSTEMS; s++) {
+        for (std::size_t t = 0; t < TYPES; t++) {
+            const std::uint64_t its_allocations
+                = allocations__[s][t].load(std::memory_order_relaxed);
+            const std::uint64_t its_bytes
+                = allocated_bytes__[s][t].load(std::memory_order_relaxed);
+            its_subsystem_allocations[s] += its_allocations;
+            its_subsystem_bytes[s] += its_bytes;
+            its_type_allocations[t] += its_allocations;
+            its_type_bytes[t] += its_bytes;
+        }
+    }
+
+    std::stringstream its_subsystems;
+    for (std::size_t s = 0; s < SUBSYSTEMS; s++) {
+        its_subsystems << SUBSYSTEM_NAMES[s] << ": " << std::dec
+                << its_subsystem_allocations[s] << " ("
+                << its_subsystem_bytes[s] << " bytes) ";
+    }
+    std::stringstream its_types;
+    for (std::size_t t = 0; t < TYPES; t++) {
+        its_types << TYPE_NAMES[t] << ": " << std::dec
+                << its_type_allocations[t] << " ("
+                << its_type_bytes[t] << " bytes) ";
+    }
+    VSOMEIP_INFO << "Allocations per subsystem: " << its_subsystems.str();
+    VSOMEIP_INFO << "Allocations per message type: " << its_types.str();
+}
+
+} // namespace vsomeip_v3
+
+// The replaced allocation functions are exported (see exportmap.gcc) and
+// therefore count all allocations of the process, unless the executable
+// replaces them itself.
+void *operator new(std::size_t _size) {
+    vsomeip_v3::allocation_statistics::record(_size);
+    void *its_pointer = std::malloc(_size ? _size : 1);
+    if (!its_pointer)
+        throw std::bad_alloc();
+    return its_pointer;
+}
+
+void *operator new[](std::size_t _size) {
+    return ::operator new(_size);
+}
+
+void *operator new(std::size_t _size, const std::nothrow_t &) noexcept {
+    vsomeip_v3::allocation_statistics::record(_size);
+    return std::malloc(_size ? _size : 1);
+}
+
+void *operator new[](std::size_t _size, const std::nothrow_t &_tag) noexcept {
+    return ::operator new(_size, _tag);
+}
+
+void operator delete(void *_pointer) noexcept {
+    std::free(_pointer);
+}
+
+void operator delete[](void *_pointer) noexcept {
+    std::free(_pointer);
+}
+
+void operator delete(void *_pointer, std::size_t) noexcept {
+    std::free(_pointer);
+}
+
+void operator delete[](void *_pointer, std::size_t) noexcept {
+    std::free(_pointer);
+}
+
+void operator delete(void *_pointer, const std::nothrow_t &) noexcept {
+    std::free(_pointer);
+}
+
+void operator delete[](void *_pointer, const std::nothrow_t &) noexcept {
+    std::free(_pointer);
+}
+
+#endif // VSOMEIP_ENABLE_ALLOCATION_STATISTICS
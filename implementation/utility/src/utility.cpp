@@ -26,6 +26,7 @@
 #include <vsomeip/internal/logger.hpp>
 
 #include "../include/byteorder.hpp"
+#include "../include/client_id_pool.hpp"
 #include "../include/utility.hpp"
 #include "../../configuration/include/configuration.hpp"
 
@@ -34,6 +35,7 @@ namespace vsomeip_v3 {
 std::mutex utility::mutex__;
 client_t utility::next_client__(VSOMEIP_CLIENT_UNSET);
 std::map<client_t, std::string> utility::used_clients__;
+client_id_pool utility::free_clients__;
 #ifdef _WIN32
 HANDLE utility::lock_handle__(INVALID_HANDLE_VALUE);
 #else
@@ -234,12 +236,29 @@ utility::request_client_id(
 
     if (next_client__ == VSOMEIP_CLIENT_UNSET) {
         next_client__ = its_smallest_client;
+
+        // Collect the client identifiers that can be assigned dynamically
+        // (all identifiers that match the diagnosis address)
+        free_clients__.clear();
+        client_t its_client(its_smallest_client);
+        for (std::uint32_t i = 0; i <= its_max_num_clients; i++) {
+            if (!_config->is_configured_client_id(its_client)
+                    && used_clients__.find(its_client) == used_clients__.end()) {
+                free_clients__.add(its_client);
+            }
+            its_client = static_cast<client_t>(
+                    (its_client & static_cast<std::uint16_t>(~its_client_mask)) // save diagnosis address bits
+                    | (static_cast<std::uint16_t>((its_client // set all diagnosis address bits to one
+                            | static_cast<std::uint16_t>(~its_client_mask)) + 1u) //  and add one to the result
+                                    & its_client_mask)); // set the diagnosis address bits to zero again
+        }
     }
 
     if (_client != VSOMEIP_CLIENT_UNSET) { // predefined client identifier
         const auto its_iterator = used_clients__.find(_client);
         if (its_iterator == used_clients__.end()) { // unused identifier
             used_clients__[_client] = _name;
+            free_clients__.acquire(_client);
             return _client;
         } else { // already in use
 
@@ -263,30 +282,26 @@ utility::request_client_id(
         // start at beginning of client range again when the biggest client was reached
         next_client__ = its_smallest_client;
     }
-    std::uint16_t increase_count = 0;
-    do {
-        next_client__ = (next_client__ & static_cast<std::uint16_t>(~its_client_mask)) // save diagnosis address bits
-                | (static_cast<std::uint16_t>((next_client__ // set all diagnosis address bits to one
-                        | static_cast<std::uint16_t>(~its_client_mask)) + 1u) //  and add one to the result
-                                & its_client_mask); // set the diagnosis address bits to zero again
-        if (increase_count++ == its_max_num_clients) {
-            VSOMEIP_ERROR << __func__ << " no free client IDs left! "
-                    "Max amount of possible concurrent active vsomeip "
-                    "applications reached ("  << std::dec << used_clients__.size()
-                    << ").";
-            return VSOMEIP_CLIENT_UNSET;
-        }
-    } while (used_clients__.find(next_client__) != used_clients__.end()
-            || _config->is_configured_client_id(next_client__));
+    const client_t its_client = free_clients__.find(next_client__);
+    if (its_client == VSOMEIP_CLIENT_UNSET) {
+        VSOMEIP_ERROR << __func__ << " no free client IDs left! "
+                "Max amount of possible concurrent active vsomeip "
+                "applications reached ("  << std::dec << used_clients__.size()
+                << ").";
+        return VSOMEIP_CLIENT_UNSET;
+    }
 
-    used_clients__[next_client__] = _name;
-    return next_client__;
+    next_client__ = its_client;
+    free_clients__.acquire(its_client);
+    used_clients__[its_client] = _name;
+    return its_client;
 }
 
 void
 utility::release_client_id(client_t _client) {
     std::lock_guard<std::mutex> its_lock(mutex__);
-    used_clients__.erase(_client);
+    if (used_clients__.erase(_client))
+        free_clients__.release(_client);
 }
 
 std::set<client_t>
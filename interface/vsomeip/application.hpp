@@ -129,7 +129,13 @@ public:
      * \brief Process messages / events.
      *
      * This methods controls the message / event processing from an application
-     * context. You must not call start / stop if you use this method.
+     * context. The first call starts the application without dispatcher
+     * threads. Afterwards, each call invokes the queued handlers on the
+     * calling thread. If the application is configured to use a single
+     * thread, the calling thread also receives the messages / events, thus
+     * the application does not create any internal thread to process them.
+     * You must not call start if you use this method. A call to stop shuts
+     * the application down and returns once it is deregistered.
      *
      * \param _number Number of events/messages that will be processed at
      * maximum before returning.
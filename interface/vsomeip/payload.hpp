@@ -43,6 +43,9 @@ public:
 
     /**
      * \brief Returns pointer to the payload content
+     *
+     * The content of a shared payload (see runtime::create_shared_payload)
+     * is copied before the pointer is returned.
      */
     VSOMEIP_EXPORT virtual byte_t * get_data() = 0;
 
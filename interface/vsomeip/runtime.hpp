@@ -207,6 +207,24 @@ public:
      *
      */
     virtual void remove_application( const std::string &_name) = 0;
+
+    /**
+     *
+     * \brief Creates a payload object that refers to the given buffer
+     * instead of copying it.
+     *
+     * The payload shares ownership of the buffer. Use a custom deleter
+     * to release application owned memory once the last reference is
+     * gone. The buffer must not be modified after creating the payload.
+     * Setting new data on the payload or accessing its data for writing
+     * (non-const get_data) replaces the reference by an own copy.
+     *
+     * \param _data Buffer to be referred to by the payload object.
+     * \param _size Number of bytes within the buffer.
+     *
+     */
+    virtual std::shared_ptr<payload> create_shared_payload(
+            const std::shared_ptr<byte_t> &_data, uint32_t _size) const = 0;
 };
 
 /** @} */
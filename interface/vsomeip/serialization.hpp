@@ -0,0 +1,875 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef VSOMEIP_V3_SERIALIZATION_HPP_
+#define VSOMEIP_V3_SERIALIZATION_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <vsomeip/payload.hpp>
+#include <vsomeip/primitive_types.hpp>
+
+/**
+ *
+ * \defgroup vsomeip
+ *
+ * @{
+ *
+ */
+
+/**
+ * \brief Declares a data member of a struct for use in a
+ * vsomeip_v3::serialization::fields list.
+ */
+#define VSOMEIP_SERIALIZATION_FIELD(struct_type, member) \
+    ::vsomeip_v3::serialization::field<struct_type, \
+        decltype(struct_type::member), &struct_type::member>
+
+namespace vsomeip_v3 {
+
+/**
+ *
+ * \brief Typed (de)serialization of application data according to the
+ * SOME/IP serialization rules.
+ *
+ * Supported data types are
+ * - the basic types (integers, enumerations, bool, float and double),
+ * - fixed length arrays (std::array),
+ * - dynamic length arrays (std::vector, dynamic_array),
+ * - UTF-8 strings with byte order mark (std::string, dynamic_string),
+ * - structs that are described by a specialization of struct_layout and
+ * - unions (union_type).
+ *
+ * Structs are described once by listing their members:
+ *
+ * \code
+ * struct position { std::int32_t x_; std::int32_t y_; std::string name_; };
+ *
+ * namespace vsomeip_v3 { namespace serialization {
+ * template<> struct struct_layout<position> {
+ *     typedef fields<
+ *         VSOMEIP_SERIALIZATION_FIELD(position, x_),
+ *         VSOMEIP_SERIALIZATION_FIELD(position, y_),
+ *         VSOMEIP_SERIALIZATION_FIELD(position, name_)
+ *     > type;
+ * };
+ * } }
+ * \endcode
+ *
+ * As the layout is known at compile time, encoding and decoding boil down
+ * to a sequence of big endian stores/loads into/from a buffer that was
+ * allocated once. Data types without dynamic parts are bounds checked once
+ * as a whole while decoding.
+ *
+ * Dynamic arrays and strings are preceded by a 32 bit length field. Use
+ * dynamic_array and dynamic_string to select a length field of 8 or 16 bit.
+ * Structs get a length field if their struct_layout specialization defines
+ * a "static const std::size_t length_width" of 1, 2 or 4.
+ *
+ */
+namespace serialization {
+
+/**
+ * \brief Describes the layout of a struct. Must be specialized for each
+ * struct that shall be (de)serialized and define a "type" that is a
+ * fields list.
+ */
+template<typename T>
+struct struct_layout;
+
+/**
+ * \brief Describes how values of type T are (de)serialized.
+ *
+ * Each specialization provides
+ * - is_fixed / fixed_size: whether and how many bytes the type needs
+ *   independent of its value,
+ * - size(): the number of bytes needed to serialize a value,
+ * - encode(): writes a value to a buffer of sufficient size and returns
+ *   the position behind it or nullptr if the value cannot be serialized,
+ * - decode(): reads a value from a buffer and advances the position and
+ * - load() (fixed size types only): reads a value without bounds checks.
+ */
+template<typename T, typename Enable = void>
+struct traits;
+
+/**
+ * \brief Dynamic length array with a length field of LengthWidth bytes.
+ */
+template<typename T, std::size_t LengthWidth = 4>
+class dynamic_array : public std::vector<T> {
+public:
+    using std::vector<T>::vector;
+    dynamic_array() = default;
+};
+
+/**
+ * \brief UTF-8 string with a length field of LengthWidth bytes.
+ */
+template<std::size_t LengthWidth = 4>
+class dynamic_string : public std::string {
+public:
+    using std::string::string;
+    dynamic_string() = default;
+};
+
+namespace detail {
+
+template<typename... Ts>
+struct make_void {
+    typedef void type;
+};
+
+template<typename T>
+struct unsigned_of {
+    typedef typename std::make_unsigned<T>::type type;
+};
+
+template<>
+struct unsigned_of<float> {
+    typedef std::uint32_t type;
+};
+
+template<>
+struct unsigned_of<double> {
+    typedef std::uint64_t type;
+};
+
+template<typename U>
+inline byte_t *store(U _value, byte_t *_data) {
+    for (std::size_t i = sizeof(U); i > 0; --i) {
+        _data[i - 1] = static_cast<byte_t>(_value & 0xFF);
+        _value = static_cast<U>(_value >> 8);
+    }
+    return _data + sizeof(U);
+}
+
+template<typename U>
+inline U load(const byte_t *_data) {
+    U its_value(0);
+    for (std::size_t i = 0; i < sizeof(U); ++i) {
+        its_value = static_cast<U>((its_value << 8) | _data[i]);
+    }
+    return its_value;
+}
+
+inline bool is_available(const byte_t *_it, const byte_t *_end,
+        std::size_t _size) {
+    return (static_cast<std::size_t>(_end - _it) >= _size);
+}
+
+template<std::size_t Width>
+struct length_field {
+    static_assert(Width == 0 || Width == 1 || Width == 2 || Width == 4,
+            "SOME/IP length fields have 0, 8, 16 or 32 bit.");
+
+    typedef typename std::conditional<Width == 1, std::uint8_t,
+            typename std::conditional<Width == 2, std::uint16_t,
+                std::uint32_t>::type>::type value_type;
+
+    // Writes the length of the data between _begin and _end to the
+    // length field at _begin - Width.
+    static bool finish(byte_t *_begin, const byte_t *_end) {
+        const std::size_t its_length(static_cast<std::size_t>(_end - _begin));
+        if (its_length > std::numeric_limits<value_type>::max())
+            return false;
+        store(static_cast<value_type>(its_length), _begin - Width);
+        return true;
+    }
+
+    static bool decode(std::size_t &_length,
+            const byte_t *&_it, const byte_t *_end) {
+        if (!is_available(_it, _end, Width))
+            return false;
+        _length = load<value_type>(_it);
+        _it += Width;
+        return is_available(_it, _end, _length);
+    }
+};
+
+template<>
+struct length_field<0> {
+    static bool finish(byte_t *, const byte_t *) { return true; }
+};
+
+template<typename T, typename = void>
+struct struct_length_width
+    : std::integral_constant<std::size_t, 0> {};
+
+template<typename T>
+struct struct_length_width<T,
+        typename make_void<decltype(struct_layout<T>::length_width)>::type>
+    : std::integral_constant<std::size_t, struct_layout<T>::length_width> {};
+
+template<typename Container, std::size_t LengthWidth>
+struct dynamic_array_traits {
+    typedef typename Container::value_type element_type;
+    typedef traits<element_type> element_traits;
+
+    static_assert(!std::is_same<element_type, bool>::value,
+            "Use a dynamic array of std::uint8_t to transport booleans.");
+
+    static const bool is_fixed = false;
+    static const std::size_t fixed_size = 0;
+
+    static std::size_t size(const Container &_value) {
+        if (element_traits::is_fixed)
+            return LengthWidth + _value.size() * element_traits::fixed_size;
+
+        std::size_t its_size(LengthWidth);
+        for (const auto &e : _value)
+            its_size += element_traits::size(e);
+        return its_size;
+    }
+
+    static byte_t *encode(const Container &_value, byte_t *_data) {
+        byte_t *its_begin = _data + LengthWidth;
+        byte_t *its_end = encode_elements(_value, its_begin, is_byte());
+        return (its_end && length_field<LengthWidth>::finish(its_begin, its_end) ?
+                its_end : nullptr);
+    }
+
+    static bool decode(Container &_value,
+            const byte_t *&_it, const byte_t *_end) {
+        std::size_t its_length;
+        if (!length_field<LengthWidth>::decode(its_length, _it, _end))
+            return false;
+
+        return decode_elements(_value, its_length, _it,
+                std::integral_constant<bool, element_traits::is_fixed>());
+    }
+
+private:
+    // Arrays of single byte elements are copied as a whole
+    typedef std::integral_constant<bool, std::is_integral<element_type>::value
+            && sizeof(element_type) == 1> is_byte;
+
+    static byte_t *encode_elements(const Container &_value, byte_t *_data,
+            std::true_type) {
+        if (!_value.empty())
+            std::memcpy(_data, _value.data(), _value.size());
+        return _data + _value.size();
+    }
+
+    static byte_t *encode_elements(const Container &_value, byte_t *_data,
+            std::false_type) {
+        for (const auto &e : _value) {
+            _data = element_traits::encode(e, _data);
+            if (!_data)
+                return nullptr;
+        }
+        return _data;
+    }
+
+    // The length field of an array of fixed size elements determines the
+    // number of elements, which are then loaded without further checks.
+    static bool decode_elements(Container &_value, std::size_t _length,
+            const byte_t *&_it, std::true_type) {
+        const std::size_t its_element_size(element_traits::fixed_size);
+        if (its_element_size == 0 || _length % its_element_size != 0)
+            return false;
+
+        _value.resize(_length / its_element_size);
+        load_elements(_value, _it, is_byte());
+        _it += _length;
+        return true;
+    }
+
+    static void load_elements(Container &_value, const byte_t *_data,
+            std::true_type) {
+        if (!_value.empty())
+            std::memcpy(_value.data(), _data, _value.size());
+    }
+
+    static void load_elements(Container &_value, const byte_t *_data,
+            std::false_type) {
+        for (auto &e : _value) {
+            element_traits::load(e, _data);
+            _data += element_traits::fixed_size;
+        }
+    }
+
+    static bool decode_elements(Container &_value, std::size_t _length,
+            const byte_t *&_it, std::false_type) {
+        const byte_t *its_end = _it + _length;
+        _value.clear();
+        while (_it < its_end) {
+            element_type its_element;
+            if (!element_traits::decode(its_element, _it, its_end))
+                return false;
+            _value.push_back(std::move(its_element));
+        }
+        return true;
+    }
+};
+
+template<typename String, std::size_t LengthWidth>
+struct dynamic_string_traits {
+    static const bool is_fixed = false;
+    static const std::size_t fixed_size = 0;
+
+    // Byte order mark + terminating zero
+    static const std::size_t overhead = 4;
+
+    static std::size_t size(const String &_value) {
+        return LengthWidth + overhead + _value.size();
+    }
+
+    static byte_t *encode(const String &_value, byte_t *_data) {
+        byte_t *its_begin = _data + LengthWidth;
+        its_begin[0] = 0xEF;
+        its_begin[1] = 0xBB;
+        its_begin[2] = 0xBF;
+        if (!_value.empty())
+            std::memcpy(&its_begin[3], _value.data(), _value.size());
+        byte_t *its_end = its_begin + 3 + _value.size();
+        *its_end++ = 0x00;
+        return (length_field<LengthWidth>::finish(its_begin, its_end) ?
+                its_end : nullptr);
+    }
+
+    static bool decode(String &_value,
+            const byte_t *&_it, const byte_t *_end) {
+        std::size_t its_length;
+        if (!length_field<LengthWidth>::decode(its_length, _it, _end)
+                || its_length < overhead
+                || _it[0] != 0xEF || _it[1] != 0xBB || _it[2] != 0xBF
+                || _it[its_length - 1] != 0x00)
+            return false;
+
+        _value.assign(reinterpret_cast<const char *>(&_it[3]),
+                its_length - overhead);
+        _it += its_length;
+        return true;
+    }
+};
+
+} // namespace detail
+
+/**
+ * \brief Describes a data member of struct S (see
+ * VSOMEIP_SERIALIZATION_FIELD).
+ */
+template<typename S, typename M, M S::*Member>
+struct field {
+    typedef M value_type;
+
+    static const M &get(const S &_struct) { return _struct.*Member; }
+    static M &get(S &_struct) { return _struct.*Member; }
+};
+
+/**
+ * \brief Ordered list of the members of a struct.
+ */
+template<typename... Fields>
+struct fields;
+
+template<>
+struct fields<> {
+    static const bool is_fixed = true;
+    static const std::size_t fixed_size = 0;
+
+    template<typename S>
+    static std::size_t size(const S &) { return 0; }
+
+    template<typename S>
+    static byte_t *encode(const S &, byte_t *_data) { return _data; }
+
+    template<typename S>
+    static void load(S &, const byte_t *) {}
+
+    template<typename S>
+    static bool decode(S &, const byte_t *&, const byte_t *) { return true; }
+};
+
+template<typename Field, typename... Fields>
+struct fields<Field, Fields...> {
+    typedef traits<typename Field::value_type> head;
+    typedef fields<Fields...> tail;
+
+    static const bool is_fixed = head::is_fixed && tail::is_fixed;
+    static const std::size_t fixed_size
+        = (is_fixed ? head::fixed_size + tail::fixed_size : 0);
+
+    template<typename S>
+    static std::size_t size(const S &_struct) {
+        return head::size(Field::get(_struct)) + tail::size(_struct);
+    }
+
+    template<typename S>
+    static byte_t *encode(const S &_struct, byte_t *_data) {
+        _data = head::encode(Field::get(_struct), _data);
+        return (_data ? tail::encode(_struct, _data) : nullptr);
+    }
+
+    template<typename S>
+    static void load(S &_struct, const byte_t *_data) {
+        head::load(Field::get(_struct), _data);
+        tail::load(_struct, _data + head::fixed_size);
+    }
+
+    template<typename S>
+    static bool decode(S &_struct, const byte_t *&_it, const byte_t *_end) {
+        return head::decode(Field::get(_struct), _it, _end)
+                && tail::decode(_struct, _it, _end);
+    }
+};
+
+/**
+ * \brief SOME/IP union (variant). Alternatives are addressed by their
+ * type selector as transmitted, i.e. 1 for the first alternative. A
+ * selector of 0 denotes an empty union.
+ */
+template<typename... Ts>
+class union_type {
+public:
+    static const std::uint32_t size = sizeof...(Ts);
+
+    template<std::uint32_t Selector>
+    using alternative_type = typename std::tuple_element<Selector - 1,
+            std::tuple<Ts...>>::type;
+
+    union_type() : selector_(0) {}
+
+    std::uint32_t get_selector() const { return selector_; }
+
+    template<std::uint32_t Selector>
+    const alternative_type<Selector> &get() const {
+        return std::get<Selector - 1>(values_);
+    }
+
+    template<std::uint32_t Selector>
+    alternative_type<Selector> &get() {
+        return std::get<Selector - 1>(values_);
+    }
+
+    template<std::uint32_t Selector>
+    void set(const alternative_type<Selector> &_value) {
+        std::get<Selector - 1>(values_) = _value;
+        selector_ = Selector;
+    }
+
+    // Sets the selector without touching the value; used while decoding.
+    template<std::uint32_t Selector>
+    alternative_type<Selector> &emplace() {
+        selector_ = Selector;
+        return std::get<Selector - 1>(values_);
+    }
+
+    void reset() { selector_ = 0; }
+
+private:
+    std::uint32_t selector_;
+    std::tuple<Ts...> values_;
+};
+
+// Basic types
+
+template<typename T>
+struct traits<T, typename std::enable_if<
+        std::is_integral<T>::value || std::is_floating_point<T>::value>::type> {
+    typedef typename detail::unsigned_of<T>::type wire_type;
+
+    static const bool is_fixed = true;
+    static const std::size_t fixed_size = sizeof(T);
+
+    static std::size_t size(const T &) { return sizeof(T); }
+
+    static byte_t *encode(const T &_value, byte_t *_data) {
+        wire_type its_value;
+        std::memcpy(&its_value, &_value, sizeof(T));
+        return detail::store(its_value, _data);
+    }
+
+    static void load(T &_value, const byte_t *_data) {
+        const wire_type its_value(detail::load<wire_type>(_data));
+        std::memcpy(&_value, &its_value, sizeof(T));
+    }
+
+    static bool decode(T &_value, const byte_t *&_it, const byte_t *_end) {
+        if (!detail::is_available(_it, _end, sizeof(T)))
+            return false;
+        load(_value, _it);
+        _it += sizeof(T);
+        return true;
+    }
+};
+
+template<>
+struct traits<bool> {
+    static const bool is_fixed = true;
+    static const std::size_t fixed_size = 1;
+
+    static std::size_t size(const bool &) { return 1; }
+
+    static byte_t *encode(const bool &_value, byte_t *_data) {
+        *_data = (_value ? 0x01 : 0x00);
+        return _data + 1;
+    }
+
+    // Only the lowest bit is significant
+    static void load(bool &_value, const byte_t *_data) {
+        _value = ((*_data & 0x01) != 0);
+    }
+
+    static bool decode(bool &_value, const byte_t *&_it, const byte_t *_end) {
+        if (_it == _end)
+            return false;
+        load(_value, _it++);
+        return true;
+    }
+};
+
+template<typename T>
+struct traits<T, typename std::enable_if<std::is_enum<T>::value>::type> {
+    typedef typename std::underlying_type<T>::type underlying_type;
+    typedef traits<underlying_type> base;
+
+    static const bool is_fixed = true;
+    static const std::size_t fixed_size = sizeof(underlying_type);
+
+    static std::size_t size(const T &) { return fixed_size; }
+
+    static byte_t *encode(const T &_value, byte_t *_data) {
+        return base::encode(static_cast<underlying_type>(_value), _data);
+    }
+
+    static void load(T &_value, const byte_t *_data) {
+        underlying_type its_value;
+        base::load(its_value, _data);
+        _value = static_cast<T>(its_value);
+    }
+
+    static bool decode(T &_value, const byte_t *&_it, const byte_t *_end) {
+        if (!detail::is_available(_it, _end, fixed_size))
+            return false;
+        load(_value, _it);
+        _it += fixed_size;
+        return true;
+    }
+};
+
+// Fixed length arrays
+
+template<typename T, std::size_t N>
+struct traits<std::array<T, N>> {
+    typedef traits<T> element_traits;
+
+    static const bool is_fixed = element_traits::is_fixed;
+    static const std::size_t fixed_size
+        = (is_fixed ? N * element_traits::fixed_size : 0);
+
+    static std::size_t size(const std::array<T, N> &_value) {
+        if (is_fixed)
+            return fixed_size;
+
+        std::size_t its_size(0);
+        for (const auto &e : _value)
+            its_size += element_traits::size(e);
+        return its_size;
+    }
+
+    static byte_t *encode(const std::array<T, N> &_value, byte_t *_data) {
+        for (const auto &e : _value) {
+            _data = element_traits::encode(e, _data);
+            if (!_data)
+                return nullptr;
+        }
+        return _data;
+    }
+
+    static void load(std::array<T, N> &_value, const byte_t *_data) {
+        for (auto &e : _value) {
+            element_traits::load(e, _data);
+            _data += element_traits::fixed_size;
+        }
+    }
+
+    static bool decode(std::array<T, N> &_value,
+            const byte_t *&_it, const byte_t *_end) {
+        return decode(_value, _it, _end, std::integral_constant<bool, is_fixed>());
+    }
+
+private:
+    static bool decode(std::array<T, N> &_value,
+            const byte_t *&_it, const byte_t *_end, std::true_type) {
+        if (!detail::is_available(_it, _end, fixed_size))
+            return false;
+        load(_value, _it);
+        _it += fixed_size;
+        return true;
+    }
+
+    static bool decode(std::array<T, N> &_value,
+            const byte_t *&_it, const byte_t *_end, std::false_type) {
+        for (auto &e : _value) {
+            if (!element_traits::decode(e, _it, _end))
+                return false;
+        }
+        return true;
+    }
+};
+
+// Dynamic length arrays
+
+template<typename T>
+struct traits<std::vector<T>>
+    : detail::dynamic_array_traits<std::vector<T>, 4> {};
+
+template<typename T, std::size_t LengthWidth>
+struct traits<dynamic_array<T, LengthWidth>>
+    : detail::dynamic_array_traits<dynamic_array<T, LengthWidth>, LengthWidth> {};
+
+// Strings
+
+template<>
+struct traits<std::string>
+    : detail::dynamic_string_traits<std::string, 4> {};
+
+template<std::size_t LengthWidth>
+struct traits<dynamic_string<LengthWidth>>
+    : detail::dynamic_string_traits<dynamic_string<LengthWidth>, LengthWidth> {};
+
+// Structs
+
+template<typename T>
+struct traits<T, typename detail::make_void<
+        typename struct_layout<T>::type>::type> {
+    typedef typename struct_layout<T>::type layout;
+    static const std::size_t length_width
+        = detail::struct_length_width<T>::value;
+
+    static const bool is_fixed = (layout::is_fixed && length_width == 0);
+    static const std::size_t fixed_size = (is_fixed ? layout::fixed_size : 0);
+
+    static std::size_t size(const T &_value) {
+        return length_width + layout::size(_value);
+    }
+
+    static byte_t *encode(const T &_value, byte_t *_data) {
+        byte_t *its_begin = _data + length_width;
+        byte_t *its_end = layout::encode(_value, its_begin);
+        return (its_end && detail::length_field<length_width>::finish(
+                its_begin, its_end) ? its_end : nullptr);
+    }
+
+    static void load(T &_value, const byte_t *_data) {
+        layout::load(_value, _data);
+    }
+
+    static bool decode(T &_value, const byte_t *&_it, const byte_t *_end) {
+        return decode(_value, _it, _end,
+                std::integral_constant<bool, (length_width > 0)>());
+    }
+
+private:
+    static bool decode(T &_value, const byte_t *&_it, const byte_t *_end,
+            std::false_type) {
+        return decode_layout(_value, _it, _end,
+                std::integral_constant<bool, layout::is_fixed>());
+    }
+
+    // Structs with length field may have been extended by the sender;
+    // members that are not known are skipped.
+    static bool decode(T &_value, const byte_t *&_it, const byte_t *_end,
+            std::true_type) {
+        std::size_t its_length;
+        if (!detail::length_field<length_width>::decode(its_length, _it, _end))
+            return false;
+        const byte_t *its_end = _it + its_length;
+        if (!decode(_value, _it, its_end, std::false_type()))
+            return false;
+        _it = its_end;
+        return true;
+    }
+
+    static bool decode_layout(T &_value,
+            const byte_t *&_it, const byte_t *_end, std::true_type) {
+        if (!detail::is_available(_it, _end, layout::fixed_size))
+            return false;
+        layout::load(_value, _it);
+        _it += layout::fixed_size;
+        return true;
+    }
+
+    static bool decode_layout(T &_value,
+            const byte_t *&_it, const byte_t *_end, std::false_type) {
+        return layout::decode(_value, _it, _end);
+    }
+};
+
+// Unions
+
+template<typename... Ts>
+struct traits<union_type<Ts...>> {
+    typedef union_type<Ts...> value_type;
+
+    static const bool is_fixed = false;
+    static const std::size_t fixed_size = 0;
+
+    // 32 bit length field + 32 bit type selector
+    static const std::size_t header_size = 8;
+
+    static std::size_t size(const value_type &_value) {
+        return header_size + selected<1>::size(_value);
+    }
+
+    static byte_t *encode(const value_type &_value, byte_t *_data) {
+        detail::store(_value.get_selector(), _data + 4);
+        byte_t *its_begin = _data + header_size;
+        byte_t *its_end = selected<1>::encode(_value, its_begin);
+        if (!its_end)
+            return nullptr;
+        detail::store(static_cast<std::uint32_t>(its_end - its_begin), _data);
+        return its_end;
+    }
+
+    static bool decode(value_type &_value,
+            const byte_t *&_it, const byte_t *_end) {
+        if (!detail::is_available(_it, _end, header_size))
+            return false;
+        const std::size_t its_length(detail::load<std::uint32_t>(_it));
+        const std::uint32_t its_selector(detail::load<std::uint32_t>(_it + 4));
+        _it += header_size;
+        if (!detail::is_available(_it, _end, its_length))
+            return false;
+
+        // Unknown alternatives leave the union empty, padding is skipped
+        const byte_t *its_end = _it + its_length;
+        _value.reset();
+        if (!selected<1>::decode(_value, its_selector, _it, its_end))
+            return false;
+        _it = its_end;
+        return true;
+    }
+
+private:
+    template<std::uint32_t Selector, bool IsValid = (Selector <= sizeof...(Ts))>
+    struct selected {
+        typedef traits<typename value_type::template
+                alternative_type<Selector>> alternative_traits;
+
+        static std::size_t size(const value_type &_value) {
+            return (_value.get_selector() == Selector ?
+                    alternative_traits::size(_value.template get<Selector>()) :
+                    selected<Selector + 1>::size(_value));
+        }
+
+        static byte_t *encode(const value_type &_value, byte_t *_data) {
+            return (_value.get_selector() == Selector ?
+                    alternative_traits::encode(
+                            _value.template get<Selector>(), _data) :
+                    selected<Selector + 1>::encode(_value, _data));
+        }
+
+        static bool decode(value_type &_value, std::uint32_t _selector,
+                const byte_t *&_it, const byte_t *_end) {
+            if (_selector == Selector)
+                return alternative_traits::decode(
+                        _value.template emplace<Selector>(), _it, _end);
+            return selected<Selector + 1>::decode(_value, _selector, _it, _end);
+        }
+    };
+
+    template<std::uint32_t Selector>
+    struct selected<Selector, false> {
+        static std::size_t size(const value_type &) { return 0; }
+
+        static byte_t *encode(const value_type &, byte_t *_data) {
+            return _data;
+        }
+
+        static bool decode(value_type &, std::uint32_t,
+                const byte_t *&, const byte_t *) {
+            return true;
+        }
+    };
+};
+
+/**
+ * \brief Returns the number of bytes needed to serialize the given value.
+ */
+template<typename T>
+inline std::size_t get_size(const T &_value) {
+    return traits<T>::size(_value);
+}
+
+/**
+ * \brief Serializes the given value into a buffer.
+ *
+ * \param _value Value to be serialized.
+ * \param _data Pointer to the buffer.
+ * \param _capacity Size of the buffer.
+ * \param _length Set to the number of bytes written on success.
+ *
+ * \return false if the buffer is too small or a length field overflows.
+ */
+template<typename T>
+inline bool serialize(const T &_value, byte_t *_data, std::size_t _capacity,
+        std::size_t &_length) {
+    const std::size_t its_size(traits<T>::size(_value));
+    if (its_size > _capacity || !traits<T>::encode(_value, _data))
+        return false;
+    _length = its_size;
+    return true;
+}
+
+/**
+ * \brief Serializes the given value. The buffer is (re)sized once to the
+ * needed size.
+ */
+template<typename T>
+inline bool serialize(const T &_value, std::vector<byte_t> &_buffer) {
+    _buffer.resize(traits<T>::size(_value));
+    return (traits<T>::encode(_value, _buffer.data()) != nullptr);
+}
+
+/**
+ * \brief Serializes the given value and replaces the payload content
+ * by the result.
+ */
+template<typename T>
+inline bool serialize(const T &_value, payload &_payload) {
+    std::vector<byte_t> its_buffer;
+    if (!serialize(_value, its_buffer))
+        return false;
+    _payload.set_data(std::move(its_buffer));
+    return true;
+}
+
+/**
+ * \brief Deserializes a value from a buffer. Bytes following the value
+ * are ignored.
+ *
+ * \return false if the buffer does not contain a valid value.
+ */
+template<typename T>
+inline bool deserialize(T &_value, const byte_t *_data, std::size_t _length) {
+    const byte_t *its_it(_data);
+    return traits<T>::decode(_value, its_it, _data + _length);
+}
+
+/**
+ * \brief Deserializes a value from the given payload.
+ */
+template<typename T>
+inline bool deserialize(T &_value, const payload &_payload) {
+    return deserialize(_value, _payload.get_data(), _payload.get_length());
+}
+
+} // namespace serialization
+
+/** @} */
+
+} // namespace vsomeip_v3
+
+#endif // VSOMEIP_V3_SERIALIZATION_HPP_
@@ -0,0 +1,206 @@
+// Copyright (C) 2015-2023 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <condition_variable>
+#include <future>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <vsomeip/vsomeip.hpp>
+
+namespace {
+
+const vsomeip::service_t service_id = 0x1277;
+const vsomeip::instance_t instance_id = 0x1;
+const vsomeip::method_t method_id = 0x1;
+
+const vsomeip::client_t client_one = 0x1344;
+const vsomeip::client_t client_two = 0x1345;
+
+}
+
+class inline_handlers_test_client {
+public:
+    inline_handlers_test_client(const std::string &_name) :
+            app_(vsomeip::runtime::get()->create_application(_name)),
+            is_available_(false) {
+        if (!app_->init()) {
+            ADD_FAILURE() << "Couldn't initialize application " << _name;
+            return;
+        }
+        app_->register_availability_handler(service_id, instance_id,
+                [this](vsomeip::service_t, vsomeip::instance_t,
+                        bool _is_available) {
+                    std::lock_guard<std::mutex> its_lock(mutex_);
+                    is_available_ = _is_available;
+                    condition_.notify_one();
+                });
+        app_->request_service(service_id, instance_id);
+        thread_ = std::thread([this]() { app_->start(); });
+    }
+
+    ~inline_handlers_test_client() {
+        app_->stop();
+        if (thread_.joinable())
+            thread_.join();
+    }
+
+    bool wait_for_availability() {
+        std::unique_lock<std::mutex> its_lock(mutex_);
+        return condition_.wait_for(its_lock, std::chrono::seconds(10),
+                [this]() { return is_available_; });
+    }
+
+    void send(std::uint32_t _first, std::uint32_t _last) {
+        for (std::uint32_t i = _first; i <= _last; i++) {
+            std::shared_ptr<vsomeip::message> its_request
+                = vsomeip::runtime::get()->create_request(false);
+            its_request->set_service(service_id);
+            its_request->set_instance(instance_id);
+            its_request->set_method(method_id);
+            its_request->set_message_type(
+                    vsomeip::message_type_e::MT_REQUEST_NO_RETURN);
+            std::vector<vsomeip::byte_t> its_data {
+                static_cast<vsomeip::byte_t>(i >> 24),
+                static_cast<vsomeip::byte_t>(i >> 16),
+                static_cast<vsomeip::byte_t>(i >> 8),
+                static_cast<vsomeip::byte_t>(i)
+            };
+            its_request->set_payload(
+                    vsomeip::runtime::get()->create_payload(its_data));
+            app_->send(its_request);
+        }
+    }
+
+private:
+    std::shared_ptr<vsomeip::application> app_;
+    std::thread thread_;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool is_available_;
+};
+
+/*
+ * The service is the routing manager and receives the requests with two io
+ * threads that poll before they block and call the message handler inline
+ * (see application_test_inline_handlers.json). The maximum dispatch time
+ * exceeds the delays of the handlers, thus no further dispatcher is started.
+ */
+class someip_application_test_inline_handlers : public ::testing::Test {
+protected:
+    void SetUp() {
+        service_ = vsomeip::runtime::get()->create_application(
+                "inline_handlers_service");
+        ASSERT_TRUE(service_->init());
+        service_->register_message_handler(service_id, instance_id,
+                method_id,
+                std::bind(&someip_application_test_inline_handlers::on_message,
+                        this, std::placeholders::_1));
+        service_->offer_service(service_id, instance_id);
+
+        std::promise<bool> its_promise;
+        service_thread_ = std::thread([&]() {
+            its_promise.set_value(true);
+            service_->start();
+        });
+        EXPECT_TRUE(its_promise.get_future().get());
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    void TearDown() {
+        service_->stop();
+        if (service_thread_.joinable())
+            service_thread_.join();
+    }
+
+    void on_message(const std::shared_ptr<vsomeip::message> &_request) {
+        std::shared_ptr<vsomeip::payload> its_payload = _request->get_payload();
+        if (its_payload->get_length() != sizeof(std::uint32_t)) {
+            ADD_FAILURE() << "Unexpected payload length "
+                    << its_payload->get_length();
+            return;
+        }
+        const vsomeip::byte_t *its_data = its_payload->get_data();
+        const std::uint32_t its_counter
+            = static_cast<std::uint32_t>(its_data[0] << 24 | its_data[1] << 16
+                    | its_data[2] << 8 | its_data[3]);
+
+        std::unique_lock<std::mutex> its_lock(mutex_);
+        auto found_delay = delays_.find(
+                std::make_pair(_request->get_client(), its_counter));
+        if (found_delay != delays_.end()) {
+            const std::chrono::milliseconds its_delay(found_delay->second);
+            its_lock.unlock();
+            std::this_thread::sleep_for(its_delay);
+            its_lock.lock();
+        }
+        received_[_request->get_client()].push_back(its_counter);
+        condition_.notify_one();
+    }
+
+    bool wait_for_requests(vsomeip::client_t _client, std::size_t _count) {
+        std::unique_lock<std::mutex> its_lock(mutex_);
+        return condition_.wait_for(its_lock, std::chrono::seconds(10),
+                [&]() { return received_[_client].size() == _count; });
+    }
+
+    std::shared_ptr<vsomeip::application> service_;
+    std::thread service_thread_;
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::map<std::pair<vsomeip::client_t, std::uint32_t>,
+            std::chrono::milliseconds> delays_;
+    std::map<vsomeip::client_t, std::vector<std::uint32_t>> received_;
+};
+
+/**
+ * @test Requests that arrive while a queued request is handled by the
+ * dispatcher are not handled inline before it
+ */
+TEST_F(someip_application_test_inline_handlers, keep_order)
+{
+    {
+        std::lock_guard<std::mutex> its_lock(mutex_);
+        // The first request of client one is handled inline and blocks its
+        // io thread. The requests of client two that the other io thread
+        // receives meanwhile are queued. The last of them still runs on the
+        // dispatcher when the next requests of client two arrive.
+        delays_[std::make_pair(client_one, 0)] = std::chrono::milliseconds(200);
+        delays_[std::make_pair(client_two, 9)] = std::chrono::milliseconds(300);
+    }
+
+    inline_handlers_test_client its_one("inline_handlers_client_one");
+    inline_handlers_test_client its_two("inline_handlers_client_two");
+    ASSERT_TRUE(its_one.wait_for_availability());
+    ASSERT_TRUE(its_two.wait_for_availability());
+
+    its_one.send(0, 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    its_two.send(0, 9);
+    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+    its_two.send(10, 19);
+
+    EXPECT_TRUE(wait_for_requests(client_one, 1));
+    EXPECT_TRUE(wait_for_requests(client_two, 20));
+
+    std::lock_guard<std::mutex> its_lock(mutex_);
+    const std::vector<std::uint32_t> &its_received = received_[client_two];
+    for (std::uint32_t i = 0; i < its_received.size(); i++) {
+        EXPECT_EQ(i, its_received[i]);
+    }
+}
+
+#ifndef _WIN32
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+#endif
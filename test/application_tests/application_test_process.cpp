@@ -0,0 +1,176 @@
+// Copyright (C) 2015-2023 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <vsomeip/vsomeip.hpp>
+
+namespace {
+
+const vsomeip::service_t service_id = 0x1377;
+const vsomeip::instance_t instance_id = 0x1;
+const vsomeip::method_t method_id = 0x1;
+const vsomeip::method_t shutdown_method_id = 0x2;
+
+// As configured in application_test_process.json
+const int max_queued_handlers = 4;
+
+}
+
+/*
+ * The service uses a single internal thread and is driven by process only
+ * (see application_test_process.json). The client is the routing manager.
+ */
+class someip_application_test_process : public ::testing::Test {
+protected:
+    someip_application_test_process() :
+            is_available_(false),
+            is_registered_(false),
+            received_(0),
+            is_stopped_(false),
+            foreign_handlers_(0) {
+    }
+
+    void SetUp() {
+        processing_thread_ = std::this_thread::get_id();
+
+        client_ = vsomeip::runtime::get()->create_application(
+                "process_test_client");
+        ASSERT_TRUE(client_->init());
+        client_->register_availability_handler(service_id, instance_id,
+                [this](vsomeip::service_t, vsomeip::instance_t,
+                        bool _is_available) {
+                    is_available_ = _is_available;
+                });
+        client_->request_service(service_id, instance_id);
+        client_thread_ = std::thread([this]() { client_->start(); });
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        service_ = vsomeip::runtime::get()->create_application(
+                "process_test_service");
+        ASSERT_TRUE(service_->init());
+        service_->register_state_handler(
+                [this](vsomeip::state_type_e _state) {
+                    check_thread();
+                    is_registered_
+                        = (_state == vsomeip::state_type_e::ST_REGISTERED);
+                });
+        service_->register_message_handler(service_id, instance_id,
+                method_id,
+                [this](const std::shared_ptr<vsomeip::message> &) {
+                    check_thread();
+                    received_++;
+                });
+        service_->register_message_handler(service_id, instance_id,
+                shutdown_method_id,
+                [this](const std::shared_ptr<vsomeip::message> &) {
+                    check_thread();
+                    service_->stop();
+                    is_stopped_ = true;
+                });
+    }
+
+    void TearDown() {
+        client_->stop();
+        if (client_thread_.joinable())
+            client_thread_.join();
+    }
+
+    void check_thread() {
+        if (std::this_thread::get_id() != processing_thread_)
+            foreign_handlers_++;
+    }
+
+    // Processes until the condition is met
+    bool process_until(const std::function<bool()> &_condition) {
+        for (int i = 0; i < 500 && !_condition(); i++) {
+            service_->process(vsomeip::VSOMEIP_ALL);
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return _condition();
+    }
+
+    void send(vsomeip::method_t _method, int _count) {
+        for (int i = 0; i < _count; i++) {
+            std::shared_ptr<vsomeip::message> its_request
+                = vsomeip::runtime::get()->create_request(false);
+            its_request->set_service(service_id);
+            its_request->set_instance(instance_id);
+            its_request->set_method(_method);
+            its_request->set_message_type(
+                    vsomeip::message_type_e::MT_REQUEST_NO_RETURN);
+            client_->send(its_request);
+        }
+    }
+
+    int process(int _number) {
+        const int its_received(received_);
+        service_->process(_number);
+        return received_ - its_received;
+    }
+
+    std::shared_ptr<vsomeip::application> client_;
+    std::thread client_thread_;
+    std::atomic<bool> is_available_;
+
+    std::shared_ptr<vsomeip::application> service_;
+    std::thread::id processing_thread_;
+    bool is_registered_;
+    int received_;
+    bool is_stopped_;
+    int foreign_handlers_;
+};
+
+/**
+ * @test Drive an application by process only: the handlers are called by
+ * the calling thread, at most the given number per call, messages are
+ * dropped if the queue is full and the application is stopped from within
+ * a handler.
+ */
+TEST_F(someip_application_test_process, process)
+{
+    ASSERT_TRUE(process_until([this]() { return is_registered_; }));
+    service_->offer_service(service_id, instance_id);
+    ASSERT_TRUE(process_until([this]() { return is_available_.load(); }));
+
+    // Establish the connection from the client
+    send(method_id, 1);
+    ASSERT_TRUE(process_until([this]() { return received_ == 1; }));
+
+    // The requests are received by the first call, all but the maximum
+    // number of queued handlers are dropped
+    send(method_id, 2 * max_queued_handlers);
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    EXPECT_EQ(2, process(2));
+    EXPECT_EQ(1, process(1));
+    EXPECT_EQ(max_queued_handlers - 3, process(vsomeip::VSOMEIP_ALL));
+    EXPECT_EQ(0, process(vsomeip::VSOMEIP_ALL));
+
+    // The queue accepts messages again
+    send(method_id, 1);
+    EXPECT_TRUE(process_until([this]() {
+        return received_ == 2 + max_queued_handlers;
+    }));
+
+    send(shutdown_method_id, 1);
+    EXPECT_TRUE(process_until([this]() { return is_stopped_; }));
+    EXPECT_EQ(0, process(vsomeip::VSOMEIP_ALL));
+
+    EXPECT_EQ(0, foreign_handlers_);
+}
+
+#ifndef _WIN32
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+#endif
@@ -0,0 +1,220 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <set>
+
+#include "../../implementation/utility/include/client_id_pool.hpp"
+
+using namespace vsomeip_v3;
+
+namespace {
+
+// Former assignment of client identifiers: increment the identifier
+// while keeping the bits that are covered by the diagnosis mask.
+client_t increment(client_t _client, std::uint16_t _diagnosis_mask) {
+    const std::uint16_t its_client_mask
+        = static_cast<std::uint16_t>(~_diagnosis_mask);
+    return static_cast<client_t>(
+            (_client & _diagnosis_mask)
+            | (static_cast<std::uint16_t>((_client | _diagnosis_mask) + 1u)
+                    & its_client_mask));
+}
+
+class reference_assignment {
+public:
+    reference_assignment(std::uint16_t _diagnosis_mask, client_t _diagnosis)
+        : diagnosis_mask_(_diagnosis_mask),
+          smallest_(static_cast<client_t>((_diagnosis << 8) & _diagnosis_mask)),
+          biggest_(static_cast<client_t>(smallest_ | ~_diagnosis_mask)),
+          max_clients_(static_cast<std::uint16_t>((1u << __builtin_popcount(
+                  static_cast<std::uint16_t>(~_diagnosis_mask))) - 1u)),
+          next_(smallest_) {
+    }
+
+    // Adds the assignable identifiers to _pool like utility does
+    void fill(client_id_pool &_pool) const {
+        client_t its_client(smallest_);
+        for (std::uint32_t i = 0; i <= max_clients_; i++) {
+            if (!is_configured(its_client))
+                _pool.add(its_client);
+            its_client = increment(its_client, diagnosis_mask_);
+        }
+    }
+
+    // Searches the pool like utility does
+    client_t find(const client_id_pool &_pool, client_t _next) const {
+        return _pool.find(_next == biggest_ ? smallest_ : _next);
+    }
+
+    client_t request() {
+        if (next_ == biggest_)
+            next_ = smallest_;
+        std::uint16_t its_count(0);
+        do {
+            next_ = increment(next_, diagnosis_mask_);
+            if (its_count++ == max_clients_)
+                return VSOMEIP_CLIENT_UNSET;
+        } while (used_.find(next_) != used_.end() || is_configured(next_));
+        used_.insert(next_);
+        return next_;
+    }
+
+    void release(client_t _client) {
+        used_.erase(_client);
+    }
+
+    client_t get_next() const {
+        return next_;
+    }
+
+    // Simulates identifiers that are statically configured
+    static bool is_configured(client_t _client) {
+        return ((_client % 7) == 3);
+    }
+
+private:
+    const std::uint16_t diagnosis_mask_;
+    const client_t smallest_;
+    const client_t biggest_;
+    const std::uint16_t max_clients_;
+    client_t next_;
+    std::set<client_t> used_;
+};
+
+void compare_with_reference(std::uint16_t _diagnosis_mask, client_t _diagnosis) {
+    reference_assignment its_reference(_diagnosis_mask, _diagnosis);
+    client_id_pool its_pool;
+    its_reference.fill(its_pool);
+
+    client_t its_next(its_reference.get_next());
+    std::vector<client_t> its_assigned;
+    std::uint32_t its_random(42);
+    for (int i = 0; i < 5000; i++) {
+        its_random = its_random * 1103515245u + 12345u;
+        if (!its_assigned.empty() && (its_random >> 16) % 3 == 0) {
+            const std::size_t its_index
+                = (its_random >> 8) % its_assigned.size();
+            const client_t its_client = its_assigned[its_index];
+            its_assigned.erase(its_assigned.begin()
+                    + static_cast<std::ptrdiff_t>(its_index));
+            its_reference.release(its_client);
+            its_pool.release(its_client);
+        } else {
+            const client_t its_expected = its_reference.request();
+            const client_t its_client = its_reference.find(its_pool, its_next);
+            ASSERT_EQ(its_expected, its_client) << "step " << i;
+            if (its_client != VSOMEIP_CLIENT_UNSET) {
+                its_pool.acquire(its_client);
+                its_assigned.push_back(its_client);
+                its_next = its_client;
+            }
+        }
+    }
+}
+
+} // namespace
+
+TEST(client_id_test_pool, empty_pool)
+{
+    client_id_pool its_pool;
+    EXPECT_EQ(VSOMEIP_CLIENT_UNSET, its_pool.find(0x0));
+    EXPECT_EQ(VSOMEIP_CLIENT_UNSET, its_pool.find(0xFFFF));
+}
+
+TEST(client_id_test_pool, wrap_around)
+{
+    client_id_pool its_pool;
+    its_pool.add(0x0001);
+    its_pool.add(0x1000);
+    its_pool.add(0xFFFE);
+
+    EXPECT_EQ(0x1000, its_pool.find(0x0001));
+    EXPECT_EQ(0xFFFE, its_pool.find(0x1000));
+    // Searching continues at the beginning after the biggest identifier
+    EXPECT_EQ(0x0001, its_pool.find(0xFFFE));
+    EXPECT_EQ(0x0001, its_pool.find(0xFFFF));
+
+    // A single free identifier is found from everywhere but itself
+    its_pool.acquire(0x0001);
+    its_pool.acquire(0xFFFE);
+    EXPECT_EQ(0x1000, its_pool.find(0x0FFF));
+    EXPECT_EQ(0x1000, its_pool.find(0xFFFF));
+    EXPECT_EQ(VSOMEIP_CLIENT_UNSET, its_pool.find(0x1000));
+}
+
+TEST(client_id_test_pool, full_pool)
+{
+    client_id_pool its_pool;
+    for (client_t c = 0x0100; c < 0x0180; c++)
+        its_pool.add(c);
+    for (client_t c = 0x0100; c < 0x0180; c++) {
+        const client_t its_client = its_pool.find(client_t(c - 1));
+        ASSERT_EQ(c, its_client);
+        its_pool.acquire(its_client);
+    }
+    EXPECT_EQ(VSOMEIP_CLIENT_UNSET, its_pool.find(0x0100));
+
+    its_pool.release(0x0142);
+    EXPECT_EQ(0x0142, its_pool.find(0x017F));
+    EXPECT_EQ(VSOMEIP_CLIENT_UNSET, its_pool.find(0x0142));
+    its_pool.acquire(0x0142);
+    EXPECT_EQ(VSOMEIP_CLIENT_UNSET, its_pool.find(0x0141));
+
+    its_pool.clear();
+    its_pool.release(0x0142);
+    EXPECT_EQ(VSOMEIP_CLIENT_UNSET, its_pool.find(0x0100));
+}
+
+TEST(client_id_test_pool, non_assignable)
+{
+    client_id_pool its_pool;
+    its_pool.add(0x0110);
+
+    // Predefined identifiers may be acquired and released without
+    // becoming assignable
+    its_pool.acquire(0x0120);
+    its_pool.release(0x0120);
+    EXPECT_EQ(0x0110, its_pool.find(0x0100));
+    EXPECT_EQ(0x0110, its_pool.find(0x0115));
+
+    // Acquiring a predefined identifier of the same word keeps the
+    // assignable one free
+    its_pool.acquire(0x0111);
+    EXPECT_EQ(0x0110, its_pool.find(0x0000));
+
+    its_pool.acquire(0x0110);
+    EXPECT_EQ(VSOMEIP_CLIENT_UNSET, its_pool.find(0x0000));
+    its_pool.release(0x0111);
+    EXPECT_EQ(VSOMEIP_CLIENT_UNSET, its_pool.find(0x0000));
+}
+
+TEST(client_id_test_pool, matches_increment_default_mask)
+{
+    compare_with_reference(0xFF00, 0x01);
+}
+
+TEST(client_id_test_pool, matches_increment_small_range)
+{
+    compare_with_reference(0xFF80, 0x12);
+}
+
+TEST(client_id_test_pool, matches_increment_large_range)
+{
+    compare_with_reference(0xF000, 0x30);
+}
+
+TEST(client_id_test_pool, matches_increment_discontinuous_mask)
+{
+    compare_with_reference(0xFE01, 0x00);
+}
+
+#ifndef _WIN32
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+#endif
@@ -0,0 +1,220 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include <vsomeip/vsomeip.hpp>
+
+#include "../../implementation/routing/include/event.hpp"
+#include "../../implementation/routing/include/routing_manager.hpp"
+
+namespace {
+
+const vsomeip::length_t BUFFER_SIZE = 16;
+
+std::shared_ptr<vsomeip::byte_t> create_buffer() {
+    std::shared_ptr<vsomeip::byte_t> its_buffer(
+            new vsomeip::byte_t[BUFFER_SIZE],
+            std::default_delete<vsomeip::byte_t[]>());
+    for (vsomeip::length_t i = 0; i < BUFFER_SIZE; i++)
+        its_buffer.get()[i] = vsomeip::byte_t(i);
+    return its_buffer;
+}
+
+// The event only needs the io service of its routing manager
+class routing_manager_mock : public vsomeip::routing_manager {
+public:
+    boost::asio::io_service & get_io() { return io_; }
+    vsomeip::client_t get_client() const { return 0x1; }
+    void set_client(const vsomeip::client_t &) {}
+    vsomeip::session_t get_session() { return 0x1; }
+
+    void init() {}
+    void start() {}
+    void stop() {}
+
+    bool offer_service(vsomeip::client_t, vsomeip::service_t,
+            vsomeip::instance_t, vsomeip::major_version_t,
+            vsomeip::minor_version_t) { return true; }
+    void stop_offer_service(vsomeip::client_t, vsomeip::service_t,
+            vsomeip::instance_t, vsomeip::major_version_t,
+            vsomeip::minor_version_t) {}
+    void request_service(vsomeip::client_t, vsomeip::service_t,
+            vsomeip::instance_t, vsomeip::major_version_t,
+            vsomeip::minor_version_t) {}
+    void release_service(vsomeip::client_t, vsomeip::service_t,
+            vsomeip::instance_t) {}
+    void subscribe(vsomeip::client_t, vsomeip::uid_t, vsomeip::gid_t,
+            vsomeip::service_t, vsomeip::instance_t, vsomeip::eventgroup_t,
+            vsomeip::major_version_t, vsomeip::event_t) {}
+    void unsubscribe(vsomeip::client_t, vsomeip::uid_t, vsomeip::gid_t,
+            vsomeip::service_t, vsomeip::instance_t, vsomeip::eventgroup_t,
+            vsomeip::event_t) {}
+
+    bool send(vsomeip::client_t, std::shared_ptr<vsomeip::message>) {
+        return true;
+    }
+    bool send(vsomeip::client_t, const vsomeip::byte_t *, uint32_t,
+            vsomeip::instance_t, bool, vsomeip::client_t,
+            vsomeip::credentials_t, uint8_t, bool) { return true; }
+    bool send_to(const vsomeip::client_t,
+            const std::shared_ptr<vsomeip::endpoint_definition> &,
+            std::shared_ptr<vsomeip::message>) { return true; }
+    bool send_to(const std::shared_ptr<vsomeip::endpoint_definition> &,
+            const vsomeip::byte_t *, uint32_t, vsomeip::instance_t) {
+        return true;
+    }
+
+    void register_event(vsomeip::client_t, vsomeip::service_t,
+            vsomeip::instance_t, vsomeip::event_t,
+            const std::set<vsomeip::eventgroup_t> &,
+            const vsomeip::event_type_e, vsomeip::reliability_type_e,
+            std::chrono::milliseconds, bool, bool,
+            vsomeip::epsilon_change_func_t, bool, bool, bool) {}
+    void unregister_event(vsomeip::client_t, vsomeip::service_t,
+            vsomeip::instance_t, vsomeip::event_t, bool) {}
+    std::shared_ptr<vsomeip::event> find_event(vsomeip::service_t,
+            vsomeip::instance_t, vsomeip::event_t) const { return nullptr; }
+    std::set<std::shared_ptr<vsomeip::event>> find_events(vsomeip::service_t,
+            vsomeip::instance_t, vsomeip::eventgroup_t) const {
+        return std::set<std::shared_ptr<vsomeip::event>>();
+    }
+
+    void notify(vsomeip::service_t, vsomeip::instance_t, vsomeip::event_t,
+            std::shared_ptr<vsomeip::payload>, bool) {}
+    void notify_one(vsomeip::service_t, vsomeip::instance_t, vsomeip::event_t,
+            std::shared_ptr<vsomeip::payload>, vsomeip::client_t, bool
+#ifdef VSOMEIP_ENABLE_COMPAT
+            , bool
+#endif
+            ) {}
+
+    void set_routing_state(vsomeip::routing_state_e) {}
+    void send_get_offered_services_info(vsomeip::client_t,
+            vsomeip::offer_type_e) {}
+
+private:
+    boost::asio::io_service io_;
+};
+
+} // namespace
+
+TEST(shared_payload_test, refers_to_buffer)
+{
+    auto its_buffer = create_buffer();
+    std::shared_ptr<const vsomeip::payload> its_payload
+        = vsomeip::runtime::get()->create_shared_payload(its_buffer, BUFFER_SIZE);
+
+    ASSERT_EQ(BUFFER_SIZE, its_payload->get_length());
+    EXPECT_EQ(its_buffer.get(), its_payload->get_data());
+    // The payload keeps the buffer alive
+    EXPECT_EQ(2, its_buffer.use_count());
+}
+
+TEST(shared_payload_test, copy_on_write)
+{
+    auto its_buffer = create_buffer();
+    auto its_payload
+        = vsomeip::runtime::get()->create_shared_payload(its_buffer, BUFFER_SIZE);
+    auto its_other
+        = vsomeip::runtime::get()->create_shared_payload(its_buffer, BUFFER_SIZE);
+
+    // Writable access must not modify the shared buffer
+    vsomeip::byte_t *its_data = its_payload->get_data();
+    ASSERT_NE(its_buffer.get(), its_data);
+    its_data[0] = 0xFF;
+
+    EXPECT_EQ(0x00, its_buffer.get()[0]);
+    EXPECT_EQ(0xFF, its_payload->get_data()[0]);
+    EXPECT_EQ(BUFFER_SIZE, its_payload->get_length());
+    EXPECT_EQ(0, std::memcmp(its_buffer.get() + 1, its_data + 1,
+            BUFFER_SIZE - 1));
+
+    // Other payloads keep referring to the unmodified buffer
+    std::shared_ptr<const vsomeip::payload> its_const_other(its_other);
+    EXPECT_EQ(its_buffer.get(), its_const_other->get_data());
+    EXPECT_EQ(2, its_buffer.use_count());
+}
+
+TEST(shared_payload_test, compare_without_copy)
+{
+    auto its_buffer = create_buffer();
+    auto its_payload
+        = vsomeip::runtime::get()->create_shared_payload(its_buffer, BUFFER_SIZE);
+    auto its_copy = vsomeip::runtime::get()->create_payload(
+            its_buffer.get(), BUFFER_SIZE);
+
+    EXPECT_TRUE(*its_payload == *its_copy);
+    EXPECT_TRUE(*its_copy == *its_payload);
+
+    std::shared_ptr<const vsomeip::payload> its_const_payload(its_payload);
+    EXPECT_EQ(its_buffer.get(), its_const_payload->get_data());
+}
+
+TEST(shared_payload_test, set_data_replaces_reference)
+{
+    auto its_buffer = create_buffer();
+    auto its_payload
+        = vsomeip::runtime::get()->create_shared_payload(its_buffer, BUFFER_SIZE);
+
+    const vsomeip::byte_t its_data[] = { 0x1, 0x2, 0x3 };
+    its_payload->set_data(its_data, sizeof(its_data));
+
+    EXPECT_EQ(1, its_buffer.use_count());
+    ASSERT_EQ(sizeof(its_data), its_payload->get_length());
+    EXPECT_EQ(0, std::memcmp(its_data, its_payload->get_data(),
+            sizeof(its_data)));
+}
+
+TEST(shared_payload_test, event_keeps_reference)
+{
+    routing_manager_mock its_routing;
+    vsomeip::event its_event(&its_routing);
+
+    auto its_buffer = create_buffer();
+    auto its_payload
+        = vsomeip::runtime::get()->create_shared_payload(its_buffer, BUFFER_SIZE);
+    ASSERT_TRUE(its_event.set_payload_dont_notify(its_payload));
+
+    // The event refers to the shared buffer instead of copying it
+    std::shared_ptr<const vsomeip::payload> its_event_payload
+        = its_event.get_payload();
+    ASSERT_EQ(BUFFER_SIZE, its_event_payload->get_length());
+    EXPECT_EQ(its_buffer.get(), its_event_payload->get_data());
+    EXPECT_EQ(3, its_buffer.use_count());
+
+    // Writing to the event's payload neither modifies the buffer nor the
+    // payload it was set from
+    its_event.get_payload()->get_data()[0] = 0xFF;
+    EXPECT_EQ(0x00, its_buffer.get()[0]);
+    std::shared_ptr<const vsomeip::payload> its_const_payload(its_payload);
+    EXPECT_EQ(its_buffer.get(), its_const_payload->get_data());
+}
+
+TEST(shared_payload_test, event_copies_unshared_payload)
+{
+    routing_manager_mock its_routing;
+    vsomeip::event its_event(&its_routing);
+
+    auto its_buffer = create_buffer();
+    auto its_payload = vsomeip::runtime::get()->create_payload(
+            its_buffer.get(), BUFFER_SIZE);
+    ASSERT_TRUE(its_event.set_payload_dont_notify(its_payload));
+
+    std::shared_ptr<const vsomeip::payload> its_event_payload
+        = its_event.get_payload();
+    std::shared_ptr<const vsomeip::payload> its_const_payload(its_payload);
+    EXPECT_NE(its_const_payload->get_data(), its_event_payload->get_data());
+    EXPECT_TRUE(*its_payload == *its_event.get_payload());
+}
+
+#ifndef _WIN32
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+#endif
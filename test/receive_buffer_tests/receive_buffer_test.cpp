@@ -0,0 +1,211 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include "../../implementation/endpoints/include/receive_buffer.hpp"
+
+using namespace vsomeip_v3;
+
+namespace {
+
+const std::size_t CAPACITY = 1000;
+const std::uint32_t SHRINK_THRESHOLD = 5;
+
+vsomeip_v3::byte_t pattern(std::size_t _position) {
+    return static_cast<vsomeip_v3::byte_t>((_position * 7 + _position / 251) & 0xFF);
+}
+
+// Creates a receive buffer that cannot use the mirrored mapping as no
+// further file descriptor (needed by memfd_create) can be opened.
+std::unique_ptr<receive_buffer> create_linear_buffer() {
+    struct rlimit its_limit;
+    if (getrlimit(RLIMIT_NOFILE, &its_limit) != 0)
+        return nullptr;
+
+    struct rlimit its_no_files(its_limit);
+    its_no_files.rlim_cur = 0;
+    if (setrlimit(RLIMIT_NOFILE, &its_no_files) != 0)
+        return nullptr;
+    std::unique_ptr<receive_buffer> its_buffer(
+            new receive_buffer(CAPACITY, SHRINK_THRESHOLD));
+    setrlimit(RLIMIT_NOFILE, &its_limit);
+    return its_buffer;
+}
+
+// Simulates a stream connection: Receives chunks of varying size and
+// consumes messages of varying size, checking that the unread data always
+// is contiguous and in order.
+class stream {
+public:
+    explicit stream(receive_buffer &_buffer)
+        : buffer_(_buffer), received_(0), consumed_(0) {}
+
+    void receive(std::size_t _required, std::size_t _bytes) {
+        boost::asio::mutable_buffer its_space = buffer_.prepare(_required);
+        ASSERT_GE(boost::asio::buffer_size(its_space), _required);
+        if (_bytes > boost::asio::buffer_size(its_space))
+            _bytes = boost::asio::buffer_size(its_space);
+        byte_t *its_data = boost::asio::buffer_cast<byte_t *>(its_space);
+        for (std::size_t i = 0; i < _bytes; i++)
+            its_data[i] = pattern(received_ + i);
+        buffer_.commit(_bytes);
+        received_ += _bytes;
+        check();
+    }
+
+    void consume(std::size_t _bytes) {
+        if (_bytes > buffer_.size())
+            _bytes = buffer_.size();
+        buffer_.consume(_bytes);
+        consumed_ += _bytes;
+        check();
+    }
+
+    std::size_t get_received() const { return received_; }
+
+private:
+    void check() {
+        ASSERT_EQ(received_ - consumed_, buffer_.size());
+        const byte_t *its_data = buffer_.data();
+        for (std::size_t i = 0; i < buffer_.size(); i++)
+            ASSERT_EQ(pattern(consumed_ + i), its_data[i])
+                << "at " << consumed_ + i;
+    }
+
+    receive_buffer &buffer_;
+    std::size_t received_;
+    std::size_t consumed_;
+};
+
+void run_stream(receive_buffer &_buffer) {
+    stream its_stream(_buffer);
+    const std::size_t its_capacity = _buffer.capacity();
+
+    // Chunk and message sizes are coprime to the capacity such that the
+    // unread data starts at every position of the buffer over time.
+    std::size_t its_chunk(3);
+    std::size_t its_message(5);
+    while (its_stream.get_received() < 20 * its_capacity) {
+        its_stream.receive(1, its_chunk);
+        its_stream.consume(its_message);
+        if (::testing::Test::HasFatalFailure())
+            return;
+        its_chunk = (its_chunk * 13 + 7) % (its_capacity / 2) + 1;
+        its_message = (its_message * 11 + 3) % (its_capacity / 2) + 1;
+    }
+}
+
+} // namespace
+
+TEST(receive_buffer_test, wrap_around)
+{
+    receive_buffer its_buffer(CAPACITY, SHRINK_THRESHOLD);
+    const std::size_t its_capacity = its_buffer.capacity();
+    ASSERT_GE(its_capacity, CAPACITY);
+
+    // Unread data that crosses the end of the buffer
+    stream its_stream(its_buffer);
+    its_stream.receive(1, its_capacity - 10);
+    its_stream.consume(its_capacity - 20);
+    its_stream.receive(1, 30);
+    EXPECT_EQ(40u, its_buffer.size());
+    its_stream.consume(15);
+    its_stream.receive(its_capacity - 25, its_capacity - 25);
+    EXPECT_EQ(its_capacity, its_buffer.size());
+    EXPECT_EQ(its_capacity, its_buffer.capacity());
+    its_stream.consume(its_capacity);
+
+    run_stream(its_buffer);
+}
+
+TEST(receive_buffer_test, linear_fallback)
+{
+    std::unique_ptr<receive_buffer> its_buffer(create_linear_buffer());
+    ASSERT_TRUE(its_buffer != nullptr);
+    // A mirrored buffer would have been rounded to the page size
+    EXPECT_EQ(CAPACITY, its_buffer->capacity());
+
+    stream its_stream(*its_buffer);
+    its_stream.receive(1, CAPACITY - 10);
+    its_stream.consume(CAPACITY - 20);
+    // The unread data is moved to the front instead of wrapping around
+    its_stream.receive(30, 30);
+    its_stream.receive(CAPACITY - 40, CAPACITY - 40);
+    EXPECT_EQ(CAPACITY, its_buffer->size());
+    its_stream.consume(CAPACITY);
+
+    run_stream(*its_buffer);
+}
+
+TEST(receive_buffer_test, large_messages)
+{
+    std::unique_ptr<receive_buffer> its_linear(create_linear_buffer());
+    ASSERT_TRUE(its_linear != nullptr);
+    receive_buffer its_mirrored(CAPACITY, SHRINK_THRESHOLD);
+
+    for (receive_buffer *its_buffer : { its_linear.get(), &its_mirrored }) {
+        const std::size_t its_capacity = its_buffer->capacity();
+        stream its_stream(*its_buffer);
+
+        // Header of a large message that starts in the middle of the ring
+        its_stream.receive(1, its_capacity / 2);
+        its_stream.consume(its_capacity / 2 - 16);
+        EXPECT_EQ(16u, its_buffer->size());
+
+        // The rest of the message exceeds the ring, exactly the
+        // missing bytes are provided
+        const std::size_t its_missing = 3 * its_capacity;
+        boost::asio::mutable_buffer its_space = its_buffer->prepare(its_missing);
+        EXPECT_EQ(its_missing, boost::asio::buffer_size(its_space));
+        EXPECT_EQ(16 + its_missing, its_buffer->capacity());
+
+        // Received in several parts
+        its_stream.receive(its_missing, its_capacity);
+        its_stream.receive(its_missing - its_capacity, its_capacity);
+        its_stream.receive(its_missing - 2 * its_capacity, its_capacity);
+        EXPECT_EQ(16 + its_missing, its_buffer->size());
+
+        // Growing the large buffer keeps the unread data
+        its_stream.consume(10);
+        its_stream.receive(5 * its_capacity, its_capacity);
+        EXPECT_GE(its_buffer->capacity(), 6 + its_missing + 5 * its_capacity);
+
+        // Back to the ring as soon as the unread data fits
+        its_stream.consume(its_buffer->size() - 8);
+        its_stream.receive(1, 8);
+        EXPECT_EQ(its_capacity, its_buffer->capacity());
+        its_stream.consume(16);
+
+        // Another large message reuses the kept buffer, after the shrink
+        // threshold was exceeded it is allocated again
+        for (std::uint32_t i = 0; i <= SHRINK_THRESHOLD + 1; i++) {
+            its_stream.receive(2 * its_capacity, 2 * its_capacity);
+            its_stream.consume(2 * its_capacity);
+            for (std::uint32_t j = 0; j < i; j++) {
+                its_stream.receive(1, 4);
+                its_stream.consume(4);
+            }
+        }
+        if (::testing::Test::HasFatalFailure())
+            return;
+
+        its_buffer->clear();
+        EXPECT_EQ(0u, its_buffer->size());
+        EXPECT_EQ(its_capacity, its_buffer->capacity());
+    }
+}
+
+#ifndef _WIN32
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+#endif
@@ -0,0 +1,151 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "../../implementation/routing/include/deadline_index.hpp"
+
+namespace {
+
+typedef vsomeip_v3::deadline_index<std::uint32_t> index_t;
+
+const index_t::time_point_t START = std::chrono::steady_clock::now();
+const index_t::time_point_t NEVER = START + std::chrono::hours(24);
+
+index_t::time_point_t at(int _seconds) {
+    return START + std::chrono::seconds(_seconds);
+}
+
+std::vector<std::uint32_t> expire(index_t &_index,
+        const index_t::time_point_t &_now) {
+    std::vector<std::uint32_t> its_expired;
+    _index.expire(_now, its_expired);
+    return its_expired;
+}
+
+} // namespace
+
+TEST(deadline_index_test, expire_at_exact_deadline)
+{
+    index_t its_index;
+    its_index.set(1, at(10));
+    its_index.set(2, at(20));
+
+    EXPECT_TRUE(expire(its_index, at(9)).empty());
+    EXPECT_EQ(std::vector<std::uint32_t>({ 1 }), expire(its_index, at(10)));
+    EXPECT_EQ(1u, its_index.size());
+    EXPECT_EQ(at(20), its_index.next(NEVER));
+
+    EXPECT_EQ(std::vector<std::uint32_t>({ 2 }), expire(its_index, at(20)));
+    EXPECT_EQ(0u, its_index.size());
+    EXPECT_EQ(NEVER, its_index.next(NEVER));
+}
+
+TEST(deadline_index_test, refresh_to_later_deadline)
+{
+    index_t its_index;
+    its_index.set(1, at(10));
+    its_index.set(1, at(30));
+    EXPECT_EQ(1u, its_index.size());
+
+    // The outdated heap entry is still due first, but must not expire the key
+    EXPECT_EQ(at(10), its_index.next(NEVER));
+    EXPECT_TRUE(expire(its_index, at(10)).empty());
+    EXPECT_EQ(1u, its_index.size());
+    EXPECT_EQ(at(30), its_index.next(NEVER));
+
+    EXPECT_TRUE(expire(its_index, at(29)).empty());
+    EXPECT_EQ(std::vector<std::uint32_t>({ 1 }), expire(its_index, at(30)));
+    EXPECT_EQ(0u, its_index.size());
+}
+
+TEST(deadline_index_test, refresh_to_earlier_deadline)
+{
+    index_t its_index;
+    its_index.set(1, at(30));
+    its_index.set(1, at(10));
+    EXPECT_EQ(at(10), its_index.next(NEVER));
+
+    EXPECT_EQ(std::vector<std::uint32_t>({ 1 }), expire(its_index, at(10)));
+    // The outdated later entry neither expires the key again nor is
+    // reported as next deadline
+    EXPECT_EQ(NEVER, its_index.next(NEVER));
+    EXPECT_TRUE(expire(its_index, at(30)).empty());
+}
+
+TEST(deadline_index_test, set_if_earlier)
+{
+    index_t its_index;
+    its_index.set_if_earlier(1, at(20));
+    its_index.set_if_earlier(1, at(30));
+    EXPECT_EQ(at(20), its_index.next(NEVER));
+
+    its_index.set_if_earlier(1, at(10));
+    EXPECT_EQ(at(10), its_index.next(NEVER));
+    EXPECT_EQ(std::vector<std::uint32_t>({ 1 }), expire(its_index, at(10)));
+}
+
+TEST(deadline_index_test, erase_then_stale_pop)
+{
+    index_t its_index;
+    its_index.set(1, at(10));
+    its_index.set(2, at(20));
+    its_index.erase(1);
+    EXPECT_EQ(1u, its_index.size());
+
+    EXPECT_TRUE(expire(its_index, at(10)).empty());
+    EXPECT_EQ(std::vector<std::uint32_t>({ 2 }), expire(its_index, at(20)));
+
+    // A key that is set again after being erased uses its new deadline only
+    its_index.set(3, at(30));
+    its_index.erase(3);
+    its_index.set(3, at(40));
+    EXPECT_TRUE(expire(its_index, at(30)).empty());
+    EXPECT_EQ(std::vector<std::uint32_t>({ 3 }), expire(its_index, at(40)));
+}
+
+TEST(deadline_index_test, next_skips_stale_entries)
+{
+    index_t its_index;
+    its_index.set(1, at(10));
+    its_index.set(2, at(20));
+    its_index.set(3, at(30));
+    its_index.erase(1);
+    its_index.set(2, at(15));
+    its_index.erase(2);
+
+    EXPECT_EQ(at(30), its_index.next(NEVER));
+    its_index.erase(3);
+    EXPECT_EQ(NEVER, its_index.next(NEVER));
+}
+
+TEST(deadline_index_test, erase_releases_keys)
+{
+    vsomeip_v3::deadline_index<std::shared_ptr<int> > its_index;
+    std::vector<std::weak_ptr<int> > its_keys;
+    for (int i = 0; i < 64; i++) {
+        auto its_key = std::make_shared<int>(i);
+        its_keys.push_back(its_key);
+        its_index.set(its_key, at(i + 1));
+    }
+    for (auto &k : its_keys)
+        its_index.erase(k.lock());
+    EXPECT_EQ(0u, its_index.size());
+
+    // Outdated heap entries are dropped before they become due
+    std::size_t its_alive(0);
+    for (auto &k : its_keys)
+        its_alive += (k.expired() ? 0 : 1);
+    EXPECT_GT(its_keys.size(), its_alive);
+}
+
+#ifndef _WIN32
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+#endif
@@ -0,0 +1,221 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include "../../implementation/routing/include/local_commands.hpp"
+
+using namespace vsomeip_v3;
+
+namespace {
+
+typedef std::vector<byte_t> bytes_t;
+
+const std::uint32_t EVENT_SIZE = register_event_command::fixed_size;
+const std::uint32_t OFFER_SIZE = replay_state_command::offer_size;
+const std::uint32_t REQUEST_SIZE = VSOMEIP_REQUEST_SERVICE_COMMAND_SIZE
+        - VSOMEIP_COMMAND_HEADER_SIZE;
+
+template<typename T>
+void append(bytes_t &_data, const T &_value) {
+    const byte_t *its_value = reinterpret_cast<const byte_t *>(&_value);
+    _data.insert(_data.end(), its_value, its_value + sizeof(T));
+}
+
+// Writes a REGISTER_EVENT payload the way the proxy does
+bytes_t create_event(service_t _service, event_t _notifier,
+        const std::set<eventgroup_t> &_eventgroups) {
+    bytes_t its_data;
+    append(its_data, _service);
+    append(its_data, instance_t(0x0001));
+    append(its_data, _notifier);
+    its_data.push_back(static_cast<byte_t>(event_type_e::ET_FIELD));
+    its_data.push_back(0x01);
+    its_data.push_back(static_cast<byte_t>(reliability_type_e::RT_RELIABLE));
+    for (auto eg : _eventgroups)
+        append(its_data, eg);
+    return its_data;
+}
+
+bytes_t create_offer(service_t _service) {
+    bytes_t its_data;
+    append(its_data, _service);
+    append(its_data, instance_t(0x0001));
+    its_data.push_back(0x01);
+    append(its_data, minor_version_t(0x2));
+    EXPECT_EQ(OFFER_SIZE, its_data.size());
+    return its_data;
+}
+
+bytes_t create_replay(const std::vector<bytes_t> &_offers,
+        const std::vector<bytes_t> &_events, std::uint32_t _requests) {
+    bytes_t its_data;
+    append(its_data, std::uint32_t(_offers.size() * OFFER_SIZE));
+    for (const auto &o : _offers)
+        its_data.insert(its_data.end(), o.begin(), o.end());
+
+    std::uint32_t its_events_size(0);
+    for (const auto &e : _events)
+        its_events_size += std::uint32_t(sizeof(std::uint32_t) + e.size());
+    append(its_data, its_events_size);
+    for (const auto &e : _events) {
+        append(its_data, std::uint32_t(e.size()));
+        its_data.insert(its_data.end(), e.begin(), e.end());
+    }
+
+    its_data.resize(its_data.size() + _requests * REQUEST_SIZE, 0x00);
+    return its_data;
+}
+
+void set_size(bytes_t &_data, std::size_t _pos, std::uint32_t _size) {
+    std::memcpy(&_data[_pos], &_size, sizeof(_size));
+}
+
+} // namespace
+
+TEST(local_commands_test, register_event_with_eventgroups)
+{
+    const std::set<eventgroup_t> its_eventgroups { 0x0001, 0x0100, 0x1234, 0xFFFE };
+    const bytes_t its_data = create_event(0x1111, 0x8001, its_eventgroups);
+
+    register_event_command its_command;
+    ASSERT_TRUE(its_command.parse(its_data.data(),
+            std::uint32_t(its_data.size())));
+    EXPECT_EQ(0x1111, its_command.service_);
+    EXPECT_EQ(0x0001, its_command.instance_);
+    EXPECT_EQ(0x8001, its_command.notifier_);
+    EXPECT_EQ(event_type_e::ET_FIELD, its_command.type_);
+    EXPECT_TRUE(its_command.is_provided_);
+    EXPECT_EQ(reliability_type_e::RT_RELIABLE, its_command.reliability_);
+    // Eventgroups must not be assembled from halves of adjacent ones
+    EXPECT_EQ(its_eventgroups, its_command.eventgroups_);
+}
+
+TEST(local_commands_test, register_event_sizes)
+{
+    const bytes_t its_data = create_event(0x1111, 0x8001, { 0x0001, 0x0002 });
+    register_event_command its_command;
+
+    // Without eventgroups
+    ASSERT_TRUE(its_command.parse(its_data.data(), EVENT_SIZE));
+    EXPECT_TRUE(its_command.eventgroups_.empty());
+
+    // A trailing byte that does not complete an eventgroup is ignored
+    ASSERT_TRUE(its_command.parse(its_data.data(), EVENT_SIZE + 3));
+    EXPECT_EQ(std::set<eventgroup_t>({ 0x0001 }), its_command.eventgroups_);
+
+    // Truncated fixed part
+    EXPECT_FALSE(its_command.parse(its_data.data(), EVENT_SIZE - 1));
+    EXPECT_FALSE(its_command.parse(its_data.data(), 0));
+}
+
+TEST(local_commands_test, replay_state)
+{
+    const std::vector<bytes_t> its_offers { create_offer(0x1111), create_offer(0x2222) };
+    const std::vector<bytes_t> its_events {
+        create_event(0x1111, 0x8001, { 0x0001, 0x0002, 0x0003 }),
+        create_event(0x2222, 0x8002, { }),
+        create_event(0x2222, 0x8003, { 0x0004 })
+    };
+    const bytes_t its_data = create_replay(its_offers, its_events, 3);
+
+    replay_state_command its_command;
+    ASSERT_TRUE(its_command.parse(its_data.data(), std::uint32_t(its_data.size())));
+    EXPECT_EQ(4u, its_command.offers_pos_);
+    EXPECT_EQ(2 * OFFER_SIZE, its_command.offers_size_);
+    EXPECT_EQ(0, std::memcmp(its_offers[1].data(),
+            &its_data[its_command.offers_pos_ + OFFER_SIZE], OFFER_SIZE));
+
+    ASSERT_EQ(its_events.size(), its_command.events_.size());
+    for (std::size_t i = 0; i < its_events.size(); i++) {
+        const auto &e = its_command.events_[i];
+        ASSERT_EQ(its_events[i].size(), e.second);
+        EXPECT_EQ(0, std::memcmp(its_events[i].data(), &its_data[e.first], e.second));
+    }
+    register_event_command its_event;
+    ASSERT_TRUE(its_event.parse(&its_data[its_command.events_[0].first],
+            its_command.events_[0].second));
+    EXPECT_EQ(std::set<eventgroup_t>({ 0x0001, 0x0002, 0x0003 }),
+            its_event.eventgroups_);
+
+    EXPECT_EQ(3 * REQUEST_SIZE, its_command.requests_size_);
+    EXPECT_EQ(its_data.size(), its_command.requests_pos_ + its_command.requests_size_);
+}
+
+TEST(local_commands_test, replay_state_empty_sections)
+{
+    const bytes_t its_data = create_replay({ }, { }, 0);
+    replay_state_command its_command;
+    ASSERT_TRUE(its_command.parse(its_data.data(), std::uint32_t(its_data.size())));
+    EXPECT_EQ(0u, its_command.offers_size_);
+    EXPECT_TRUE(its_command.events_.empty());
+    EXPECT_EQ(0u, its_command.requests_size_);
+}
+
+TEST(local_commands_test, replay_state_truncated)
+{
+    const bytes_t its_data = create_replay({ create_offer(0x1111) },
+            { create_event(0x1111, 0x8001, { 0x0001 }) }, 0);
+
+    // Every truncation within the offers or event registrations is detected
+    replay_state_command its_command;
+    for (std::uint32_t i = 0; i < its_data.size(); i++)
+        EXPECT_FALSE(its_command.parse(its_data.data(), i)) << "size " << i;
+    EXPECT_TRUE(its_command.parse(its_data.data(), std::uint32_t(its_data.size())));
+}
+
+TEST(local_commands_test, replay_state_oversized_sections)
+{
+    const bytes_t its_valid = create_replay({ create_offer(0x1111) },
+            { create_event(0x1111, 0x8001, { 0x0001 }),
+              create_event(0x1111, 0x8002, { 0x0002 }) }, 1);
+    const std::uint32_t its_events_pos = 4 + OFFER_SIZE;
+    const std::uint32_t its_first_event_pos = its_events_pos + 4;
+    const std::uint32_t its_first_event_size = EVENT_SIZE + 2;
+    const std::uint32_t its_second_event_pos
+        = its_first_event_pos + 4 + its_first_event_size;
+    replay_state_command its_command;
+
+    const std::vector<std::pair<std::size_t, std::uint32_t> > its_sizes {
+        // Offers exceed the command, also if the position overflows
+        { 0, 7 * OFFER_SIZE },
+        { 0, 0xFFFFFFFC },
+        // Offers are not a multiple of the offer size
+        { 0, OFFER_SIZE + 1 },
+        // Event registrations exceed the command
+        { its_events_pos, std::uint32_t(its_valid.size()) },
+        { its_events_pos, 0xFFFFFFFF },
+        // Event registration exceeds the event registrations section
+        { its_first_event_pos, 2 * its_first_event_size + 5 },
+        { its_second_event_pos, 0xFFFFFFFF },
+        // Event registration shorter than its fixed part
+        { its_first_event_pos, EVENT_SIZE - 1 },
+        { its_first_event_pos, 0 }
+    };
+    for (const auto &s : its_sizes) {
+        bytes_t its_data(its_valid);
+        set_size(its_data, s.first, s.second);
+        EXPECT_FALSE(its_command.parse(its_data.data(), std::uint32_t(its_data.size())))
+            << "size " << s.second << " at " << s.first;
+    }
+
+    // Event registrations section too short for the size of an entry
+    bytes_t its_data(its_valid);
+    set_size(its_data, its_events_pos, 4 + its_first_event_size + 2);
+    EXPECT_FALSE(its_command.parse(its_data.data(), std::uint32_t(its_data.size())));
+
+    // A smaller event registrations section leaves the rest to the requests
+    set_size(its_data, its_events_pos, 4 + its_first_event_size);
+    ASSERT_TRUE(its_command.parse(its_data.data(), std::uint32_t(its_data.size())));
+    EXPECT_EQ(1u, its_command.events_.size());
+    EXPECT_EQ(4 + its_first_event_size + REQUEST_SIZE, its_command.requests_size_);
+}
+
+#ifndef _WIN32
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+#endif
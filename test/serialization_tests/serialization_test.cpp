@@ -0,0 +1,438 @@
+// Copyright (C) 2020 Bayerische Motoren Werke Aktiengesellschaft (BMW AG)
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+
+#include <vsomeip/vsomeip.hpp>
+#include <vsomeip/serialization.hpp>
+
+namespace ser = vsomeip_v3::serialization;
+
+typedef std::vector<vsomeip::byte_t> bytes_t;
+
+namespace {
+
+enum class color_e : std::uint16_t {
+    RED = 0x0102,
+    GREEN = 0x0304
+};
+
+struct basic {
+    std::uint8_t u8_;
+    std::int16_t i16_;
+    std::uint32_t u32_;
+    float f32_;
+    double f64_;
+    bool flag_;
+    color_e color_;
+};
+
+struct element {
+    std::uint16_t id_;
+    std::string name_;
+};
+
+// Struct with a 16 bit length field
+struct extensible {
+    std::uint8_t a_;
+    std::uint16_t b_;
+};
+
+struct complex {
+    std::uint32_t id_;
+    std::vector<element> elements_;
+    ser::dynamic_array<std::uint16_t, 1> values_;
+    std::array<std::uint8_t, 3> fixed_;
+    extensible extensible_;
+    ser::union_type<std::uint8_t, std::string> choice_;
+    std::uint16_t trailer_;
+};
+
+} // namespace
+
+namespace vsomeip_v3 {
+namespace serialization {
+
+template<> struct struct_layout<basic> {
+    typedef fields<
+        VSOMEIP_SERIALIZATION_FIELD(basic, u8_),
+        VSOMEIP_SERIALIZATION_FIELD(basic, i16_),
+        VSOMEIP_SERIALIZATION_FIELD(basic, u32_),
+        VSOMEIP_SERIALIZATION_FIELD(basic, f32_),
+        VSOMEIP_SERIALIZATION_FIELD(basic, f64_),
+        VSOMEIP_SERIALIZATION_FIELD(basic, flag_),
+        VSOMEIP_SERIALIZATION_FIELD(basic, color_)
+    > type;
+};
+
+template<> struct struct_layout<element> {
+    typedef fields<
+        VSOMEIP_SERIALIZATION_FIELD(element, id_),
+        VSOMEIP_SERIALIZATION_FIELD(element, name_)
+    > type;
+};
+
+template<> struct struct_layout<extensible> {
+    static const std::size_t length_width = 2;
+    typedef fields<
+        VSOMEIP_SERIALIZATION_FIELD(extensible, a_),
+        VSOMEIP_SERIALIZATION_FIELD(extensible, b_)
+    > type;
+};
+
+template<> struct struct_layout<complex> {
+    typedef fields<
+        VSOMEIP_SERIALIZATION_FIELD(complex, id_),
+        VSOMEIP_SERIALIZATION_FIELD(complex, elements_),
+        VSOMEIP_SERIALIZATION_FIELD(complex, values_),
+        VSOMEIP_SERIALIZATION_FIELD(complex, fixed_),
+        VSOMEIP_SERIALIZATION_FIELD(complex, extensible_),
+        VSOMEIP_SERIALIZATION_FIELD(complex, choice_),
+        VSOMEIP_SERIALIZATION_FIELD(complex, trailer_)
+    > type;
+};
+
+} // namespace serialization
+} // namespace vsomeip_v3
+
+namespace {
+
+complex create_complex() {
+    complex its_value;
+    its_value.id_ = 0x11223344;
+    its_value.elements_.push_back(element { 0x0001, "first" });
+    its_value.elements_.push_back(element { 0x0002, "" });
+    its_value.values_.push_back(0xAABB);
+    its_value.values_.push_back(0xCCDD);
+    its_value.fixed_ = {{ 0x01, 0x02, 0x03 }};
+    its_value.extensible_.a_ = 0x7F;
+    its_value.extensible_.b_ = 0x1234;
+    its_value.choice_.set<2>("union");
+    its_value.trailer_ = 0xBEEF;
+    return its_value;
+}
+
+template<typename T>
+bytes_t encode(const T &_value) {
+    bytes_t its_buffer;
+    EXPECT_TRUE(ser::serialize(_value, its_buffer));
+    return its_buffer;
+}
+
+} // namespace
+
+TEST(serialization_test, basic_types_big_endian)
+{
+    basic its_value { 0x01, -2, 0x03040506, 1.5f, -2.0, true, color_e::GREEN };
+    const bytes_t its_expected {
+        0x01,
+        0xFF, 0xFE,
+        0x03, 0x04, 0x05, 0x06,
+        0x3F, 0xC0, 0x00, 0x00,
+        0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x01,
+        0x03, 0x04
+    };
+    EXPECT_EQ(its_expected.size(), ser::get_size(its_value));
+    EXPECT_EQ(its_expected, encode(its_value));
+
+    basic its_decoded {};
+    ASSERT_TRUE(ser::deserialize(its_decoded,
+            its_expected.data(), its_expected.size()));
+    EXPECT_EQ(0x01, its_decoded.u8_);
+    EXPECT_EQ(-2, its_decoded.i16_);
+    EXPECT_EQ(0x03040506u, its_decoded.u32_);
+    EXPECT_EQ(1.5f, its_decoded.f32_);
+    EXPECT_EQ(-2.0, its_decoded.f64_);
+    EXPECT_TRUE(its_decoded.flag_);
+    EXPECT_EQ(color_e::GREEN, its_decoded.color_);
+
+    // Only the lowest bit of a boolean is significant
+    bool its_flag(true);
+    const bytes_t its_false { 0xFE };
+    ASSERT_TRUE(ser::deserialize(its_flag, its_false.data(), its_false.size()));
+    EXPECT_FALSE(its_flag);
+}
+
+TEST(serialization_test, string_with_bom)
+{
+    const std::string its_value("abc");
+    const bytes_t its_expected {
+        0x00, 0x00, 0x00, 0x07,
+        0xEF, 0xBB, 0xBF, 'a', 'b', 'c', 0x00
+    };
+    EXPECT_EQ(its_expected, encode(its_value));
+
+    std::string its_decoded;
+    ASSERT_TRUE(ser::deserialize(its_decoded,
+            its_expected.data(), its_expected.size()));
+    EXPECT_EQ(its_value, its_decoded);
+
+    const bytes_t its_empty { 0x00, 0x00, 0x00, 0x04, 0xEF, 0xBB, 0xBF, 0x00 };
+    EXPECT_EQ(its_empty, encode(std::string()));
+    ASSERT_TRUE(ser::deserialize(its_decoded, its_empty.data(), its_empty.size()));
+    EXPECT_TRUE(its_decoded.empty());
+}
+
+TEST(serialization_test, malformed_strings)
+{
+    const std::vector<bytes_t> its_malformed {
+        // Missing byte order mark
+        { 0x00, 0x00, 0x00, 0x04, 'a', 'b', 'c', 0x00 },
+        // UTF-16 byte order marks (only UTF-8 is supported)
+        { 0x00, 0x00, 0x00, 0x06, 0xFE, 0xFF, 0x00, 'a', 0x00, 0x00 },
+        { 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 'a', 0x00, 0x00, 0x00 },
+        // Missing terminating zero
+        { 0x00, 0x00, 0x00, 0x04, 0xEF, 0xBB, 0xBF, 'a' },
+        // Length shorter than byte order mark and terminating zero
+        { 0x00, 0x00, 0x00, 0x03, 0xEF, 0xBB, 0xBF, 0x00 },
+        { 0x00, 0x00, 0x00, 0x00 },
+        // Length exceeds the buffer
+        { 0x00, 0x00, 0x00, 0x09, 0xEF, 0xBB, 0xBF, 'a', 0x00 },
+        // Truncated length field
+        { 0x00, 0x00, 0x00 }
+    };
+    for (const auto &b : its_malformed) {
+        std::string its_decoded;
+        EXPECT_FALSE(ser::deserialize(its_decoded, b.data(), b.size()));
+    }
+}
+
+TEST(serialization_test, string_length_field_widths)
+{
+    const ser::dynamic_string<1> its_short("ab");
+    const bytes_t its_expected_short { 0x06, 0xEF, 0xBB, 0xBF, 'a', 'b', 0x00 };
+    EXPECT_EQ(its_expected_short, encode(its_short));
+
+    const ser::dynamic_string<2> its_medium("ab");
+    const bytes_t its_expected_medium {
+        0x00, 0x06, 0xEF, 0xBB, 0xBF, 'a', 'b', 0x00
+    };
+    EXPECT_EQ(its_expected_medium, encode(its_medium));
+
+    ser::dynamic_string<1> its_decoded;
+    ASSERT_TRUE(ser::deserialize(its_decoded,
+            its_expected_short.data(), its_expected_short.size()));
+    EXPECT_EQ("ab", its_decoded);
+
+    // 251 characters + byte order mark + terminating zero fit into 8 bit
+    bytes_t its_buffer;
+    EXPECT_TRUE(ser::serialize(ser::dynamic_string<1>(251, 'x'), its_buffer));
+    EXPECT_EQ(0xFF, its_buffer[0]);
+    EXPECT_FALSE(ser::serialize(ser::dynamic_string<1>(252, 'x'), its_buffer));
+    EXPECT_TRUE(ser::serialize(ser::dynamic_string<2>(252, 'x'), its_buffer));
+    EXPECT_FALSE(ser::serialize(ser::dynamic_string<2>(0xFFFC, 'x'), its_buffer));
+}
+
+TEST(serialization_test, array_length_field_widths)
+{
+    const ser::dynamic_array<std::uint16_t, 1> its_short { 0x0102, 0x0304 };
+    const bytes_t its_expected_short { 0x04, 0x01, 0x02, 0x03, 0x04 };
+    EXPECT_EQ(its_expected_short, encode(its_short));
+
+    const ser::dynamic_array<std::uint16_t, 2> its_medium { 0x0102 };
+    const bytes_t its_expected_medium { 0x00, 0x02, 0x01, 0x02 };
+    EXPECT_EQ(its_expected_medium, encode(its_medium));
+
+    const std::vector<std::uint8_t> its_long { 0x01, 0x02, 0x03 };
+    const bytes_t its_expected_long { 0x00, 0x00, 0x00, 0x03, 0x01, 0x02, 0x03 };
+    EXPECT_EQ(its_expected_long, encode(its_long));
+
+    ser::dynamic_array<std::uint16_t, 1> its_decoded;
+    ASSERT_TRUE(ser::deserialize(its_decoded,
+            its_expected_short.data(), its_expected_short.size()));
+    EXPECT_EQ(its_short, its_decoded);
+
+    bytes_t its_buffer;
+    EXPECT_TRUE(ser::serialize(
+            ser::dynamic_array<std::uint8_t, 1>(255, 0x00), its_buffer));
+    EXPECT_FALSE(ser::serialize(
+            ser::dynamic_array<std::uint8_t, 1>(256, 0x00), its_buffer));
+    EXPECT_FALSE(ser::serialize(
+            ser::dynamic_array<std::uint32_t, 2>(0x4000, 0x00), its_buffer));
+}
+
+TEST(serialization_test, malformed_arrays)
+{
+    std::vector<std::uint16_t> its_values;
+
+    // Length is not a multiple of the element size
+    const bytes_t its_odd { 0x00, 0x00, 0x00, 0x03, 0x01, 0x02, 0x03 };
+    EXPECT_FALSE(ser::deserialize(its_values, its_odd.data(), its_odd.size()));
+
+    // Length exceeds the buffer
+    const bytes_t its_long { 0x00, 0x00, 0x00, 0x04, 0x01, 0x02 };
+    EXPECT_FALSE(ser::deserialize(its_values, its_long.data(), its_long.size()));
+
+    // Element exceeds the length of the array
+    std::vector<element> its_elements;
+    const bytes_t its_overlapping {
+        0x00, 0x00, 0x00, 0x04,
+        0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0xEF, 0xBB, 0xBF, 0x00
+    };
+    EXPECT_FALSE(ser::deserialize(its_elements,
+            its_overlapping.data(), its_overlapping.size()));
+}
+
+TEST(serialization_test, struct_with_length_field)
+{
+    const extensible its_value { 0x01, 0x0203 };
+    const bytes_t its_expected { 0x00, 0x03, 0x01, 0x02, 0x03 };
+    EXPECT_EQ(its_expected, encode(its_value));
+
+    // Members added by a newer sender are skipped
+    const std::vector<std::uint8_t> its_extended {
+        0x00, 0x05, 0x01, 0x02, 0x03, 0xFF, 0xFF, 0x42
+    };
+    extensible its_decoded {};
+    const vsomeip::byte_t *its_it = its_extended.data();
+    ASSERT_TRUE(ser::traits<extensible>::decode(its_decoded, its_it,
+            its_extended.data() + its_extended.size()));
+    EXPECT_EQ(0x01, its_decoded.a_);
+    EXPECT_EQ(0x0203, its_decoded.b_);
+    EXPECT_EQ(its_extended.data() + 7, its_it);
+
+    // Length too short for the known members
+    const bytes_t its_short { 0x00, 0x02, 0x01, 0x02, 0x03 };
+    EXPECT_FALSE(ser::deserialize(its_decoded, its_short.data(), its_short.size()));
+
+    // Length exceeds the buffer
+    const bytes_t its_long { 0x00, 0x04, 0x01, 0x02, 0x03 };
+    EXPECT_FALSE(ser::deserialize(its_decoded, its_long.data(), its_long.size()));
+}
+
+TEST(serialization_test, union_selectors)
+{
+    typedef ser::union_type<std::uint8_t, std::string> union_t;
+
+    union_t its_empty;
+    const bytes_t its_expected_empty {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+    EXPECT_EQ(its_expected_empty, encode(its_empty));
+
+    union_t its_value;
+    its_value.set<1>(0x42);
+    const bytes_t its_expected {
+        0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x42
+    };
+    EXPECT_EQ(its_expected, encode(its_value));
+
+    union_t its_decoded;
+    ASSERT_TRUE(ser::deserialize(its_decoded, its_expected.data(),
+            its_expected.size()));
+    ASSERT_EQ(1u, its_decoded.get_selector());
+    EXPECT_EQ(0x42, its_decoded.get<1>());
+
+    its_value.set<2>("x");
+    const bytes_t its_encoded_string = encode(its_value);
+    ASSERT_TRUE(ser::deserialize(its_decoded, its_encoded_string.data(),
+            its_encoded_string.size()));
+    ASSERT_EQ(2u, its_decoded.get_selector());
+    EXPECT_EQ("x", its_decoded.get<2>());
+
+    // Padding following the alternative is skipped
+    const std::vector<std::uint8_t> its_padded {
+        0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x42, 0x00, 0x00, 0x55
+    };
+    const vsomeip::byte_t *its_it = its_padded.data();
+    ASSERT_TRUE(ser::traits<union_t>::decode(its_decoded, its_it,
+            its_padded.data() + its_padded.size()));
+    EXPECT_EQ(1u, its_decoded.get_selector());
+    EXPECT_EQ(its_padded.data() + 11, its_it);
+
+    // Unknown selectors leave the union empty
+    const bytes_t its_unknown {
+        0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x01, 0x02
+    };
+    ASSERT_TRUE(ser::deserialize(its_decoded, its_unknown.data(),
+            its_unknown.size()));
+    EXPECT_EQ(0u, its_decoded.get_selector());
+
+    // Length exceeds the buffer
+    const bytes_t its_long {
+        0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x42
+    };
+    EXPECT_FALSE(ser::deserialize(its_decoded, its_long.data(), its_long.size()));
+
+    // Alternative exceeds the length of the union
+    const bytes_t its_overlapping {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42
+    };
+    EXPECT_FALSE(ser::deserialize(its_decoded, its_overlapping.data(),
+            its_overlapping.size()));
+}
+
+TEST(serialization_test, complex_round_trip)
+{
+    const complex its_value = create_complex();
+    const bytes_t its_buffer = encode(its_value);
+    EXPECT_EQ(ser::get_size(its_value), its_buffer.size());
+
+    complex its_decoded {};
+    ASSERT_TRUE(ser::deserialize(its_decoded, its_buffer.data(), its_buffer.size()));
+    EXPECT_EQ(its_value.id_, its_decoded.id_);
+    ASSERT_EQ(2u, its_decoded.elements_.size());
+    EXPECT_EQ(0x0001, its_decoded.elements_[0].id_);
+    EXPECT_EQ("first", its_decoded.elements_[0].name_);
+    EXPECT_EQ(0x0002, its_decoded.elements_[1].id_);
+    EXPECT_EQ("", its_decoded.elements_[1].name_);
+    EXPECT_EQ(its_value.values_, its_decoded.values_);
+    EXPECT_EQ(its_value.fixed_, its_decoded.fixed_);
+    EXPECT_EQ(0x7F, its_decoded.extensible_.a_);
+    EXPECT_EQ(0x1234, its_decoded.extensible_.b_);
+    ASSERT_EQ(2u, its_decoded.choice_.get_selector());
+    EXPECT_EQ("union", its_decoded.choice_.get<2>());
+    EXPECT_EQ(0xBEEF, its_decoded.trailer_);
+
+    // Via payload
+    std::shared_ptr<vsomeip::payload> its_payload
+        = vsomeip::runtime::get()->create_payload();
+    ASSERT_TRUE(ser::serialize(its_value, *its_payload));
+    EXPECT_EQ(its_buffer, bytes_t(its_payload->get_data(),
+            its_payload->get_data() + its_payload->get_length()));
+    complex its_from_payload {};
+    ASSERT_TRUE(ser::deserialize(its_from_payload, *its_payload));
+    EXPECT_EQ(0xBEEF, its_from_payload.trailer_);
+}
+
+TEST(serialization_test, truncated_buffers)
+{
+    const bytes_t its_buffer = encode(create_complex());
+    for (std::size_t i = 0; i < its_buffer.size(); i++) {
+        complex its_decoded {};
+        EXPECT_FALSE(ser::deserialize(its_decoded, its_buffer.data(), i))
+            << "length " << i;
+    }
+
+    basic its_basic {};
+    const bytes_t its_basic_buffer = encode(its_basic);
+    for (std::size_t i = 0; i < its_basic_buffer.size(); i++) {
+        EXPECT_FALSE(ser::deserialize(its_basic, its_basic_buffer.data(), i))
+            << "length " << i;
+    }
+}
+
+TEST(serialization_test, insufficient_capacity)
+{
+    const complex its_value = create_complex();
+    const std::size_t its_size = ser::get_size(its_value);
+    std::vector<vsomeip::byte_t> its_buffer(its_size);
+
+    std::size_t its_length(0);
+    EXPECT_FALSE(ser::serialize(its_value, its_buffer.data(), its_size - 1,
+            its_length));
+    EXPECT_EQ(0u, its_length);
+    ASSERT_TRUE(ser::serialize(its_value, its_buffer.data(), its_size,
+            its_length));
+    EXPECT_EQ(its_size, its_length);
+}
+
+#ifndef _WIN32
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+#endif